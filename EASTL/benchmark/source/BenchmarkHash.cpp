@@ -8,6 +8,7 @@
 #include <EAStdC/EAStopwatch.h>
 #include <EASTL/vector.h>
 #include <EASTL/hash_map.h>
+#include <EASTL/flat_hash_map.h>
 #include <EASTL/string.h>
 #include <EASTL/algorithm.h>
 
@@ -125,6 +126,17 @@ struct HashString8
 #endif
 
 
+// The flat_hash_map results are measured against eastl::hash_map, which takes the std column.
+typedef eastl::hash_map<uint32_t, TestObject>                                       EaHashMapUint32TO;
+typedef eastl::flat_hash_map<uint32_t, TestObject>                                  EaFlatMapUint32TO;
+
+typedef eastl::hash_map<eastl::string, uint32_t, HashString8<eastl::string> >       EaHashMapStrUint32;
+typedef eastl::flat_hash_map<eastl::string, uint32_t, HashString8<eastl::string> >  EaFlatMapStrUint32;
+
+// The power of two hash_map results are measured against the default (prime) hash_map.
+typedef eastl::hash_map<uint32_t, TestObject, eastl::power_of_two_hash<uint32_t> >  EaPow2MapUint32TO;
+
+
 
 
 namespace
@@ -264,6 +276,27 @@ namespace
 	}
 
 
+	// Same as TestErasePosition, but always uses the iterator returned by erase, which
+	// is required by containers that move elements on erase (e.g. flat_hash_map).
+	template <typename Container>
+	void TestErasePositionReturned(EA::StdC::Stopwatch& stopwatch, Container& c)
+	{
+		typename Container::size_type j, jEnd;
+		typename Container::iterator it;
+
+		stopwatch.Restart();
+		for(j = 0, jEnd = c.size() / 3, it = c.begin(); j < jEnd; ++j)
+		{
+			it = c.erase(it);
+			++it;
+			++it;
+		}
+
+		stopwatch.Stop();
+		sprintf(Benchmark::gScratchBuffer, "%p %p", &c, &it);
+	}
+
+
 	template <typename Container>
 	void TestEraseRange(EA::StdC::Stopwatch& stopwatch, Container& c)
 	{
@@ -291,6 +324,60 @@ namespace
 	}
 
 
+	template <typename Container, typename Value>
+	void TestFindLoop(EA::StdC::Stopwatch& stopwatch, Container& c, const Value* pArrayBegin, const Value* pArrayEnd, typename Container::iterator* pResults)
+	{
+		stopwatch.Restart();
+		while(pArrayBegin != pArrayEnd)
+			*pResults++ = c.find(*pArrayBegin++);
+		stopwatch.Stop();
+		sprintf(Benchmark::gScratchBuffer, "%p", &pResults[-1]);
+	}
+
+
+	template <typename Container, typename Value>
+	void TestFindBatch(EA::StdC::Stopwatch& stopwatch, Container& c, const Value* pArrayBegin, const Value* pArrayEnd, typename Container::iterator* pResults)
+	{
+		stopwatch.Restart();
+		pResults = c.find_batch(pArrayBegin, pArrayEnd, pResults);
+		stopwatch.Stop();
+		sprintf(Benchmark::gScratchBuffer, "%p", &pResults[-1]);
+	}
+
+
+	// Returns the longest single insert, which is where a rehash of the whole table shows up.
+	template <typename Container>
+	uint64_t TestInsertLatency(EA::StdC::Stopwatch& stopwatch, Container& c, eastl_size_t nCount)
+	{
+		uint64_t nMaxCycles = 0;
+
+		stopwatch.Restart();
+		for(eastl_size_t i = 0; i < nCount; i++)
+		{
+			const uint64_t nStartCycle = EA::StdC::Stopwatch::GetCPUCycle();
+			c.insert(typename Container::value_type((uint32_t)(i * 2654435761u), i));
+			nMaxCycles = eastl::max_alt(nMaxCycles, EA::StdC::Stopwatch::GetCPUCycle() - nStartCycle);
+		}
+		stopwatch.Stop();
+		sprintf(Benchmark::gScratchBuffer, "%u", (unsigned)c.size());
+
+		return nMaxCycles;
+	}
+
+
+	template <typename Hash>
+	void TestHashString(EA::StdC::Stopwatch& stopwatch, const Hash& hash, const eastl::vector< eastl::pair<eastl::string, uint32_t> >& strings)
+	{
+		size_t h = 0;
+
+		stopwatch.Restart();
+		for(eastl_size_t i = 0, iEnd = strings.size(); i < iEnd; i++)
+			h ^= hash(strings[i].first);
+		stopwatch.Stop();
+		sprintf(Benchmark::gScratchBuffer, "%u", (unsigned)h);
+	}
+
+
 } // namespace
 
 
@@ -516,6 +603,408 @@ void BenchmarkHash()
 	#else
 		EASTLTest_Printf("HashMap...Unsupported by the tested std STL.\n");
 	#endif
+
+	{
+		EASTLTest_Printf("FlatHashMap\n");
+
+		EA::UnitTest::Rand  rng(EA::UnitTest::GetRandSeed());
+		EA::StdC::Stopwatch stopwatch1(EA::StdC::Stopwatch::kUnitsCPUCycles);
+		EA::StdC::Stopwatch stopwatch2(EA::StdC::Stopwatch::kUnitsCPUCycles);
+		const char* const   pNotes = "hash_map vs flat_hash_map";
+
+		eastl::vector< eastl::pair<uint32_t, TestObject> >      eaVectorUT(10000);
+		eastl::vector< eastl::pair<eastl::string, uint32_t> >  eaVectorSU(10000);
+
+		for(eastl_size_t i = 0, iEnd = eaVectorUT.size(); i < iEnd; i++)
+		{
+			const uint32_t n1 = rng.RandLimit((uint32_t)(iEnd / 2));
+			const uint32_t n2 = rng.RandValue();
+
+			eaVectorUT[i] = eastl::pair<uint32_t, TestObject>(n1, TestObject(n2));
+
+			char str_n1[32];
+			sprintf(str_n1, "%u", (unsigned)n1);
+
+			eaVectorSU[i] = eastl::pair<eastl::string, uint32_t>(eastl::string(str_n1), n2);
+		}
+
+		for(int i = 0; i < 2; i++)
+		{
+			EaHashMapUint32TO  hashMapUint32TO;
+			EaFlatMapUint32TO  flatMapUint32TO;
+
+			EaHashMapStrUint32 hashMapStrUint32;
+			EaFlatMapStrUint32 flatMapStrUint32;
+
+
+			///////////////////////////////
+			// Test insert(const value_type&)
+			///////////////////////////////
+
+			TestInsert(stopwatch1, hashMapUint32TO, eaVectorUT.data(), eaVectorUT.data() + eaVectorUT.size());
+			TestInsert(stopwatch2, flatMapUint32TO, eaVectorUT.data(), eaVectorUT.data() + eaVectorUT.size());
+
+			if(i == 1)
+				Benchmark::AddResult("flat_hash_map<uint32_t, TestObject>/insert", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNotes);
+
+			TestInsert(stopwatch1, hashMapStrUint32, eaVectorSU.data(), eaVectorSU.data() + eaVectorSU.size());
+			TestInsert(stopwatch2, flatMapStrUint32, eaVectorSU.data(), eaVectorSU.data() + eaVectorSU.size());
+
+			if(i == 1)
+				Benchmark::AddResult("flat_hash_map<string, uint32_t>/insert", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNotes);
+
+
+			///////////////////////////////
+			// Test iteration
+			///////////////////////////////
+
+			TestIteration(stopwatch1, hashMapUint32TO, EaHashMapUint32TO::value_type(9999999, TestObject(9999999)));
+			TestIteration(stopwatch2, flatMapUint32TO, EaFlatMapUint32TO::value_type(9999999, TestObject(9999999)));
+
+			if(i == 1)
+				Benchmark::AddResult("flat_hash_map<uint32_t, TestObject>/iteration", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNotes);
+
+			TestIteration(stopwatch1, hashMapStrUint32, EaHashMapStrUint32::value_type(eastl::string("9999999"), 9999999));
+			TestIteration(stopwatch2, flatMapStrUint32, EaFlatMapStrUint32::value_type(eastl::string("9999999"), 9999999));
+
+			if(i == 1)
+				Benchmark::AddResult("flat_hash_map<string, uint32_t>/iteration", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNotes);
+
+
+			///////////////////////////////
+			// Test operator[]
+			///////////////////////////////
+
+			TestBracket(stopwatch1, hashMapUint32TO, eaVectorUT.data(), eaVectorUT.data() + eaVectorUT.size());
+			TestBracket(stopwatch2, flatMapUint32TO, eaVectorUT.data(), eaVectorUT.data() + eaVectorUT.size());
+
+			if(i == 1)
+				Benchmark::AddResult("flat_hash_map<uint32_t, TestObject>/operator[]", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNotes);
+
+			TestBracket(stopwatch1, hashMapStrUint32, eaVectorSU.data(), eaVectorSU.data() + eaVectorSU.size());
+			TestBracket(stopwatch2, flatMapStrUint32, eaVectorSU.data(), eaVectorSU.data() + eaVectorSU.size());
+
+			if(i == 1)
+				Benchmark::AddResult("flat_hash_map<string, uint32_t>/operator[]", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNotes);
+
+
+			///////////////////////////////
+			// Test find
+			///////////////////////////////
+
+			TestFind(stopwatch1, hashMapUint32TO, eaVectorUT.data(), eaVectorUT.data() + eaVectorUT.size());
+			TestFind(stopwatch2, flatMapUint32TO, eaVectorUT.data(), eaVectorUT.data() + eaVectorUT.size());
+
+			if(i == 1)
+				Benchmark::AddResult("flat_hash_map<uint32_t, TestObject>/find", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNotes);
+
+			TestFind(stopwatch1, hashMapStrUint32, eaVectorSU.data(), eaVectorSU.data() + eaVectorSU.size());
+			TestFind(stopwatch2, flatMapStrUint32, eaVectorSU.data(), eaVectorSU.data() + eaVectorSU.size());
+
+			if(i == 1)
+				Benchmark::AddResult("flat_hash_map<string, uint32_t>/find", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNotes);
+
+
+			///////////////////////////////
+			// Test find_as
+			///////////////////////////////
+
+			TestFindAsEa(stopwatch1, hashMapStrUint32, eaVectorSU.data(), eaVectorSU.data() + eaVectorSU.size());
+			TestFindAsEa(stopwatch2, flatMapStrUint32, eaVectorSU.data(), eaVectorSU.data() + eaVectorSU.size());
+
+			if(i == 1)
+				Benchmark::AddResult("flat_hash_map<string, uint32_t>/find_as/char*", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNotes);
+
+
+			///////////////////////////////
+			// Test count
+			///////////////////////////////
+
+			TestCount(stopwatch1, hashMapUint32TO, eaVectorUT.data(), eaVectorUT.data() + eaVectorUT.size());
+			TestCount(stopwatch2, flatMapUint32TO, eaVectorUT.data(), eaVectorUT.data() + eaVectorUT.size());
+
+			if(i == 1)
+				Benchmark::AddResult("flat_hash_map<uint32_t, TestObject>/count", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNotes);
+
+			TestCount(stopwatch1, hashMapStrUint32, eaVectorSU.data(), eaVectorSU.data() + eaVectorSU.size());
+			TestCount(stopwatch2, flatMapStrUint32, eaVectorSU.data(), eaVectorSU.data() + eaVectorSU.size());
+
+			if(i == 1)
+				Benchmark::AddResult("flat_hash_map<string, uint32_t>/count", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNotes);
+
+
+			///////////////////////////////
+			// Test erase(const key_type& key)
+			///////////////////////////////
+
+			TestEraseValue(stopwatch1, hashMapUint32TO, eaVectorUT.data(), eaVectorUT.data() + (eaVectorUT.size() / 2));
+			TestEraseValue(stopwatch2, flatMapUint32TO, eaVectorUT.data(), eaVectorUT.data() + (eaVectorUT.size() / 2));
+
+			if(i == 1)
+				Benchmark::AddResult("flat_hash_map<uint32_t, TestObject>/erase val", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNotes);
+
+			TestEraseValue(stopwatch1, hashMapStrUint32, eaVectorSU.data(), eaVectorSU.data() + (eaVectorSU.size() / 2));
+			TestEraseValue(stopwatch2, flatMapStrUint32, eaVectorSU.data(), eaVectorSU.data() + (eaVectorSU.size() / 2));
+
+			if(i == 1)
+				Benchmark::AddResult("flat_hash_map<string, uint32_t>/erase val", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNotes);
+
+
+			///////////////////////////////
+			// Test erase(iterator position)
+			///////////////////////////////
+
+			TestErasePositionReturned(stopwatch1, hashMapUint32TO);
+			TestErasePositionReturned(stopwatch2, flatMapUint32TO);
+
+			if(i == 1)
+				Benchmark::AddResult("flat_hash_map<uint32_t, TestObject>/erase pos", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNotes);
+
+			TestErasePositionReturned(stopwatch1, hashMapStrUint32);
+			TestErasePositionReturned(stopwatch2, flatMapStrUint32);
+
+			if(i == 1)
+				Benchmark::AddResult("flat_hash_map<string, uint32_t>/erase pos", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNotes);
+
+
+			///////////////////////////////
+			// Test erase(iterator first, iterator last)
+			///////////////////////////////
+
+			TestEraseRange(stopwatch1, hashMapUint32TO);
+			TestEraseRange(stopwatch2, flatMapUint32TO);
+
+			if(i == 1)
+				Benchmark::AddResult("flat_hash_map<uint32_t, TestObject>/erase range", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNotes);
+
+			TestEraseRange(stopwatch1, hashMapStrUint32);
+			TestEraseRange(stopwatch2, flatMapStrUint32);
+
+			if(i == 1)
+				Benchmark::AddResult("flat_hash_map<string, uint32_t>/erase range", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNotes);
+
+
+			///////////////////////////////
+			// Test clear()
+			///////////////////////////////
+
+			// Clear the containers of whatever they happen to have. We want the containers to have full data.
+			TestClear(stopwatch1, hashMapUint32TO);
+			TestClear(stopwatch2, flatMapUint32TO);
+			TestClear(stopwatch1, hashMapStrUint32);
+			TestClear(stopwatch2, flatMapStrUint32);
+
+			// Re-set the containers with full data.
+			TestInsert(stopwatch1, hashMapUint32TO,  eaVectorUT.data(), eaVectorUT.data() + eaVectorUT.size());
+			TestInsert(stopwatch2, flatMapUint32TO,  eaVectorUT.data(), eaVectorUT.data() + eaVectorUT.size());
+			TestInsert(stopwatch1, hashMapStrUint32, eaVectorSU.data(), eaVectorSU.data() + eaVectorSU.size());
+			TestInsert(stopwatch2, flatMapStrUint32, eaVectorSU.data(), eaVectorSU.data() + eaVectorSU.size());
+
+			// Now clear the data again, this time measuring it.
+			TestClear(stopwatch1, hashMapUint32TO);
+			TestClear(stopwatch2, flatMapUint32TO);
+
+			if(i == 1)
+				Benchmark::AddResult("flat_hash_map<uint32_t, TestObject>/clear", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNotes);
+
+			TestClear(stopwatch1, hashMapStrUint32);
+			TestClear(stopwatch2, flatMapStrUint32);
+
+			if(i == 1)
+				Benchmark::AddResult("flat_hash_map<string, uint32_t>/clear", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNotes);
+		}
+	}
+
+	{
+		EASTLTest_Printf("HashMap power_of_two_hash\n");
+
+		EA::UnitTest::Rand  rng(EA::UnitTest::GetRandSeed());
+		EA::StdC::Stopwatch stopwatch1(EA::StdC::Stopwatch::kUnitsCPUCycles);
+		EA::StdC::Stopwatch stopwatch2(EA::StdC::Stopwatch::kUnitsCPUCycles);
+		const char* const   pNotes = "prime vs power of two buckets";
+
+		eastl::vector< eastl::pair<uint32_t, TestObject> > eaVectorUT(10000);
+
+		for(eastl_size_t i = 0, iEnd = eaVectorUT.size(); i < iEnd; i++)
+			eaVectorUT[i] = eastl::pair<uint32_t, TestObject>(rng.RandValue(), TestObject((int)i));
+
+		for(int i = 0; i < 2; i++)
+		{
+			EaHashMapUint32TO hashMapUint32TO;
+			EaPow2MapUint32TO pow2MapUint32TO;
+
+			///////////////////////////////
+			// Test insert(const value_type&)
+			///////////////////////////////
+
+			TestInsert(stopwatch1, hashMapUint32TO, eaVectorUT.data(), eaVectorUT.data() + eaVectorUT.size());
+			TestInsert(stopwatch2, pow2MapUint32TO, eaVectorUT.data(), eaVectorUT.data() + eaVectorUT.size());
+
+			if(i == 1)
+				Benchmark::AddResult("hash_map<uint32_t, TestObject, power_of_two_hash>/insert", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNotes);
+
+
+			///////////////////////////////
+			// Test find
+			///////////////////////////////
+
+			TestFind(stopwatch1, hashMapUint32TO, eaVectorUT.data(), eaVectorUT.data() + eaVectorUT.size());
+			TestFind(stopwatch2, pow2MapUint32TO, eaVectorUT.data(), eaVectorUT.data() + eaVectorUT.size());
+
+			if(i == 1)
+				Benchmark::AddResult("hash_map<uint32_t, TestObject, power_of_two_hash>/find", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNotes);
+
+
+			///////////////////////////////
+			// Test count
+			///////////////////////////////
+
+			TestCount(stopwatch1, hashMapUint32TO, eaVectorUT.data(), eaVectorUT.data() + eaVectorUT.size());
+			TestCount(stopwatch2, pow2MapUint32TO, eaVectorUT.data(), eaVectorUT.data() + eaVectorUT.size());
+
+			if(i == 1)
+				Benchmark::AddResult("hash_map<uint32_t, TestObject, power_of_two_hash>/count", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNotes);
+
+
+			///////////////////////////////
+			// Test erase(const key_type& key)
+			///////////////////////////////
+
+			TestEraseValue(stopwatch1, hashMapUint32TO, eaVectorUT.data(), eaVectorUT.data() + (eaVectorUT.size() / 2));
+			TestEraseValue(stopwatch2, pow2MapUint32TO, eaVectorUT.data(), eaVectorUT.data() + (eaVectorUT.size() / 2));
+
+			if(i == 1)
+				Benchmark::AddResult("hash_map<uint32_t, TestObject, power_of_two_hash>/erase val", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNotes);
+		}
+	}
+
+	{
+		EASTLTest_Printf("HashMap find_batch\n");
+
+		EA::StdC::Stopwatch stopwatch1(EA::StdC::Stopwatch::kUnitsCPUCycles);
+		EA::StdC::Stopwatch stopwatch2(EA::StdC::Stopwatch::kUnitsCPUCycles);
+		const char* const   pNotes = "find loop vs find_batch";
+
+		// 4M nodes of 24 bytes plus the bucket array are about 150 MB, which is bigger than
+		// the last level cache of the machines we run on, so most lookups miss the cache.
+		typedef eastl::hash_map<uint32_t, uint64_t> EaMapUint32Uint64;
+
+		const eastl_size_t          kElementCount = 1 << 22;
+		const eastl_size_t          kLookupCount  = 1 << 18;
+		EaMapUint32Uint64           hashMap(kElementCount);
+		eastl::vector<uint32_t>     keyArray(kLookupCount);
+		eastl::vector<EaMapUint32Uint64::iterator> resultArray(kLookupCount);
+
+		// Multiplying by an odd constant is a bijection on uint32_t, so the keys are distinct yet scattered.
+		for(eastl_size_t i = 0; i < kElementCount; i++)
+			hashMap[(uint32_t)(i * 2654435761u)] = i;
+
+		// Half of the lookups hit, the other half miss. The indexes are scattered over the whole
+		// table the same way, as EA::UnitTest::Rand repeats itself too soon to defeat the cache.
+		for(eastl_size_t i = 0; i < kLookupCount; i++)
+		{
+			const eastl_size_t j = (eastl_size_t)((uint32_t)(i * 40503u) & (kElementCount - 1));
+			keyArray[i] = (uint32_t)(((i & 1) ? (j + kElementCount) : j) * 2654435761u);
+		}
+
+		for(int i = 0; i < 2; i++)
+		{
+			TestFindLoop (stopwatch1, hashMap, keyArray.data(), keyArray.data() + keyArray.size(), resultArray.data());
+			TestFindBatch(stopwatch2, hashMap, keyArray.data(), keyArray.data() + keyArray.size(), resultArray.data());
+
+			if(i == 1)
+				Benchmark::AddResult("hash_map<uint32_t, uint64_t>/find_batch/4M", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNotes);
+		}
+	}
+
+	{
+		EASTLTest_Printf("HashMap incremental rehash\n");
+
+		EA::StdC::Stopwatch stopwatch1(EA::StdC::Stopwatch::kUnitsCPUCycles);
+		EA::StdC::Stopwatch stopwatch2(EA::StdC::Stopwatch::kUnitsCPUCycles);
+		const char* const   pNotes = "DoRehash vs incremental_rehash_hash";
+
+		typedef eastl::hash_map<uint32_t, uint64_t>                                         EaMapUint32Uint64;
+		typedef eastl::hash_map<uint32_t, uint64_t, eastl::incremental_rehash_hash<uint32_t> > EaIncMapUint32Uint64;
+
+		const eastl_size_t kElementCount = 1 << 22;
+
+		for(int i = 0; i < 2; i++)
+		{
+			EaMapUint32Uint64    hashMap;
+			EaIncMapUint32Uint64 incHashMap;
+
+			const uint64_t nMaxCycles1 = TestInsertLatency(stopwatch1, hashMap,    kElementCount);
+			const uint64_t nMaxCycles2 = TestInsertLatency(stopwatch2, incHashMap, kElementCount);
+
+			if(i == 1)
+			{
+				// The total shows what the bounded worst case costs overall.
+				Benchmark::AddResult("hash_map<uint32_t, uint64_t>/insert max latency/4M", stopwatch1.GetUnits(), (int64_t)nMaxCycles1, (int64_t)nMaxCycles2, pNotes);
+				Benchmark::AddResult("hash_map<uint32_t, uint64_t>/insert total/4M", stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNotes);
+			}
+		}
+	}
+
+	{
+		EASTLTest_Printf("HashString\n");
+
+		EA::UnitTest::Rand  rng(EA::UnitTest::GetRandSeed());
+		EA::StdC::Stopwatch stopwatch1(EA::StdC::Stopwatch::kUnitsCPUCycles);
+		EA::StdC::Stopwatch stopwatch2(EA::StdC::Stopwatch::kUnitsCPUCycles);
+		const char* const   pNotes = "FNV-1 vs hash<string>";
+
+		const eastl_size_t kLengths[] = { 8, 32, 64, 128, 256 };
+
+		for(eastl_size_t l = 0; l < EAArrayCount(kLengths); l++)
+		{
+			// Strings of kLengths[l] chars sharing a common prefix, like paths or URLs.
+			eastl::vector< eastl::pair<eastl::string, uint32_t> > strings(10000);
+
+			for(eastl_size_t i = 0, iEnd = strings.size(); i < iEnd; i++)
+			{
+				strings[i].first.assign("/data/assets/", eastl::min_alt(kLengths[l], (eastl_size_t)13));
+				while(strings[i].first.size() < kLengths[l])
+					strings[i].first.push_back((char)('a' + rng.RandLimit(26)));
+				strings[i].second = (uint32_t)i;
+			}
+
+			EaHashMapStrUint32                        fnvMap(strings.begin(), strings.end());
+			eastl::hash_map<eastl::string, uint32_t>  eaMap(strings.begin(), strings.end());
+
+			for(int i = 0; i < 2; i++)
+			{
+				char name[64];
+
+				///////////////////////////////
+				// Test hash(const string&)
+				///////////////////////////////
+
+				TestHashString(stopwatch1, HashString8<eastl::string>(), strings);
+				TestHashString(stopwatch2, eastl::hash<eastl::string>(), strings);
+
+				if(i == 1)
+				{
+					sprintf(name, "hash<string>/len %u", (unsigned)kLengths[l]);
+					Benchmark::AddResult(name, stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNotes);
+				}
+
+
+				///////////////////////////////
+				// Test hash_map<string, uint32_t>::find
+				///////////////////////////////
+
+				TestFind(stopwatch1, fnvMap, strings.data(), strings.data() + strings.size());
+				TestFind(stopwatch2, eaMap,  strings.data(), strings.data() + strings.size());
+
+				if(i == 1)
+				{
+					sprintf(name, "hash_map<string, uint32_t>/find/len %u", (unsigned)kLengths[l]);
+					Benchmark::AddResult(name, stopwatch1.GetUnits(), stopwatch1.GetElapsedTime(), stopwatch2.GetElapsedTime(), pNotes);
+				}
+			}
+		}
+	}
 }
 
 
@@ -61,7 +61,7 @@ namespace eastl
 	///     Key                    The key type for the map. This is a map of Key to T (value).
 	///     T                      The value type for the map.
 	///     nodeCount              The max number of objects to contain. This value must be >= 1.
-	///     bucketCount            The number of buckets to use. This value must be >= 2.
+	///     bucketCount            The number of buckets to use. This value must be >= 2. It is rounded down to a prime, or to a power of two with power_of_two_hash.
 	///     bEnableOverflow        Whether or not we should use the global heap if our object pool is exhausted.
 	///     Hash                   hash_set hash function. See hash_set.
 	///     Predicate              hash_set equality testing function. See hash_set.
@@ -157,7 +157,7 @@ namespace eastl
 	///     Key                    The key type for the map. This is a map of Key to T (value).
 	///     T                      The value type for the map.
 	///     nodeCount              The max number of objects to contain. This value must be >= 1.
-	///     bucketCount            The number of buckets to use. This value must be >= 2.
+	///     bucketCount            The number of buckets to use. This value must be >= 2. It is rounded down to a prime, or to a power of two with power_of_two_hash.
 	///     bEnableOverflow        Whether or not we should use the global heap if our object pool is exhausted.
 	///     Hash                   hash_set hash function. See hash_set.
 	///     Predicate              hash_set equality testing function. See hash_set.
@@ -252,7 +252,7 @@ namespace eastl
 	template <typename Key, typename T, size_t nodeCount, size_t bucketCount, bool bEnableOverflow, typename Hash, typename Predicate, bool bCacheHashCode, typename OverflowAllocator>
 	inline fixed_hash_map<Key, T, nodeCount, bucketCount, bEnableOverflow, Hash, Predicate, bCacheHashCode, OverflowAllocator>::
 	fixed_hash_map(const overflow_allocator_type& overflowAllocator)
-		: base_type(prime_rehash_policy::GetPrevBucketCountOnly(bucketCount), Hash(), 
+		: base_type(base_type::rehash_policy_type::GetPrevBucketCountOnly(bucketCount), Hash(), 
 					Predicate(), fixed_allocator_type(NULL, mBucketBuffer, overflowAllocator))
 	{
 		EASTL_CT_ASSERT((nodeCount >= 1) && (bucketCount >= 2));
@@ -272,7 +272,7 @@ namespace eastl
 	inline fixed_hash_map<Key, T, nodeCount, bucketCount, bEnableOverflow, Hash, Predicate, bCacheHashCode, OverflowAllocator>::
 	fixed_hash_map(const Hash& hashFunction, 
 				   const Predicate& predicate)
-		: base_type(prime_rehash_policy::GetPrevBucketCountOnly(bucketCount), hashFunction, 
+		: base_type(base_type::rehash_policy_type::GetPrevBucketCountOnly(bucketCount), hashFunction, 
 					predicate, fixed_allocator_type(NULL, mBucketBuffer))
 	{
 		EASTL_CT_ASSERT((nodeCount >= 1) && (bucketCount >= 2));
@@ -293,7 +293,7 @@ namespace eastl
 	fixed_hash_map(const Hash& hashFunction, 
 				   const Predicate& predicate,
 				   const overflow_allocator_type& overflowAllocator)
-		: base_type(prime_rehash_policy::GetPrevBucketCountOnly(bucketCount), hashFunction, 
+		: base_type(base_type::rehash_policy_type::GetPrevBucketCountOnly(bucketCount), hashFunction, 
 					predicate, fixed_allocator_type(NULL, mBucketBuffer, overflowAllocator))
 	{
 		EASTL_CT_ASSERT((nodeCount >= 1) && (bucketCount >= 2));
@@ -315,7 +315,7 @@ namespace eastl
 	fixed_hash_map(InputIterator first, InputIterator last, 
 					const Hash& hashFunction, 
 					const Predicate& predicate)
-		: base_type(prime_rehash_policy::GetPrevBucketCountOnly(bucketCount), hashFunction, 
+		: base_type(base_type::rehash_policy_type::GetPrevBucketCountOnly(bucketCount), hashFunction, 
 					predicate, fixed_allocator_type(NULL, mBucketBuffer))
 	{
 		EASTL_CT_ASSERT((nodeCount >= 1) && (bucketCount >= 2));
@@ -335,7 +335,7 @@ namespace eastl
 	template <typename Key, typename T, size_t nodeCount, size_t bucketCount, bool bEnableOverflow, typename Hash, typename Predicate, bool bCacheHashCode, typename OverflowAllocator>
 	inline fixed_hash_map<Key, T, nodeCount, bucketCount, bEnableOverflow, Hash, Predicate, bCacheHashCode, OverflowAllocator>::
 	fixed_hash_map(const this_type& x)
-		: base_type(prime_rehash_policy::GetPrevBucketCountOnly(bucketCount), x.hash_function(), 
+		: base_type(base_type::rehash_policy_type::GetPrevBucketCountOnly(bucketCount), x.hash_function(), 
 					x.equal_function(), fixed_allocator_type(NULL, mBucketBuffer))
 	{
 		mAllocator.copy_overflow_allocator(x.mAllocator);
@@ -358,7 +358,7 @@ namespace eastl
 		template <typename Key, typename T, size_t nodeCount, size_t bucketCount, bool bEnableOverflow, typename Hash, typename Predicate, bool bCacheHashCode, typename OverflowAllocator>
 		inline fixed_hash_map<Key, T, nodeCount, bucketCount, bEnableOverflow, Hash, Predicate, bCacheHashCode, OverflowAllocator>::
 		fixed_hash_map(this_type&& x)
-			: base_type(prime_rehash_policy::GetPrevBucketCountOnly(bucketCount), x.hash_function(), 
+			: base_type(base_type::rehash_policy_type::GetPrevBucketCountOnly(bucketCount), x.hash_function(), 
 						x.equal_function(), fixed_allocator_type(NULL, mBucketBuffer))
 		{
 			// This implementation is the same as above. If we could rely on using C++11 delegating constructor support then we could just call that here.
@@ -381,7 +381,7 @@ namespace eastl
 		template <typename Key, typename T, size_t nodeCount, size_t bucketCount, bool bEnableOverflow, typename Hash, typename Predicate, bool bCacheHashCode, typename OverflowAllocator>
 		inline fixed_hash_map<Key, T, nodeCount, bucketCount, bEnableOverflow, Hash, Predicate, bCacheHashCode, OverflowAllocator>::
 		fixed_hash_map(this_type&& x, const overflow_allocator_type& overflowAllocator)
-			: base_type(prime_rehash_policy::GetPrevBucketCountOnly(bucketCount), x.hash_function(), 
+			: base_type(base_type::rehash_policy_type::GetPrevBucketCountOnly(bucketCount), x.hash_function(), 
 						x.equal_function(), fixed_allocator_type(NULL, mBucketBuffer, overflowAllocator))
 		{
 			// This implementation is the same as above. If we could rely on using C++11 delegating constructor support then we could just call that here.
@@ -405,7 +405,7 @@ namespace eastl
 	template <typename Key, typename T, size_t nodeCount, size_t bucketCount, bool bEnableOverflow, typename Hash, typename Predicate, bool bCacheHashCode, typename OverflowAllocator>
 	inline fixed_hash_map<Key, T, nodeCount, bucketCount, bEnableOverflow, Hash, Predicate, bCacheHashCode, OverflowAllocator>::
 	fixed_hash_map(std::initializer_list<value_type> ilist, const overflow_allocator_type& overflowAllocator)
-		: base_type(prime_rehash_policy::GetPrevBucketCountOnly(bucketCount), Hash(), 
+		: base_type(base_type::rehash_policy_type::GetPrevBucketCountOnly(bucketCount), Hash(), 
 					Predicate(), fixed_allocator_type(NULL, mBucketBuffer, overflowAllocator))
 	{
 		EASTL_CT_ASSERT((nodeCount >= 1) && (bucketCount >= 2));
@@ -535,7 +535,7 @@ namespace eastl
 	template <typename Key, typename T, size_t nodeCount, size_t bucketCount, bool bEnableOverflow, typename Hash, typename Predicate, bool bCacheHashCode, typename OverflowAllocator>
 	inline fixed_hash_multimap<Key, T, nodeCount, bucketCount, bEnableOverflow, Hash, Predicate, bCacheHashCode, OverflowAllocator>::
 	fixed_hash_multimap(const overflow_allocator_type& overflowAllocator)
-		: base_type(prime_rehash_policy::GetPrevBucketCountOnly(bucketCount), Hash(), 
+		: base_type(base_type::rehash_policy_type::GetPrevBucketCountOnly(bucketCount), Hash(), 
 					Predicate(), fixed_allocator_type(NULL, mBucketBuffer, overflowAllocator))
 	{
 		EASTL_CT_ASSERT((nodeCount >= 1) && (bucketCount >= 2));
@@ -555,7 +555,7 @@ namespace eastl
 	inline fixed_hash_multimap<Key, T, nodeCount, bucketCount, bEnableOverflow, Hash, Predicate, bCacheHashCode, OverflowAllocator>::
 	fixed_hash_multimap(const Hash& hashFunction, 
 						const Predicate& predicate)
-		: base_type(prime_rehash_policy::GetPrevBucketCountOnly(bucketCount), hashFunction, 
+		: base_type(base_type::rehash_policy_type::GetPrevBucketCountOnly(bucketCount), hashFunction, 
 					predicate, fixed_allocator_type(NULL, mBucketBuffer))
 	{
 		EASTL_CT_ASSERT((nodeCount >= 1) && (bucketCount >= 2));
@@ -576,7 +576,7 @@ namespace eastl
 	fixed_hash_multimap(const Hash& hashFunction,
 						const Predicate& predicate,
 						const overflow_allocator_type& overflowAllocator)
-		: base_type(prime_rehash_policy::GetPrevBucketCountOnly(bucketCount), hashFunction, 
+		: base_type(base_type::rehash_policy_type::GetPrevBucketCountOnly(bucketCount), hashFunction, 
 					predicate, fixed_allocator_type(NULL, mBucketBuffer, overflowAllocator))
 	{
 		EASTL_CT_ASSERT((nodeCount >= 1) && (bucketCount >= 2));
@@ -598,7 +598,7 @@ namespace eastl
 	fixed_hash_multimap(InputIterator first, InputIterator last, 
 						const Hash& hashFunction, 
 						const Predicate& predicate)
-		: base_type(prime_rehash_policy::GetPrevBucketCountOnly(bucketCount), hashFunction, 
+		: base_type(base_type::rehash_policy_type::GetPrevBucketCountOnly(bucketCount), hashFunction, 
 					predicate, fixed_allocator_type(NULL, mBucketBuffer))
 	{
 		EASTL_CT_ASSERT((nodeCount >= 1) && (bucketCount >= 2));
@@ -618,7 +618,7 @@ namespace eastl
 	template <typename Key, typename T, size_t nodeCount, size_t bucketCount, bool bEnableOverflow, typename Hash, typename Predicate, bool bCacheHashCode, typename OverflowAllocator>
 	inline fixed_hash_multimap<Key, T, nodeCount, bucketCount, bEnableOverflow, Hash, Predicate, bCacheHashCode, OverflowAllocator>::
 	fixed_hash_multimap(const this_type& x)
-		: base_type(prime_rehash_policy::GetPrevBucketCountOnly(bucketCount), x.hash_function(), 
+		: base_type(base_type::rehash_policy_type::GetPrevBucketCountOnly(bucketCount), x.hash_function(), 
 					x.equal_function(),fixed_allocator_type(NULL, mBucketBuffer))
 	{
 		mAllocator.copy_overflow_allocator(x.mAllocator);
@@ -641,7 +641,7 @@ namespace eastl
 		template <typename Key, typename T, size_t nodeCount, size_t bucketCount, bool bEnableOverflow, typename Hash, typename Predicate, bool bCacheHashCode, typename OverflowAllocator>
 		inline fixed_hash_multimap<Key, T, nodeCount, bucketCount, bEnableOverflow, Hash, Predicate, bCacheHashCode, OverflowAllocator>::
 		fixed_hash_multimap(this_type&& x)
-			: base_type(prime_rehash_policy::GetPrevBucketCountOnly(bucketCount), x.hash_function(), 
+			: base_type(base_type::rehash_policy_type::GetPrevBucketCountOnly(bucketCount), x.hash_function(), 
 						x.equal_function(),fixed_allocator_type(NULL, mBucketBuffer))
 		{
 			// This implementation is the same as above. If we could rely on using C++11 delegating constructor support then we could just call that here.
@@ -664,7 +664,7 @@ namespace eastl
 		template <typename Key, typename T, size_t nodeCount, size_t bucketCount, bool bEnableOverflow, typename Hash, typename Predicate, bool bCacheHashCode, typename OverflowAllocator>
 		inline fixed_hash_multimap<Key, T, nodeCount, bucketCount, bEnableOverflow, Hash, Predicate, bCacheHashCode, OverflowAllocator>::
 		fixed_hash_multimap(this_type&& x, const overflow_allocator_type& overflowAllocator)
-			: base_type(prime_rehash_policy::GetPrevBucketCountOnly(bucketCount), x.hash_function(), 
+			: base_type(base_type::rehash_policy_type::GetPrevBucketCountOnly(bucketCount), x.hash_function(), 
 						x.equal_function(), fixed_allocator_type(NULL, mBucketBuffer, overflowAllocator))
 		{
 			// This implementation is the same as above. If we could rely on using C++11 delegating constructor support then we could just call that here.
@@ -688,7 +688,7 @@ namespace eastl
 	template <typename Key, typename T, size_t nodeCount, size_t bucketCount, bool bEnableOverflow, typename Hash, typename Predicate, bool bCacheHashCode, typename OverflowAllocator>
 	inline fixed_hash_multimap<Key, T, nodeCount, bucketCount, bEnableOverflow, Hash, Predicate, bCacheHashCode, OverflowAllocator>::
 	fixed_hash_multimap(std::initializer_list<value_type> ilist, const overflow_allocator_type& overflowAllocator)
-		: base_type(prime_rehash_policy::GetPrevBucketCountOnly(bucketCount), Hash(), 
+		: base_type(base_type::rehash_policy_type::GetPrevBucketCountOnly(bucketCount), Hash(), 
 					Predicate(), fixed_allocator_type(NULL, mBucketBuffer, overflowAllocator))
 	{
 		EASTL_CT_ASSERT((nodeCount >= 1) && (bucketCount >= 2));
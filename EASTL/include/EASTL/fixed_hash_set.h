@@ -61,7 +61,7 @@ namespace eastl
 	/// Template parameters:
 	///     Value                  The type of object the hash_set holds.
 	///     nodeCount              The max number of objects to contain. This value must be >= 1.
-	///     bucketCount            The number of buckets to use. This value must be >= 2.
+	///     bucketCount            The number of buckets to use. This value must be >= 2. It is rounded down to a prime, or to a power of two with power_of_two_hash.
 	///     bEnableOverflow        Whether or not we should use the global heap if our object pool is exhausted.
 	///     Hash                   hash_set hash function. See hash_set.
 	///     Predicate              hash_set equality testing function. See hash_set.
@@ -156,7 +156,7 @@ namespace eastl
 	///
 	///     Value                  The type of object the hash_set holds.
 	///     nodeCount              The max number of objects to contain. This value must be >= 1.
-	///     bucketCount            The number of buckets to use. This value must be >= 2.
+	///     bucketCount            The number of buckets to use. This value must be >= 2. It is rounded down to a prime, or to a power of two with power_of_two_hash.
 	///     bEnableOverflow        Whether or not we should use the global heap if our object pool is exhausted.
 	///     Hash                   hash_set hash function. See hash_set.
 	///     Predicate              hash_set equality testing function. See hash_set.
@@ -249,7 +249,7 @@ namespace eastl
 	template <typename Value, size_t nodeCount, size_t bucketCount, bool bEnableOverflow, typename Hash, typename Predicate, bool bCacheHashCode, typename OverflowAllocator>
 	inline fixed_hash_set<Value, nodeCount, bucketCount, bEnableOverflow, Hash, Predicate, bCacheHashCode, OverflowAllocator>::
 	fixed_hash_set(const overflow_allocator_type& overflowAllocator)
-		: base_type(prime_rehash_policy::GetPrevBucketCountOnly(bucketCount), 
+		: base_type(base_type::rehash_policy_type::GetPrevBucketCountOnly(bucketCount), 
 					Hash(), Predicate(), fixed_allocator_type(NULL, mBucketBuffer, overflowAllocator))
 	{
 		EASTL_CT_ASSERT((nodeCount >= 1) && (bucketCount >= 2));
@@ -269,7 +269,7 @@ namespace eastl
 	inline fixed_hash_set<Value, nodeCount, bucketCount, bEnableOverflow, Hash, Predicate, bCacheHashCode, OverflowAllocator>::
 	fixed_hash_set(const Hash& hashFunction, 
 				   const Predicate& predicate)
-		: base_type(prime_rehash_policy::GetPrevBucketCountOnly(bucketCount), 
+		: base_type(base_type::rehash_policy_type::GetPrevBucketCountOnly(bucketCount), 
 					hashFunction, predicate, fixed_allocator_type(NULL, mBucketBuffer))
 	{
 		EASTL_CT_ASSERT((nodeCount >= 1) && (bucketCount >= 2));
@@ -290,7 +290,7 @@ namespace eastl
 	fixed_hash_set(const Hash& hashFunction, 
 				   const Predicate& predicate,
 				   const overflow_allocator_type& overflowAllocator)
-		: base_type(prime_rehash_policy::GetPrevBucketCountOnly(bucketCount), 
+		: base_type(base_type::rehash_policy_type::GetPrevBucketCountOnly(bucketCount), 
 					hashFunction, predicate, fixed_allocator_type(NULL, mBucketBuffer, overflowAllocator))
 	{
 		EASTL_CT_ASSERT((nodeCount >= 1) && (bucketCount >= 2));
@@ -312,7 +312,7 @@ namespace eastl
 	fixed_hash_set(InputIterator first, InputIterator last,
 				   const Hash& hashFunction,
 				   const Predicate& predicate)
-		: base_type(prime_rehash_policy::GetPrevBucketCountOnly(bucketCount), hashFunction, 
+		: base_type(base_type::rehash_policy_type::GetPrevBucketCountOnly(bucketCount), hashFunction, 
 					predicate, fixed_allocator_type(NULL, mBucketBuffer))
 	{
 		EASTL_CT_ASSERT((nodeCount >= 1) && (bucketCount >= 2));
@@ -332,7 +332,7 @@ namespace eastl
 	template <typename Value, size_t nodeCount, size_t bucketCount, bool bEnableOverflow, typename Hash, typename Predicate, bool bCacheHashCode, typename OverflowAllocator>
 	inline fixed_hash_set<Value, nodeCount, bucketCount, bEnableOverflow, Hash, Predicate, bCacheHashCode, OverflowAllocator>::
 	fixed_hash_set(const this_type& x)
-		: base_type(prime_rehash_policy::GetPrevBucketCountOnly(bucketCount), x.hash_function(),
+		: base_type(base_type::rehash_policy_type::GetPrevBucketCountOnly(bucketCount), x.hash_function(),
 					x.equal_function(), fixed_allocator_type(NULL, mBucketBuffer))
 	{
 		mAllocator.copy_overflow_allocator(x.mAllocator);
@@ -354,7 +354,7 @@ namespace eastl
 	#if EASTL_MOVE_SEMANTICS_ENABLED
 		template <typename Key, size_t nodeCount, size_t bucketCount, bool bEnableOverflow, typename Hash, typename Predicate, bool bCacheHashCode, typename OverflowAllocator>
 		inline fixed_hash_set<Key, nodeCount, bucketCount, bEnableOverflow, Hash, Predicate, bCacheHashCode, OverflowAllocator>::fixed_hash_set(this_type&& x)
-		: base_type(prime_rehash_policy::GetPrevBucketCountOnly(bucketCount), x.hash_function(),
+		: base_type(base_type::rehash_policy_type::GetPrevBucketCountOnly(bucketCount), x.hash_function(),
 						x.equal_function(), fixed_allocator_type(NULL, mBucketBuffer))
 		{
 			// This implementation is the same as above. If we could rely on using C++11 delegating constructor support then we could just call that here.
@@ -376,7 +376,7 @@ namespace eastl
 
 		template <typename Key, size_t nodeCount, size_t bucketCount, bool bEnableOverflow, typename Hash, typename Predicate, bool bCacheHashCode, typename OverflowAllocator>
 		inline fixed_hash_set<Key, nodeCount, bucketCount, bEnableOverflow, Hash, Predicate, bCacheHashCode, OverflowAllocator>::fixed_hash_set(this_type&& x, const overflow_allocator_type& overflowAllocator)
-			: base_type(prime_rehash_policy::GetPrevBucketCountOnly(bucketCount), 
+			: base_type(base_type::rehash_policy_type::GetPrevBucketCountOnly(bucketCount), 
 						x.hash_function(), x.equal_function(), fixed_allocator_type(NULL, mBucketBuffer, overflowAllocator))
 		{
 			// This implementation is the same as above. If we could rely on using C++11 delegating constructor support then we could just call that here.
@@ -400,7 +400,7 @@ namespace eastl
 	template <typename Key, size_t nodeCount, size_t bucketCount, bool bEnableOverflow, typename Hash, typename Predicate, bool bCacheHashCode, typename OverflowAllocator>
 	inline fixed_hash_set<Key, nodeCount, bucketCount, bEnableOverflow, Hash, Predicate, bCacheHashCode, OverflowAllocator>::
 	fixed_hash_set(std::initializer_list<value_type> ilist, const overflow_allocator_type& overflowAllocator)
-		: base_type(prime_rehash_policy::GetPrevBucketCountOnly(bucketCount), Hash(), 
+		: base_type(base_type::rehash_policy_type::GetPrevBucketCountOnly(bucketCount), Hash(), 
 					Predicate(), fixed_allocator_type(NULL, mBucketBuffer, overflowAllocator))
 	{
 		EASTL_CT_ASSERT((nodeCount >= 1) && (bucketCount >= 2));
@@ -537,7 +537,7 @@ namespace eastl
 	template <typename Value, size_t nodeCount, size_t bucketCount, bool bEnableOverflow, typename Hash, typename Predicate, bool bCacheHashCode, typename OverflowAllocator>
 	inline fixed_hash_multiset<Value, nodeCount, bucketCount, bEnableOverflow, Hash, Predicate, bCacheHashCode, OverflowAllocator>::
 	fixed_hash_multiset(const overflow_allocator_type& overflowAllocator)
-		: base_type(prime_rehash_policy::GetPrevBucketCountOnly(bucketCount), Hash(), 
+		: base_type(base_type::rehash_policy_type::GetPrevBucketCountOnly(bucketCount), Hash(), 
 					Predicate(), fixed_allocator_type(NULL, mBucketBuffer, overflowAllocator))
 	{
 		EASTL_CT_ASSERT((nodeCount >= 1) && (bucketCount >= 2));
@@ -557,7 +557,7 @@ namespace eastl
 	inline fixed_hash_multiset<Value, nodeCount, bucketCount, bEnableOverflow, Hash, Predicate, bCacheHashCode, OverflowAllocator>::
 	fixed_hash_multiset(const Hash& hashFunction, 
 						const Predicate& predicate)
-		: base_type(prime_rehash_policy::GetPrevBucketCountOnly(bucketCount), hashFunction, 
+		: base_type(base_type::rehash_policy_type::GetPrevBucketCountOnly(bucketCount), hashFunction, 
 					predicate, fixed_allocator_type(NULL, mBucketBuffer))
 	{
 		EASTL_CT_ASSERT((nodeCount >= 1) && (bucketCount >= 2));
@@ -578,7 +578,7 @@ namespace eastl
 	fixed_hash_multiset(const Hash& hashFunction, 
 						const Predicate& predicate,
 						const overflow_allocator_type& overflowAllocator)
-		: base_type(prime_rehash_policy::GetPrevBucketCountOnly(bucketCount), hashFunction, 
+		: base_type(base_type::rehash_policy_type::GetPrevBucketCountOnly(bucketCount), hashFunction, 
 					predicate, fixed_allocator_type(NULL, mBucketBuffer, overflowAllocator))
 	{
 		EASTL_CT_ASSERT((nodeCount >= 1) && (bucketCount >= 2));
@@ -600,7 +600,7 @@ namespace eastl
 	fixed_hash_multiset(InputIterator first, InputIterator last, 
 						const Hash& hashFunction, 
 						const Predicate& predicate)
-		: base_type(prime_rehash_policy::GetPrevBucketCountOnly(bucketCount), hashFunction, 
+		: base_type(base_type::rehash_policy_type::GetPrevBucketCountOnly(bucketCount), hashFunction, 
 					predicate, fixed_allocator_type(NULL, mBucketBuffer))
 	{
 		EASTL_CT_ASSERT((nodeCount >= 1) && (bucketCount >= 2));
@@ -620,7 +620,7 @@ namespace eastl
 	template <typename Value, size_t nodeCount, size_t bucketCount, bool bEnableOverflow, typename Hash, typename Predicate, bool bCacheHashCode, typename OverflowAllocator>
 	inline fixed_hash_multiset<Value, nodeCount, bucketCount, bEnableOverflow, Hash, Predicate, bCacheHashCode, OverflowAllocator>::
 	fixed_hash_multiset(const this_type& x)
-		: base_type(prime_rehash_policy::GetPrevBucketCountOnly(bucketCount), x.hash_function(), 
+		: base_type(base_type::rehash_policy_type::GetPrevBucketCountOnly(bucketCount), x.hash_function(), 
 					x.equal_function(), fixed_allocator_type(NULL, mBucketBuffer))
 	{
 		mAllocator.copy_overflow_allocator(x.mAllocator);
@@ -642,7 +642,7 @@ namespace eastl
 	#if EASTL_MOVE_SEMANTICS_ENABLED
 		template <typename Key, size_t nodeCount, size_t bucketCount, bool bEnableOverflow, typename Hash, typename Predicate, bool bCacheHashCode, typename OverflowAllocator>
 		inline fixed_hash_multiset<Key, nodeCount, bucketCount, bEnableOverflow, Hash, Predicate, bCacheHashCode, OverflowAllocator>::fixed_hash_multiset(this_type&& x)
-			: base_type(prime_rehash_policy::GetPrevBucketCountOnly(bucketCount), x.hash_function(),
+			: base_type(base_type::rehash_policy_type::GetPrevBucketCountOnly(bucketCount), x.hash_function(),
 							x.equal_function(), fixed_allocator_type(NULL, mBucketBuffer))
 		{
 			// This implementation is the same as above. If we could rely on using C++11 delegating constructor support then we could just call that here.
@@ -664,7 +664,7 @@ namespace eastl
 
 		template <typename Key, size_t nodeCount, size_t bucketCount, bool bEnableOverflow, typename Hash, typename Predicate, bool bCacheHashCode, typename OverflowAllocator>
 		inline fixed_hash_multiset<Key, nodeCount, bucketCount, bEnableOverflow, Hash, Predicate, bCacheHashCode, OverflowAllocator>::fixed_hash_multiset(this_type&& x, const overflow_allocator_type& overflowAllocator)
-			: base_type(prime_rehash_policy::GetPrevBucketCountOnly(bucketCount), 
+			: base_type(base_type::rehash_policy_type::GetPrevBucketCountOnly(bucketCount), 
 						x.hash_function(), x.equal_function(), fixed_allocator_type(NULL, mBucketBuffer, overflowAllocator))
 		{
 			// This implementation is the same as above. If we could rely on using C++11 delegating constructor support then we could just call that here.
@@ -688,7 +688,7 @@ namespace eastl
 	template <typename Key, size_t nodeCount, size_t bucketCount, bool bEnableOverflow, typename Hash, typename Predicate, bool bCacheHashCode, typename OverflowAllocator>
 	inline fixed_hash_multiset<Key, nodeCount, bucketCount, bEnableOverflow, Hash, Predicate, bCacheHashCode, OverflowAllocator>::
 	fixed_hash_multiset(std::initializer_list<value_type> ilist, const overflow_allocator_type& overflowAllocator)
-		: base_type(prime_rehash_policy::GetPrevBucketCountOnly(bucketCount), Hash(), 
+		: base_type(base_type::rehash_policy_type::GetPrevBucketCountOnly(bucketCount), Hash(), 
 					Predicate(), fixed_allocator_type(NULL, mBucketBuffer, overflowAllocator))
 	{
 		EASTL_CT_ASSERT((nodeCount >= 1) && (bucketCount >= 2));
@@ -801,6 +801,22 @@ namespace eastl
 	}
 
 
+	/// hash<fixed_string>
+	///
+	/// Hashes from the known size, the same as hash<string>, so that a fixed_string
+	/// and a string with the same characters have the same hash.
+	///
+	/// Example usage:
+	///    #include <EASTL/hash_set.h>
+	///    hash_set<fixed_string<char, 64> > stringHashSet;
+	///
+	template <typename T, int nodeCount, bool bEnableOverflow, typename OverflowAllocator>
+	struct hash< fixed_string<T, nodeCount, bEnableOverflow, OverflowAllocator> >
+		: public string_hash< fixed_string<T, nodeCount, bEnableOverflow, OverflowAllocator> >
+	{
+	};
+
+
 } // namespace eastl
 
 
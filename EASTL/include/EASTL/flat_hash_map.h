@@ -0,0 +1,293 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// This file implements flat_hash_map, an open addressing alternative to
+// hash_map which stores its elements inline. See internal/flat_hashtable.h
+// for the details of the table layout.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_FLAT_HASH_MAP_H
+#define EASTL_FLAT_HASH_MAP_H
+
+
+#include <EASTL/internal/config.h>
+#include <EASTL/internal/flat_hashtable.h>
+#include <EASTL/functional.h>
+#include <EASTL/utility.h>
+
+#if defined(EA_PRAGMA_ONCE_SUPPORTED)
+	#pragma once // Some compilers (e.g. VC++) benefit significantly from using this. We've measured 3-4% build speed improvements in apps as a result.
+#endif
+
+
+
+namespace eastl
+{
+
+	/// EASTL_FLAT_HASH_MAP_DEFAULT_NAME
+	///
+	/// Defines a default container name in the absence of a user-provided name.
+	///
+	#ifndef EASTL_FLAT_HASH_MAP_DEFAULT_NAME
+		#define EASTL_FLAT_HASH_MAP_DEFAULT_NAME EASTL_DEFAULT_NAME_PREFIX " flat_hash_map" // Unless the user overrides something, this is "EASTL flat_hash_map".
+	#endif
+
+
+	/// EASTL_FLAT_HASH_MAP_DEFAULT_ALLOCATOR
+	///
+	#ifndef EASTL_FLAT_HASH_MAP_DEFAULT_ALLOCATOR
+		#define EASTL_FLAT_HASH_MAP_DEFAULT_ALLOCATOR allocator_type(EASTL_FLAT_HASH_MAP_DEFAULT_NAME)
+	#endif
+
+
+
+	/// flat_hash_map
+	///
+	/// Implements a flat_hash_map, which is a hashed associative container with
+	/// the same interface as hash_map. Elements are stored inline in a power of
+	/// two sized array instead of in individually allocated nodes, which makes
+	/// lookups cheaper (no modulo, a single cache miss in the common case) at the
+	/// expense of iterator stability: any insertion or erasure invalidates the
+	/// iterators, pointers and references to other elements. The exception is
+	/// erase(iterator), which returns an iterator to the next element and can be
+	/// used to erase elements while iterating.
+	///
+	/// set_max_load_factor
+	/// The max load factor defaults to 0.875 and is clamped to [0.25, 1], as the
+	/// elements are stored in the slot array itself.
+	///
+	/// find_as
+	/// As with hash_map, find_as lets you search with a key of a type other than
+	/// the container key type, as long as its hash equals the hash of the key.
+	///
+	/// Example find_as usage:
+	///     flat_hash_map<string, int> hashMap;
+	///     i = hashMap.find_as("hello");    // Use default hash and compare.
+	///
+	/// Example find_as usage (namespaces omitted for brevity):
+	///     flat_hash_map<string, int> hashMap;
+	///     i = hashMap.find_as("hello", hash<char*>(), equal_to_2<string, char*>());
+	///
+	template <typename Key, typename T, typename Hash = eastl::hash<Key>, typename Predicate = eastl::equal_to<Key>,
+			  typename Allocator = EASTLAllocatorType>
+	class flat_hash_map
+		: public flat_hashtable<Key, eastl::pair<const Key, T>, Allocator, eastl::use_first<eastl::pair<const Key, T> >, Hash, Predicate, true>
+	{
+	public:
+		typedef flat_hashtable<Key, eastl::pair<const Key, T>, Allocator,
+							   eastl::use_first<eastl::pair<const Key, T> >,
+							   Hash, Predicate, true>                         base_type;
+		typedef flat_hash_map<Key, T, Hash, Predicate, Allocator>             this_type;
+		typedef typename base_type::size_type                                 size_type;
+		typedef typename base_type::key_type                                  key_type;
+		typedef T                                                             mapped_type;
+		typedef typename base_type::value_type                                value_type;     // Note that this is pair<const key_type, mapped_type>.
+		typedef typename base_type::allocator_type                            allocator_type;
+		typedef typename base_type::insert_return_type                        insert_return_type;
+		typedef typename base_type::iterator                                  iterator;
+		typedef typename base_type::const_iterator                            const_iterator;
+
+		using base_type::insert;
+
+	public:
+		/// flat_hash_map
+		///
+		/// Default constructor. Doesn't allocate memory.
+		///
+		explicit flat_hash_map(const allocator_type& allocator = EASTL_FLAT_HASH_MAP_DEFAULT_ALLOCATOR)
+			: base_type(0, Hash(), Predicate(), allocator)
+		{
+			// Empty
+		}
+
+
+		/// flat_hash_map
+		///
+		/// Constructor which creates an empty container, but start with nBucketCount buckets
+		/// (rounded up to a power of two).
+		///
+		explicit flat_hash_map(size_type nBucketCount, const Hash& hashFunction = Hash(),
+							   const Predicate& predicate = Predicate(), const allocator_type& allocator = EASTL_FLAT_HASH_MAP_DEFAULT_ALLOCATOR)
+			: base_type(nBucketCount, hashFunction, predicate, allocator)
+		{
+			// Empty
+		}
+
+
+		flat_hash_map(const this_type& x)
+		  : base_type(x)
+		{
+		}
+
+
+		flat_hash_map(this_type&& x)
+		  : base_type(eastl::move(x))
+		{
+		}
+
+
+		flat_hash_map(this_type&& x, const allocator_type& allocator)
+		  : base_type(eastl::move(x), allocator)
+		{
+		}
+
+
+		/// flat_hash_map
+		///
+		/// initializer_list-based constructor.
+		/// Allows for initializing with brace values (e.g. flat_hash_map<int, char*> hm = { {3,"c"}, {4,"d"}, {5,"e"} }; )
+		///
+		flat_hash_map(std::initializer_list<value_type> ilist, size_type nBucketCount = 0, const Hash& hashFunction = Hash(),
+					  const Predicate& predicate = Predicate(), const allocator_type& allocator = EASTL_FLAT_HASH_MAP_DEFAULT_ALLOCATOR)
+			: base_type(ilist.begin(), ilist.end(), nBucketCount, hashFunction, predicate, allocator)
+		{
+			// Empty
+		}
+
+
+		/// flat_hash_map
+		///
+		/// An input bucket count of <= 1 causes the container to be sized for the
+		/// number of elements in the input range.
+		///
+		template <typename ForwardIterator>
+		flat_hash_map(ForwardIterator first, ForwardIterator last, size_type nBucketCount = 0, const Hash& hashFunction = Hash(),
+					  const Predicate& predicate = Predicate(), const allocator_type& allocator = EASTL_FLAT_HASH_MAP_DEFAULT_ALLOCATOR)
+			: base_type(first, last, nBucketCount, hashFunction, predicate, allocator)
+		{
+			// Empty
+		}
+
+
+		this_type& operator=(const this_type& x)
+		{
+			return static_cast<this_type&>(base_type::operator=(x));
+		}
+
+
+		this_type& operator=(std::initializer_list<value_type> ilist)
+		{
+			return static_cast<this_type&>(base_type::operator=(ilist));
+		}
+
+
+		this_type& operator=(this_type&& x)
+		{
+			return static_cast<this_type&>(base_type::operator=(eastl::move(x)));
+		}
+
+
+		/// insert
+		///
+		/// This is an extension to the C++ standard. We insert a default-constructed
+		/// element with the given key. The reason for this is that we can avoid the
+		/// potentially expensive operation of creating and/or copying a mapped_type
+		/// object on the stack.
+		insert_return_type insert(const key_type& key)
+		{
+			return base_type::DoInsertKey(key);
+		}
+
+
+		insert_return_type insert(key_type&& key)
+		{
+			return base_type::DoInsertKey(eastl::move(key));
+		}
+
+
+		T& at(const key_type& k)
+		{
+			iterator it = base_type::find(k);
+
+			if (it == base_type::end())
+			{
+				#if EASTL_EXCEPTIONS_ENABLED
+					// throw exeption if exceptions enabled
+					throw std::out_of_range("invalid flat_hash_map<K, T> key");
+				#else
+					// assert false if asserts enabled
+					EASTL_ASSERT_MSG(false, "invalid flat_hash_map<K, T> key");
+				#endif
+			}
+			// undefined behaviour if exceptions and asserts are disabled and it == end()
+			return it->second;
+		}
+
+
+		const T& at(const key_type& k) const
+		{
+			const_iterator it = base_type::find(k);
+
+			if (it == base_type::end())
+			{
+				#if EASTL_EXCEPTIONS_ENABLED
+					// throw exeption if exceptions enabled
+					throw std::out_of_range("invalid flat_hash_map<K, T> key");
+				#else
+					// assert false if asserts enabled
+					EASTL_ASSERT_MSG(false, "invalid flat_hash_map<K, T> key");
+				#endif
+			}
+			// undefined behaviour if exceptions and asserts are disabled and it == end()
+			return it->second;
+		}
+
+
+		mapped_type& operator[](const key_type& key)
+		{
+			return (*base_type::DoInsertKey(key).first).second;
+		}
+
+
+		mapped_type& operator[](key_type&& key)
+		{
+			// The Standard states that this function "inserts the value value_type(std::move(key), mapped_type())"
+			return (*base_type::DoInsertKey(eastl::move(key)).first).second;
+		}
+
+	}; // flat_hash_map
+
+
+
+
+	///////////////////////////////////////////////////////////////////////
+	// global operators
+	///////////////////////////////////////////////////////////////////////
+
+	template <typename Key, typename T, typename Hash, typename Predicate, typename Allocator>
+	inline bool operator==(const flat_hash_map<Key, T, Hash, Predicate, Allocator>& a,
+						   const flat_hash_map<Key, T, Hash, Predicate, Allocator>& b)
+	{
+		typedef typename flat_hash_map<Key, T, Hash, Predicate, Allocator>::const_iterator const_iterator;
+
+		// We implement branching with the assumption that the return value is usually false.
+		if(a.size() != b.size())
+			return false;
+
+		// Keys are unique, so we need only test that each element in a can be found in b.
+		for(const_iterator ai = a.begin(), aiEnd = a.end(), biEnd = b.end(); ai != aiEnd; ++ai)
+		{
+			const_iterator bi = b.find(ai->first);
+
+			if((bi == biEnd) || !(*ai == *bi))  // We have to compare the values, because lookups are done by keys alone but the full value_type of a map is a key/value pair.
+				return false;                   // It's possible that two elements in the two containers have identical keys but different values.
+		}
+
+		return true;
+	}
+
+	template <typename Key, typename T, typename Hash, typename Predicate, typename Allocator>
+	inline bool operator!=(const flat_hash_map<Key, T, Hash, Predicate, Allocator>& a,
+						   const flat_hash_map<Key, T, Hash, Predicate, Allocator>& b)
+	{
+		return !(a == b);
+	}
+
+
+} // namespace eastl
+
+
+#endif // Header include guard
@@ -0,0 +1,209 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// This file implements flat_hash_set, an open addressing alternative to
+// hash_set which stores its elements inline. See internal/flat_hashtable.h
+// for the details of the table layout.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_FLAT_HASH_SET_H
+#define EASTL_FLAT_HASH_SET_H
+
+
+#include <EASTL/internal/config.h>
+#include <EASTL/internal/flat_hashtable.h>
+#include <EASTL/functional.h>
+#include <EASTL/utility.h>
+
+#if defined(EA_PRAGMA_ONCE_SUPPORTED)
+	#pragma once // Some compilers (e.g. VC++) benefit significantly from using this. We've measured 3-4% build speed improvements in apps as a result.
+#endif
+
+
+
+namespace eastl
+{
+
+	/// EASTL_FLAT_HASH_SET_DEFAULT_NAME
+	///
+	/// Defines a default container name in the absence of a user-provided name.
+	///
+	#ifndef EASTL_FLAT_HASH_SET_DEFAULT_NAME
+		#define EASTL_FLAT_HASH_SET_DEFAULT_NAME EASTL_DEFAULT_NAME_PREFIX " flat_hash_set" // Unless the user overrides something, this is "EASTL flat_hash_set".
+	#endif
+
+
+	/// EASTL_FLAT_HASH_SET_DEFAULT_ALLOCATOR
+	///
+	#ifndef EASTL_FLAT_HASH_SET_DEFAULT_ALLOCATOR
+		#define EASTL_FLAT_HASH_SET_DEFAULT_ALLOCATOR allocator_type(EASTL_FLAT_HASH_SET_DEFAULT_NAME)
+	#endif
+
+
+
+	/// flat_hash_set
+	///
+	/// Implements a flat_hash_set, which is a hashed unique-item container with
+	/// the same interface as hash_set, but whose elements are stored inline in a
+	/// power of two sized array. See flat_hash_map for the tradeoffs: faster
+	/// lookups, but insertions and erasures invalidate iterators, pointers and
+	/// references to other elements, except for the iterator returned by erase.
+	///
+	/// find_as
+	/// As with hash_set, find_as lets you search with a key of a type other than
+	/// the container value type, as long as its hash equals the hash of the value.
+	///
+	/// Example find_as usage:
+	///     flat_hash_set<string> hashSet;
+	///     i = hashSet.find_as("hello");    // Use default hash and compare.
+	///
+	/// Example find_as usage (namespaces omitted for brevity):
+	///     flat_hash_set<string> hashSet;
+	///     i = hashSet.find_as("hello", hash<char*>(), equal_to_2<string, char*>());
+	///
+	template <typename Value, typename Hash = eastl::hash<Value>, typename Predicate = eastl::equal_to<Value>,
+			  typename Allocator = EASTLAllocatorType>
+	class flat_hash_set
+		: public flat_hashtable<Value, Value, Allocator, eastl::use_self<Value>, Hash, Predicate, false>
+	{
+	public:
+		typedef flat_hashtable<Value, Value, Allocator, eastl::use_self<Value>,
+							   Hash, Predicate, false>                        base_type;
+		typedef flat_hash_set<Value, Hash, Predicate, Allocator>              this_type;
+		typedef typename base_type::size_type                                 size_type;
+		typedef typename base_type::value_type                                value_type;
+		typedef typename base_type::allocator_type                            allocator_type;
+
+	public:
+		/// flat_hash_set
+		///
+		/// Default constructor. Doesn't allocate memory.
+		///
+		explicit flat_hash_set(const allocator_type& allocator = EASTL_FLAT_HASH_SET_DEFAULT_ALLOCATOR)
+			: base_type(0, Hash(), Predicate(), allocator)
+		{
+			// Empty
+		}
+
+
+		/// flat_hash_set
+		///
+		/// Constructor which creates an empty container, but start with nBucketCount buckets
+		/// (rounded up to a power of two).
+		///
+		explicit flat_hash_set(size_type nBucketCount, const Hash& hashFunction = Hash(), const Predicate& predicate = Predicate(),
+							   const allocator_type& allocator = EASTL_FLAT_HASH_SET_DEFAULT_ALLOCATOR)
+			: base_type(nBucketCount, hashFunction, predicate, allocator)
+		{
+			// Empty
+		}
+
+
+		flat_hash_set(const this_type& x)
+		  : base_type(x)
+		{
+		}
+
+
+		flat_hash_set(this_type&& x)
+		  : base_type(eastl::move(x))
+		{
+		}
+
+
+		flat_hash_set(this_type&& x, const allocator_type& allocator)
+		  : base_type(eastl::move(x), allocator)
+		{
+		}
+
+
+		/// flat_hash_set
+		///
+		/// initializer_list-based constructor.
+		/// Allows for initializing with brace values (e.g. flat_hash_set<int> hs = { 3, 4, 5, }; )
+		///
+		flat_hash_set(std::initializer_list<value_type> ilist, size_type nBucketCount = 0, const Hash& hashFunction = Hash(),
+					  const Predicate& predicate = Predicate(), const allocator_type& allocator = EASTL_FLAT_HASH_SET_DEFAULT_ALLOCATOR)
+			: base_type(ilist.begin(), ilist.end(), nBucketCount, hashFunction, predicate, allocator)
+		{
+			// Empty
+		}
+
+
+		/// flat_hash_set
+		///
+		/// An input bucket count of <= 1 causes the container to be sized for the
+		/// number of elements in the input range.
+		///
+		template <typename FowardIterator>
+		flat_hash_set(FowardIterator first, FowardIterator last, size_type nBucketCount = 0, const Hash& hashFunction = Hash(),
+					  const Predicate& predicate = Predicate(), const allocator_type& allocator = EASTL_FLAT_HASH_SET_DEFAULT_ALLOCATOR)
+			: base_type(first, last, nBucketCount, hashFunction, predicate, allocator)
+		{
+			// Empty
+		}
+
+
+		this_type& operator=(const this_type& x)
+		{
+			return static_cast<this_type&>(base_type::operator=(x));
+		}
+
+
+		this_type& operator=(std::initializer_list<value_type> ilist)
+		{
+			return static_cast<this_type&>(base_type::operator=(ilist));
+		}
+
+
+		this_type& operator=(this_type&& x)
+		{
+			return static_cast<this_type&>(base_type::operator=(eastl::move(x)));
+		}
+
+	}; // flat_hash_set
+
+
+
+
+	///////////////////////////////////////////////////////////////////////
+	// global operators
+	///////////////////////////////////////////////////////////////////////
+
+	template <typename Value, typename Hash, typename Predicate, typename Allocator>
+	inline bool operator==(const flat_hash_set<Value, Hash, Predicate, Allocator>& a,
+						   const flat_hash_set<Value, Hash, Predicate, Allocator>& b)
+	{
+		typedef typename flat_hash_set<Value, Hash, Predicate, Allocator>::const_iterator const_iterator;
+
+		// We implement branching with the assumption that the return value is usually false.
+		if(a.size() != b.size())
+			return false;
+
+		// Values are unique, so we need only test that each element in a can be found in b.
+		for(const_iterator ai = a.begin(), aiEnd = a.end(), biEnd = b.end(); ai != aiEnd; ++ai)
+		{
+			const_iterator bi = b.find(*ai);
+
+			if((bi == biEnd) || !(*ai == *bi)) // We have to compare values in addition to making sure the lookups succeeded. This is because the lookup is done via the user-supplised Predicate
+				return false;                  // which isn't strictly required to be identical to the Value operator==, though 99% of the time it will be so.
+		}
+
+		return true;
+	}
+
+	template <typename Value, typename Hash, typename Predicate, typename Allocator>
+	inline bool operator!=(const flat_hash_set<Value, Hash, Predicate, Allocator>& a,
+						   const flat_hash_set<Value, Hash, Predicate, Allocator>& b)
+	{
+		return !(a == b);
+	}
+
+
+} // namespace eastl
+
+
+#endif // Header include guard
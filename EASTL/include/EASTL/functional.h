@@ -13,6 +13,7 @@
 #include <EASTL/type_traits.h>
 #include <EASTL/internal/functional_base.h>
 #include <EASTL/internal/mem_fn.h>
+#include <string.h>
 
 
 #if defined(EA_PRAGMA_ONCE_SUPPORTED)
@@ -1077,79 +1078,197 @@ namespace eastl
 	///////////////////////////////////////////////////////////////////////////
 	// string hashes
 	//
-	// Note that our string hashes here intentionally are slow for long strings.
-	// The reasoning for this is so:
-	//    - The large majority of hashed strings are only a few bytes long.
-	//    - The hash function is significantly more efficient if it can make this assumption.
-	//    - The user is welcome to make a custom hash for those uncommon cases where
-	//      long strings need to be hashed. Indeed, the user can probably make a 
-	//      special hash customized for such strings that's better than what we provide.
+	// With EASTL_STRING_OPT_FAST_HASH (the default), strings are hashed eight
+	// bytes at a time from their length (see Internal::fast_string_hash), which
+	// matters for long keys such as paths and URLs. String classes pass their
+	// size(), while the character pointer hashes below first have to find the
+	// terminating 0. Both produce the same value for the same characters, which
+	// is what find_as("literal") on a hash_set<string> relies on.
+	//
+	// With EASTL_STRING_OPT_FAST_HASH disabled, strings are hashed one character
+	// at a time with FNV-1, which is about as fast for strings of a few bytes
+	// but much slower for long ones.
+	//
+	// The fast hash reads the characters in native byte order, so its values
+	// differ between little and big endian platforms.
 	///////////////////////////////////////////////////////////////////////////
 
-	template <> struct hash<char8_t*>
+	namespace Internal
 	{
-		size_t operator()(const char8_t* p) const
+		// Loads the 8, 4 or up to 3 bytes at p, in native byte order.
+		inline uint64_t fast_string_hash_read8(const uint8_t* p)
+			{ uint64_t v; memcpy(&v, p, sizeof(v)); return v; }
+
+		inline uint64_t fast_string_hash_read4(const uint8_t* p)
+			{ uint32_t v; memcpy(&v, p, sizeof(v)); return v; }
+
+		inline uint64_t fast_string_hash_read3(const uint8_t* p, size_t n)
+			{ return ((uint64_t)p[0] << 16) | ((uint64_t)p[n >> 1] << 8) | p[n - 1]; }
+
+		// Replaces a and b with the low and high halves of their 128 bit product.
+		inline void fast_string_hash_mum(uint64_t& a, uint64_t& b)
+		{
+			#if defined(__SIZEOF_INT128__)
+				const __uint128_t r = (__uint128_t)a * b;
+				a = (uint64_t)r;
+				b = (uint64_t)(r >> 64);
+			#else
+				const uint64_t aLo = (uint32_t)a, aHi = a >> 32;
+				const uint64_t bLo = (uint32_t)b, bHi = b >> 32;
+				const uint64_t ll  = aLo * bLo,   lh  = aLo * bHi;
+				const uint64_t hl  = aHi * bLo,   hh  = aHi * bHi;
+				const uint64_t mid = (ll >> 32) + (uint32_t)lh + (uint32_t)hl;
+				a = (mid << 32) | (uint32_t)ll;
+				b = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+			#endif
+		}
+
+		// Returns the xor of the low and high halves of the 128 bit product a * b.
+		inline uint64_t fast_string_hash_mix(uint64_t a, uint64_t b)
+		{
+			fast_string_hash_mum(a, b);
+			return a ^ b;
+		}
+
+		/// fast_string_hash
+		///
+		/// Hashes nByteCount bytes at p. This is the wyhash algorithm (public domain),
+		/// which consumes 48 bytes per iteration in three independent multiply chains
+		/// and handles strings of up to 16 bytes without a loop.
+		///
+		inline size_t fast_string_hash(const void* p, size_t nByteCount)
+		{
+			const uint64_t kSecret0 = UINT64_C(0xa0761d6478bd642f);
+			const uint64_t kSecret1 = UINT64_C(0xe7037ed1a0b428db);
+			const uint64_t kSecret2 = UINT64_C(0x8ebc6af09c88c6e3);
+			const uint64_t kSecret3 = UINT64_C(0x589965cc75374cc3);
+
+			const uint8_t* pData = (const uint8_t*)p;
+			uint64_t       seed  = fast_string_hash_mix(kSecret0, kSecret1);
+			uint64_t       a, b;
+
+			if(nByteCount <= 16)
+			{
+				if(nByteCount >= 4)
+				{
+					const size_t n = (nByteCount >> 3) << 2;
+					a = (fast_string_hash_read4(pData) << 32) | fast_string_hash_read4(pData + n);
+					b = (fast_string_hash_read4(pData + nByteCount - 4) << 32) | fast_string_hash_read4(pData + nByteCount - 4 - n);
+				}
+				else if(nByteCount > 0)
+				{
+					a = fast_string_hash_read3(pData, nByteCount);
+					b = 0;
+				}
+				else
+					a = b = 0;
+			}
+			else
+			{
+				size_t i = nByteCount;
+
+				if(i > 48)
+				{
+					uint64_t seed1 = seed, seed2 = seed;
+
+					do {
+						seed  = fast_string_hash_mix(fast_string_hash_read8(pData)      ^ kSecret1, fast_string_hash_read8(pData + 8)  ^ seed);
+						seed1 = fast_string_hash_mix(fast_string_hash_read8(pData + 16) ^ kSecret2, fast_string_hash_read8(pData + 24) ^ seed1);
+						seed2 = fast_string_hash_mix(fast_string_hash_read8(pData + 32) ^ kSecret3, fast_string_hash_read8(pData + 40) ^ seed2);
+						pData += 48;
+						i     -= 48;
+					} while(i > 48);
+
+					seed ^= seed1 ^ seed2;
+				}
+
+				while(i > 16)
+				{
+					seed   = fast_string_hash_mix(fast_string_hash_read8(pData) ^ kSecret1, fast_string_hash_read8(pData + 8) ^ seed);
+					pData += 16;
+					i     -= 16;
+				}
+
+				a = fast_string_hash_read8(pData + i - 16);
+				b = fast_string_hash_read8(pData + i - 8);
+			}
+
+			a ^= kSecret1;
+			b ^= seed;
+			fast_string_hash_mum(a, b);
+			return (size_t)fast_string_hash_mix(a ^ kSecret0 ^ nByteCount, b ^ kSecret1);
+		}
+
+		/// hash_chars
+		///
+		/// Hashes the n characters at p. This is what all the string hashes below use.
+		///
+		template <typename T>
+		inline size_t hash_chars(const T* p, size_t n)
+		{
+			#if EASTL_STRING_OPT_FAST_HASH
+				return fast_string_hash(p, n * sizeof(T));
+			#else
+				typedef typename eastl::add_unsigned<T>::type unsigned_value_type;
+
+				uint32_t result = 2166136261U;   // FNV1 hash. Intentionally uint32_t instead of size_t, so the behavior is the same regardless of size.
+				for(const T* const pEnd = p + n; p != pEnd; ++p)
+					result = (result * 16777619) ^ (uint32_t)(unsigned_value_type)*p;
+				return (size_t)result;
+			#endif
+		}
+
+		/// hash_chars
+		///
+		/// Hashes the 0-terminated string p.
+		///
+		template <typename T>
+		inline size_t hash_chars(const T* p)
 		{
-			uint32_t c, result = 2166136261U;   // FNV1 hash. Perhaps the best string hash. Intentionally uint32_t instead of size_t, so the behavior is the same regardless of size.
-			while((c = (uint8_t)*p++) != 0)     // Using '!=' disables compiler warnings.
-				result = (result * 16777619) ^ c;
-			return (size_t)result;
+			const T* pEnd = p;
+			while(*pEnd)
+				++pEnd;
+			return hash_chars(p, (size_t)(pEnd - p));
 		}
+
+		inline size_t hash_chars(const char* p)
+			{ return hash_chars(p, strlen(p)); }
+	}
+
+	template <> struct hash<char8_t*>
+	{
+		size_t operator()(const char8_t* p) const
+			{ return Internal::hash_chars(p); }
 	};
 
 	template <> struct hash<const char8_t*>
 	{
 		size_t operator()(const char8_t* p) const
-		{
-			uint32_t c, result = 2166136261U;   // Intentionally uint32_t instead of size_t, so the behavior is the same regardless of size.
-			while((c = (uint8_t)*p++) != 0)     // cast to unsigned 8 bit.
-				result = (result * 16777619) ^ c;
-			return (size_t)result;
-		}
+			{ return Internal::hash_chars(p); }
 	};
 
 	template <> struct hash<char16_t*>
 	{
 		size_t operator()(const char16_t* p) const
-		{
-			uint32_t c, result = 2166136261U;   // Intentionally uint32_t instead of size_t, so the behavior is the same regardless of size.
-			while((c = (uint16_t)*p++) != 0)    // cast to unsigned 16 bit.
-				result = (result * 16777619) ^ c;
-			return (size_t)result;
-		}
+			{ return Internal::hash_chars(p); }
 	};
 
 	template <> struct hash<const char16_t*>
 	{
 		size_t operator()(const char16_t* p) const
-		{
-			uint32_t c, result = 2166136261U;   // Intentionally uint32_t instead of size_t, so the behavior is the same regardless of size.
-			while((c = (uint16_t)*p++) != 0)    // cast to unsigned 16 bit.
-				result = (result * 16777619) ^ c;
-			return (size_t)result;
-		}
+			{ return Internal::hash_chars(p); }
 	};
 
 	template <> struct hash<char32_t*>
 	{
 		size_t operator()(const char32_t* p) const
-		{
-			uint32_t c, result = 2166136261U;   // Intentionally uint32_t instead of size_t, so the behavior is the same regardless of size.
-			while((c = (uint32_t)*p++) != 0)    // cast to unsigned 32 bit.
-				result = (result * 16777619) ^ c;
-			return (size_t)result;
-		}
+			{ return Internal::hash_chars(p); }
 	};
 
 	template <> struct hash<const char32_t*>
 	{
 		size_t operator()(const char32_t* p) const
-		{
-			uint32_t c, result = 2166136261U;   // Intentionally uint32_t instead of size_t, so the behavior is the same regardless of size.
-			while((c = (uint32_t)*p++) != 0)    // cast to unsigned 32 bit.
-				result = (result * 16777619) ^ c;
-			return (size_t)result;
-		}
+			{ return Internal::hash_chars(p); }
 	};
 
 	/// string_hash
@@ -1167,13 +1286,7 @@ namespace eastl
 		typedef typename eastl::add_unsigned<value_type>::type unsigned_value_type;
 
 		size_t operator()(const string_type& s) const
-		{
-			const unsigned_value_type* p = (const unsigned_value_type*)s.c_str();
-			uint32_t c, result = 2166136261U;   // Intentionally uint32_t instead of size_t, so the behavior is the same regardless of size.
-			while((c = *p++) != 0)
-				result = (result * 16777619) ^ c;
-			return (size_t)result;
-		}
+			{ return Internal::hash_chars(s.data(), (size_t)s.size()); }
 	};
 
 
@@ -81,6 +81,13 @@ namespace eastl
 	/// is useful for cases whereby the calculation of the hash value for
 	/// a contained object is very expensive.
 	///
+	/// power_of_two_hash
+	/// The bucket count is a prime by default (prime_rehash_policy). Wrapping
+	/// the hash function in power_of_two_hash (e.g. hash_map<uint32_t, Widget, power_of_two_hash<uint32_t> >)
+	/// switches the container to power of two bucket counts, which replaces
+	/// the integer division of every bucket lookup by a multiply. See
+	/// hash_rehash_policy in internal/hashtable.h.
+	///
 	/// find_as
 	/// In order to support the ability to have a hashtable of strings but
 	/// be able to do efficiently lookups via char pointers (i.e. so they 
@@ -100,13 +107,14 @@ namespace eastl
 			  typename Allocator = EASTLAllocatorType, bool bCacheHashCode = false>
 	class hash_map
 		: public hashtable<Key, eastl::pair<const Key, T>, Allocator, eastl::use_first<eastl::pair<const Key, T> >, Predicate,
-							Hash, mod_range_hashing, default_ranged_hash, prime_rehash_policy, bCacheHashCode, true, true>
+							Hash, typename hash_rehash_policy<Hash>::type::range_hashing_type, default_ranged_hash,
+							typename hash_rehash_policy<Hash>::type, bCacheHashCode, true, true>
 	{
 	public:
 		typedef hashtable<Key, eastl::pair<const Key, T>, Allocator, 
 						  eastl::use_first<eastl::pair<const Key, T> >, 
-						  Predicate, Hash, mod_range_hashing, default_ranged_hash, 
-						  prime_rehash_policy, bCacheHashCode, true, true>        base_type;
+						  Predicate, Hash, typename hash_rehash_policy<Hash>::type::range_hashing_type, default_ranged_hash, 
+						  typename hash_rehash_policy<Hash>::type, bCacheHashCode, true, true>        base_type;
 		typedef hash_map<Key, T, Hash, Predicate, Allocator, bCacheHashCode>      this_type;
 		typedef typename base_type::size_type                                     size_type;
 		typedef typename base_type::key_type                                      key_type;
@@ -126,7 +134,7 @@ namespace eastl
 		/// Default constructor.
 		///
 		explicit hash_map(const allocator_type& allocator = EASTL_HASH_MAP_DEFAULT_ALLOCATOR)
-			: base_type(0, Hash(), mod_range_hashing(), default_ranged_hash(), 
+			: base_type(0, Hash(), typename base_type::h2_type(), default_ranged_hash(), 
 						Predicate(), eastl::use_first<eastl::pair<const Key, T> >(), allocator)
 		{
 			// Empty
@@ -141,7 +149,7 @@ namespace eastl
 		///
 		explicit hash_map(size_type nBucketCount, const Hash& hashFunction = Hash(), 
 						  const Predicate& predicate = Predicate(), const allocator_type& allocator = EASTL_HASH_MAP_DEFAULT_ALLOCATOR)
-			: base_type(nBucketCount, hashFunction, mod_range_hashing(), default_ranged_hash(), 
+			: base_type(nBucketCount, hashFunction, typename base_type::h2_type(), default_ranged_hash(), 
 						predicate, eastl::use_first<eastl::pair<const Key, T> >(), allocator)
 		{
 			// Empty
@@ -175,7 +183,7 @@ namespace eastl
 		///     
 		hash_map(std::initializer_list<value_type> ilist, size_type nBucketCount = 0, const Hash& hashFunction = Hash(), 
 				   const Predicate& predicate = Predicate(), const allocator_type& allocator = EASTL_HASH_MAP_DEFAULT_ALLOCATOR)
-			: base_type(ilist.begin(), ilist.end(), nBucketCount, hashFunction, mod_range_hashing(), default_ranged_hash(), 
+			: base_type(ilist.begin(), ilist.end(), nBucketCount, hashFunction, typename base_type::h2_type(), default_ranged_hash(), 
 						predicate, eastl::use_first<eastl::pair<const Key, T> >(), allocator)
 		{
 			// Empty
@@ -190,7 +198,7 @@ namespace eastl
 		template <typename ForwardIterator>
 		hash_map(ForwardIterator first, ForwardIterator last, size_type nBucketCount = 0, const Hash& hashFunction = Hash(), 
 				 const Predicate& predicate = Predicate(), const allocator_type& allocator = EASTL_HASH_MAP_DEFAULT_ALLOCATOR)
-			: base_type(first, last, nBucketCount, hashFunction, mod_range_hashing(), default_ranged_hash(), 
+			: base_type(first, last, nBucketCount, hashFunction, typename base_type::h2_type(), default_ranged_hash(), 
 						predicate, eastl::use_first<eastl::pair<const Key, T> >(), allocator)
 		{
 			// Empty
@@ -311,13 +319,14 @@ namespace eastl
 			  typename Allocator = EASTLAllocatorType, bool bCacheHashCode = false>
 	class hash_multimap
 		: public hashtable<Key, eastl::pair<const Key, T>, Allocator, eastl::use_first<eastl::pair<const Key, T> >, Predicate,
-						   Hash, mod_range_hashing, default_ranged_hash, prime_rehash_policy, bCacheHashCode, true, false>
+						   Hash, typename hash_rehash_policy<Hash>::type::range_hashing_type, default_ranged_hash,
+							typename hash_rehash_policy<Hash>::type, bCacheHashCode, true, false>
 	{
 	public:
 		typedef hashtable<Key, eastl::pair<const Key, T>, Allocator, 
 						  eastl::use_first<eastl::pair<const Key, T> >, 
-						  Predicate, Hash, mod_range_hashing, default_ranged_hash, 
-						  prime_rehash_policy, bCacheHashCode, true, false>           base_type;
+						  Predicate, Hash, typename hash_rehash_policy<Hash>::type::range_hashing_type, default_ranged_hash, 
+						  typename hash_rehash_policy<Hash>::type, bCacheHashCode, true, false>           base_type;
 		typedef hash_multimap<Key, T, Hash, Predicate, Allocator, bCacheHashCode>     this_type;
 		typedef typename base_type::size_type                                         size_type;
 		typedef typename base_type::key_type                                          key_type;
@@ -336,7 +345,7 @@ namespace eastl
 		/// Default constructor.
 		///
 		explicit hash_multimap(const allocator_type& allocator = EASTL_HASH_MULTIMAP_DEFAULT_ALLOCATOR)
-			: base_type(0, Hash(), mod_range_hashing(), default_ranged_hash(), 
+			: base_type(0, Hash(), typename base_type::h2_type(), default_ranged_hash(), 
 						Predicate(), eastl::use_first<eastl::pair<const Key, T> >(), allocator)
 		{
 			// Empty
@@ -351,7 +360,7 @@ namespace eastl
 		///
 		explicit hash_multimap(size_type nBucketCount, const Hash& hashFunction = Hash(), 
 							   const Predicate& predicate = Predicate(), const allocator_type& allocator = EASTL_HASH_MULTIMAP_DEFAULT_ALLOCATOR)
-			: base_type(nBucketCount, hashFunction, mod_range_hashing(), default_ranged_hash(), 
+			: base_type(nBucketCount, hashFunction, typename base_type::h2_type(), default_ranged_hash(), 
 						predicate, eastl::use_first<eastl::pair<const Key, T> >(), allocator)
 		{
 			// Empty
@@ -385,7 +394,7 @@ namespace eastl
 		///     
 		hash_multimap(std::initializer_list<value_type> ilist, size_type nBucketCount = 0, const Hash& hashFunction = Hash(), 
 				   const Predicate& predicate = Predicate(), const allocator_type& allocator = EASTL_HASH_MULTIMAP_DEFAULT_ALLOCATOR)
-			: base_type(ilist.begin(), ilist.end(), nBucketCount, hashFunction, mod_range_hashing(), default_ranged_hash(), 
+			: base_type(ilist.begin(), ilist.end(), nBucketCount, hashFunction, typename base_type::h2_type(), default_ranged_hash(), 
 						predicate, eastl::use_first<eastl::pair<const Key, T> >(), allocator)
 		{
 			// Empty
@@ -400,7 +409,7 @@ namespace eastl
 		template <typename ForwardIterator>
 		hash_multimap(ForwardIterator first, ForwardIterator last, size_type nBucketCount = 0, const Hash& hashFunction = Hash(), 
 					  const Predicate& predicate = Predicate(), const allocator_type& allocator = EASTL_HASH_MULTIMAP_DEFAULT_ALLOCATOR)
-			: base_type(first, last, nBucketCount, hashFunction, mod_range_hashing(), default_ranged_hash(), 
+			: base_type(first, last, nBucketCount, hashFunction, typename base_type::h2_type(), default_ranged_hash(), 
 						predicate, eastl::use_first<eastl::pair<const Key, T> >(), allocator)
 		{
 			// Empty
@@ -81,6 +81,13 @@ namespace eastl
 	/// is useful for cases whereby the calculation of the hash value for
 	/// a contained object is very expensive.
 	///
+	/// power_of_two_hash
+	/// The bucket count is a prime by default (prime_rehash_policy). Wrapping
+	/// the hash function in power_of_two_hash (e.g. hash_set<uint32_t, power_of_two_hash<uint32_t> >)
+	/// switches the container to power of two bucket counts, which replaces
+	/// the integer division of every bucket lookup by a multiply. See
+	/// hash_rehash_policy in internal/hashtable.h.
+	///
 	/// find_as
 	/// In order to support the ability to have a hashtable of strings but
 	/// be able to do efficiently lookups via char pointers (i.e. so they 
@@ -100,13 +107,13 @@ namespace eastl
 			  typename Allocator = EASTLAllocatorType, bool bCacheHashCode = false>
 	class hash_set
 		: public hashtable<Value, Value, Allocator, eastl::use_self<Value>, Predicate,
-						   Hash, mod_range_hashing, default_ranged_hash, 
-						   prime_rehash_policy, bCacheHashCode, false, true>
+						   Hash, typename hash_rehash_policy<Hash>::type::range_hashing_type, default_ranged_hash, 
+						   typename hash_rehash_policy<Hash>::type, bCacheHashCode, false, true>
 	{
 	public:
 		typedef hashtable<Value, Value, Allocator, eastl::use_self<Value>, Predicate, 
-						  Hash, mod_range_hashing, default_ranged_hash,
-						  prime_rehash_policy, bCacheHashCode, false, true>       base_type;
+						  Hash, typename hash_rehash_policy<Hash>::type::range_hashing_type, default_ranged_hash,
+						  typename hash_rehash_policy<Hash>::type, bCacheHashCode, false, true>       base_type;
 		typedef hash_set<Value, Hash, Predicate, Allocator, bCacheHashCode>       this_type;
 		typedef typename base_type::size_type                                     size_type;
 		typedef typename base_type::value_type                                    value_type;
@@ -119,7 +126,7 @@ namespace eastl
 		/// Default constructor.
 		/// 
 		explicit hash_set(const allocator_type& allocator = EASTL_HASH_SET_DEFAULT_ALLOCATOR)
-			: base_type(0, Hash(), mod_range_hashing(), default_ranged_hash(), Predicate(), eastl::use_self<Value>(), allocator)
+			: base_type(0, Hash(), typename base_type::h2_type(), default_ranged_hash(), Predicate(), eastl::use_self<Value>(), allocator)
 		{
 			// Empty
 		}
@@ -133,7 +140,7 @@ namespace eastl
 		///
 		explicit hash_set(size_type nBucketCount, const Hash& hashFunction = Hash(), const Predicate& predicate = Predicate(), 
 						  const allocator_type& allocator = EASTL_HASH_SET_DEFAULT_ALLOCATOR)
-			: base_type(nBucketCount, hashFunction, mod_range_hashing(), default_ranged_hash(), predicate, eastl::use_self<Value>(), allocator)
+			: base_type(nBucketCount, hashFunction, typename base_type::h2_type(), default_ranged_hash(), predicate, eastl::use_self<Value>(), allocator)
 		{
 			// Empty
 		}
@@ -166,7 +173,7 @@ namespace eastl
 		///     
 		hash_set(std::initializer_list<value_type> ilist, size_type nBucketCount = 0, const Hash& hashFunction = Hash(), 
 				   const Predicate& predicate = Predicate(), const allocator_type& allocator = EASTL_HASH_SET_DEFAULT_ALLOCATOR)
-			: base_type(ilist.begin(), ilist.end(), nBucketCount, hashFunction, mod_range_hashing(), default_ranged_hash(), predicate, eastl::use_self<Value>(), allocator)
+			: base_type(ilist.begin(), ilist.end(), nBucketCount, hashFunction, typename base_type::h2_type(), default_ranged_hash(), predicate, eastl::use_self<Value>(), allocator)
 		{
 			// Empty
 		}
@@ -180,7 +187,7 @@ namespace eastl
 		template <typename FowardIterator>
 		hash_set(FowardIterator first, FowardIterator last, size_type nBucketCount = 0, const Hash& hashFunction = Hash(), 
 				 const Predicate& predicate = Predicate(), const allocator_type& allocator = EASTL_HASH_SET_DEFAULT_ALLOCATOR)
-			: base_type(first, last, nBucketCount, hashFunction, mod_range_hashing(), default_ranged_hash(), predicate, eastl::use_self<Value>(), allocator)
+			: base_type(first, last, nBucketCount, hashFunction, typename base_type::h2_type(), default_ranged_hash(), predicate, eastl::use_self<Value>(), allocator)
 		{
 			// Empty
 		}
@@ -222,13 +229,13 @@ namespace eastl
 			  typename Allocator = EASTLAllocatorType, bool bCacheHashCode = false>
 	class hash_multiset
 		: public hashtable<Value, Value, Allocator, eastl::use_self<Value>, Predicate,
-						   Hash, mod_range_hashing, default_ranged_hash,
-						   prime_rehash_policy, bCacheHashCode, false, false>
+						   Hash, typename hash_rehash_policy<Hash>::type::range_hashing_type, default_ranged_hash,
+						   typename hash_rehash_policy<Hash>::type, bCacheHashCode, false, false>
 	{
 	public:
 		typedef hashtable<Value, Value, Allocator, eastl::use_self<Value>, Predicate,
-						  Hash, mod_range_hashing, default_ranged_hash,
-						  prime_rehash_policy, bCacheHashCode, false, false>          base_type;
+						  Hash, typename hash_rehash_policy<Hash>::type::range_hashing_type, default_ranged_hash,
+						  typename hash_rehash_policy<Hash>::type, bCacheHashCode, false, false>          base_type;
 		typedef hash_multiset<Value, Hash, Predicate, Allocator, bCacheHashCode>      this_type;
 		typedef typename base_type::size_type                                         size_type;
 		typedef typename base_type::value_type                                        value_type;
@@ -241,7 +248,7 @@ namespace eastl
 		/// Default constructor.
 		/// 
 		explicit hash_multiset(const allocator_type& allocator = EASTL_HASH_MULTISET_DEFAULT_ALLOCATOR)
-			: base_type(0, Hash(), mod_range_hashing(), default_ranged_hash(), Predicate(), eastl::use_self<Value>(), allocator)
+			: base_type(0, Hash(), typename base_type::h2_type(), default_ranged_hash(), Predicate(), eastl::use_self<Value>(), allocator)
 		{
 			// Empty
 		}
@@ -255,7 +262,7 @@ namespace eastl
 		///
 		explicit hash_multiset(size_type nBucketCount, const Hash& hashFunction = Hash(), 
 							   const Predicate& predicate = Predicate(), const allocator_type& allocator = EASTL_HASH_MULTISET_DEFAULT_ALLOCATOR)
-			: base_type(nBucketCount, hashFunction, mod_range_hashing(), default_ranged_hash(), predicate, eastl::use_self<Value>(), allocator)
+			: base_type(nBucketCount, hashFunction, typename base_type::h2_type(), default_ranged_hash(), predicate, eastl::use_self<Value>(), allocator)
 		{
 			// Empty
 		}
@@ -288,7 +295,7 @@ namespace eastl
 		///     
 		hash_multiset(std::initializer_list<value_type> ilist, size_type nBucketCount = 0, const Hash& hashFunction = Hash(), 
 				   const Predicate& predicate = Predicate(), const allocator_type& allocator = EASTL_HASH_MULTISET_DEFAULT_ALLOCATOR)
-			: base_type(ilist.begin(), ilist.end(), nBucketCount, hashFunction, mod_range_hashing(), default_ranged_hash(), predicate, eastl::use_self<Value>(), allocator)
+			: base_type(ilist.begin(), ilist.end(), nBucketCount, hashFunction, typename base_type::h2_type(), default_ranged_hash(), predicate, eastl::use_self<Value>(), allocator)
 		{
 			// Empty
 		}
@@ -302,7 +309,7 @@ namespace eastl
 		template <typename FowardIterator>
 		hash_multiset(FowardIterator first, FowardIterator last, size_type nBucketCount = 0, const Hash& hashFunction = Hash(), 
 					  const Predicate& predicate = Predicate(), const allocator_type& allocator = EASTL_HASH_MULTISET_DEFAULT_ALLOCATOR)
-			: base_type(first, last, nBucketCount, hashFunction, mod_range_hashing(), default_ranged_hash(), predicate, eastl::use_self<Value>(), allocator)
+			: base_type(first, last, nBucketCount, hashFunction, typename base_type::h2_type(), default_ranged_hash(), predicate, eastl::use_self<Value>(), allocator)
 		{
 			// Empty
 		}
@@ -808,6 +808,15 @@ namespace eastl
 	#define EASTL_STRING_OPT_ARGUMENT_ERRORS 0
 #endif
 
+#ifndef EASTL_STRING_OPT_FAST_HASH
+	// Defined as 0 or 1. Default is 1.
+	// Defines if hash<string>, hash<string_view>, hash<char*> and the like
+	// hash eight bytes at a time from the string length (wyhash), or one
+	// character at a time with FNV-1. The former is much faster for long
+	// strings, the latter produces the same values on all platforms.
+	#define EASTL_STRING_OPT_FAST_HASH 1
+#endif
+
 
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1216,6 +1225,31 @@ namespace eastl
 #endif
 
 
+
+///////////////////////////////////////////////////////////////////////////////
+// EASTL_PREFETCH
+//
+// Defined as a macro which hints the processor to start loading the cache
+// line holding the address p, for reading. It never faults, so p can be
+// any address, including NULL. Does nothing on unsupported compilers.
+//
+// Example usage:
+//    EASTL_PREFETCH(pNodeArray[i + 8]); // Start loading a node we will look at soon.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef EASTL_PREFETCH
+	#if defined(__GNUC__) || defined(__clang__)
+		#define EASTL_PREFETCH(p) __builtin_prefetch((const void*)(p))
+	#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+		#include <xmmintrin.h>
+		#define EASTL_PREFETCH(p) _mm_prefetch((const char*)(p), _MM_HINT_T0)
+	#else
+		#define EASTL_PREFETCH(p) ((void)0)
+	#endif
+#endif
+
+
 ///////////////////////////////////////////////////////////////////////////////
 // EASTL_STD_TYPE_TRAITS_AVAILABLE
 //
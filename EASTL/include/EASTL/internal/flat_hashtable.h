@@ -0,0 +1,1366 @@
+/////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// This file implements flat_hashtable, the open addressing hash table used by
+// flat_hash_map and flat_hash_set.
+// The primary distinctions between flat_hashtable and hashtable are:
+//    - Elements are stored inline in a single slot array, there is no node
+//      allocation per element and no pointer chasing during lookups.
+//    - Each slot has a one byte control value in a separate array, which holds
+//      7 bits of the element hash (or the empty marker). Lookups compare a
+//      whole group of control bytes at once (16 with SSE2, 8 with the portable
+//      64 bit implementation) and only compare keys of matching slots.
+//    - The bucket count is a power of two, a bucket is selected with a mask
+//      of the mixed hash instead of a modulo by a prime.
+//    - Collisions are resolved with linear probing, which doesn't wrap around
+//      the end of the table. The slot array has an overflow area past the last
+//      bucket for the clusters that run past it, which is doubled when needed.
+//    - Erasing doesn't leave tombstones. The slots that follow an erased one in
+//      the same cluster are shifted back into the hole instead, so lookups never
+//      have to skip deleted entries and no cleanup rehash is ever needed.
+//    - Since elements only ever move backward, erasing while iterating is safe
+//      (erase returns the iterator to the next element), but insertions and
+//      erasures invalidate all other iterators, pointers and references.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_INTERNAL_FLAT_HASHTABLE_H
+#define EASTL_INTERNAL_FLAT_HASHTABLE_H
+
+
+#include <EABase/eabase.h>
+#if defined(EA_PRAGMA_ONCE_SUPPORTED)
+	#pragma once
+#endif
+
+#include <EASTL/internal/config.h>
+#include <EASTL/internal/hashtable.h>
+#include <EASTL/type_traits.h>
+#include <EASTL/allocator.h>
+#include <EASTL/iterator.h>
+#include <EASTL/functional.h>
+#include <EASTL/utility.h>
+#include <EASTL/algorithm.h>
+#include <EASTL/numeric_limits.h>
+#include <EASTL/initializer_list.h>
+#include <string.h>
+
+#ifdef _MSC_VER
+	#pragma warning(push, 0)
+	#include <new>
+	#include <stddef.h>
+	#include <intrin.h>
+	#pragma warning(pop)
+#else
+	#include <new>
+	#include <stddef.h>
+#endif
+
+
+/// EASTL_FLAT_HASH_SIMD_ENABLED
+///
+/// Defined as 0 or 1. When enabled, flat_hashtable compares its control bytes
+/// 16 at a time with SSE2. Otherwise it uses a portable implementation which
+/// compares 8 control bytes at a time within a 64 bit integer.
+///
+#ifndef EASTL_FLAT_HASH_SIMD_ENABLED
+	#if defined(EA_SSE) && (EA_SSE >= 2)
+		#define EASTL_FLAT_HASH_SIMD_ENABLED 1
+	#else
+		#define EASTL_FLAT_HASH_SIMD_ENABLED 0
+	#endif
+#endif
+
+#if EASTL_FLAT_HASH_SIMD_ENABLED
+	EA_DISABLE_ALL_VC_WARNINGS()
+	#include <emmintrin.h>
+	EA_RESTORE_ALL_VC_WARNINGS()
+#endif
+
+
+namespace eastl
+{
+
+	/// EASTL_FLAT_HASHTABLE_DEFAULT_NAME
+	///
+	/// Defines a default container name in the absence of a user-provided name.
+	///
+	#ifndef EASTL_FLAT_HASHTABLE_DEFAULT_NAME
+		#define EASTL_FLAT_HASHTABLE_DEFAULT_NAME EASTL_DEFAULT_NAME_PREFIX " flat_hashtable" // Unless the user overrides something, this is "EASTL flat_hashtable".
+	#endif
+
+
+	/// EASTL_FLAT_HASHTABLE_DEFAULT_ALLOCATOR
+	///
+	#ifndef EASTL_FLAT_HASHTABLE_DEFAULT_ALLOCATOR
+		#define EASTL_FLAT_HASHTABLE_DEFAULT_ALLOCATOR allocator_type(EASTL_FLAT_HASHTABLE_DEFAULT_NAME)
+	#endif
+
+
+	/// gFlatHashEmptyCtrl
+	///
+	/// Control bytes shared by all empty flat_hashtables, so that a default
+	/// constructed container doesn't allocate. It holds only end sentinels.
+	///
+	extern EASTL_API const int8_t gFlatHashEmptyCtrl[16];
+
+
+	namespace Internal
+	{
+		/// Control byte values. A full slot holds the low 7 bits of its mixed hash (0 to 127).
+		enum flat_hash_ctrl
+		{
+			kFlatHashEmpty    = -128,  // 0x80
+			kFlatHashSentinel = -1     // 0xff, marks the end of the slot array. It is never matched as empty nor as full.
+		};
+
+
+		/// flat_hash_first_bit
+		///
+		/// Index of the lowest set bit of a non zero value.
+		///
+		inline uint32_t flat_hash_first_bit(uint64_t x)
+		{
+			#if defined(EA_COMPILER_GNUC) || defined(EA_COMPILER_CLANG)
+				return (uint32_t)__builtin_ctzll(x);
+			#elif defined(_MSC_VER) && (defined(EA_PROCESSOR_X86_64) || defined(EA_PROCESSOR_ARM64))
+				unsigned long index;
+				_BitScanForward64(&index, x);
+				return (uint32_t)index;
+			#elif defined(_MSC_VER)
+				unsigned long index;
+				if(_BitScanForward(&index, (unsigned long)x))
+					return (uint32_t)index;
+				_BitScanForward(&index, (unsigned long)(x >> 32));
+				return (uint32_t)index + 32;
+			#else
+				uint32_t n = 0;
+				while(!(x & 1))
+				{
+					x >>= 1;
+					++n;
+				}
+				return n;
+			#endif
+		}
+
+
+		/// flat_hash_group
+		///
+		/// A group of consecutive control bytes, compared in parallel. Match functions
+		/// return a mask with one bit set per matching control byte, which is converted
+		/// back to the index of the byte in the group with LowestIndex.
+		///
+		#if EASTL_FLAT_HASH_SIMD_ENABLED
+			struct flat_hash_group
+			{
+				typedef uint32_t mask_type;
+				static const uint32_t kWidth = 16;
+
+				explicit flat_hash_group(const int8_t* pCtrl)
+					: mCtrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pCtrl))) {}
+
+				mask_type Match(int8_t h2) const
+					{ return (mask_type)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), mCtrl)); }
+
+				mask_type MatchEmpty() const
+					{ return (mask_type)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8((char)kFlatHashEmpty), mCtrl)); }
+
+				mask_type MatchNonEmpty() const
+					{ return MatchEmpty() ^ 0xffff; }
+
+				static uint32_t LowestIndex(mask_type mask)
+					{ return flat_hash_first_bit(mask); }
+
+				__m128i mCtrl;
+			};
+		#else
+			struct flat_hash_group
+			{
+				typedef uint64_t mask_type;
+				static const uint32_t kWidth = 8;
+
+				explicit flat_hash_group(const int8_t* pCtrl)
+					: mCtrl(0)
+				{
+					// Assembled byte by byte so that byte i is always at bits [8*i, 8*i+7], whatever the endianness.
+					// Compilers turn this into a single load on little endian platforms.
+					for(uint32_t i = 0; i < kWidth; ++i)
+						mCtrl |= (uint64_t)(uint8_t)pCtrl[i] << (8 * i);
+				}
+
+				// May report a false positive for a byte that follows a real match, which is
+				// harmless as the keys of matching slots are compared anyway. Empty and sentinel
+				// bytes are never matched as they have their high bit set and h2 doesn't.
+				mask_type Match(int8_t h2) const
+				{
+					const uint64_t x = mCtrl ^ (kLsbs * (uint8_t)h2);
+					return (x - kLsbs) & ~x & kMsbs;
+				}
+
+				// Empty is 0x80 and sentinel is 0xff, they differ by their second lowest bit.
+				mask_type MatchEmpty() const
+					{ return mCtrl & ~(mCtrl << 6) & kMsbs; }
+
+				mask_type MatchNonEmpty() const
+					{ return MatchEmpty() ^ kMsbs; }
+
+				static uint32_t LowestIndex(mask_type mask)
+					{ return flat_hash_first_bit(mask) >> 3; }
+
+				static const uint64_t kLsbs = UINT64_C(0x0101010101010101);
+				static const uint64_t kMsbs = UINT64_C(0x8080808080808080);
+
+				uint64_t mCtrl;
+			};
+		#endif
+
+
+		/// flat_hash_mix
+		///
+		/// Finalizer applied to the user hash, since eastl::hash of integral types is the
+		/// identity. The low 7 bits are stored in the control byte, the following ones select
+		/// the bucket.
+		///
+		inline uint64_t flat_hash_mix(size_t h)
+		{
+			uint64_t x = (uint64_t)h;
+			x ^= x >> 33;
+			x *= UINT64_C(0xff51afd7ed558ccd);
+			x ^= x >> 33;
+			return x;
+		}
+
+	} // namespace Internal
+
+
+
+	/// flat_hashtable_iterator
+	///
+	/// Iterates the slot array in order, skipping empty slots a group at a time.
+	/// The trailing sentinel control bytes stop the iteration at end().
+	///
+	template <typename Value, bool bConst>
+	struct flat_hashtable_iterator
+	{
+	public:
+		typedef flat_hashtable_iterator<Value, bConst>                    this_type;
+		typedef flat_hashtable_iterator<Value, false>                     this_type_non_const;
+		typedef Value                                                     value_type;
+		typedef typename type_select<bConst, const Value*, Value*>::type  pointer;
+		typedef typename type_select<bConst, const Value&, Value&>::type  reference;
+		typedef ptrdiff_t                                                 difference_type;
+		typedef EASTL_ITC_NS::forward_iterator_tag                        iterator_category;
+
+	public:
+		explicit flat_hashtable_iterator(const int8_t* pCtrl = NULL, Value* pSlot = NULL)
+			: mpCtrl(pCtrl), mpSlot(pSlot) { }
+
+		flat_hashtable_iterator(const this_type_non_const& x)
+			: mpCtrl(x.mpCtrl), mpSlot(x.mpSlot) { }
+
+		reference operator*() const
+			{ return *mpSlot; }
+
+		pointer operator->() const
+			{ return mpSlot; }
+
+		this_type& operator++()
+			{ increment(); return *this; }
+
+		this_type operator++(int)
+			{ this_type temp(*this); increment(); return temp; }
+
+		void increment()
+		{
+			++mpCtrl;
+			++mpSlot;
+			skip_empty();
+		}
+
+		// Moves to the first non empty slot at or after the current one.
+		void skip_empty()
+		{
+			if(*mpCtrl != Internal::kFlatHashEmpty)
+				return;
+
+			for(;;)
+			{
+				const Internal::flat_hash_group group(mpCtrl);
+				const typename Internal::flat_hash_group::mask_type mask = group.MatchNonEmpty();
+
+				if(mask)
+				{
+					const uint32_t n = Internal::flat_hash_group::LowestIndex(mask);
+					mpCtrl += n;
+					mpSlot += n;
+					return;
+				}
+				mpCtrl += Internal::flat_hash_group::kWidth;
+				mpSlot += Internal::flat_hash_group::kWidth;
+			}
+		}
+
+	public:
+		const int8_t* mpCtrl;
+		Value*        mpSlot;
+	};
+
+	template <typename Value, bool bConstA, bool bConstB>
+	inline bool operator==(const flat_hashtable_iterator<Value, bConstA>& a, const flat_hashtable_iterator<Value, bConstB>& b)
+		{ return a.mpCtrl == b.mpCtrl; }
+
+	template <typename Value, bool bConstA, bool bConstB>
+	inline bool operator!=(const flat_hashtable_iterator<Value, bConstA>& a, const flat_hashtable_iterator<Value, bConstB>& b)
+		{ return a.mpCtrl != b.mpCtrl; }
+
+
+
+	/// flat_hashtable
+	///
+	/// Key and Value are the same as for hashtable. ExtractKey returns the key from
+	/// a value (use_first for maps, use_self for sets). Keys are always unique.
+	///
+	template <typename Key, typename Value, typename Allocator, typename ExtractKey, typename Hash, typename Equal, bool bMutableIterators>
+	class flat_hashtable
+	{
+	public:
+		typedef Key                                                                key_type;
+		typedef Value                                                              value_type;
+		typedef Allocator                                                          allocator_type;
+		typedef Hash                                                               hasher;
+		typedef Equal                                                              key_equal;
+		typedef ExtractKey                                                         extract_key_type;
+		typedef ptrdiff_t                                                          difference_type;
+		typedef eastl_size_t                                                       size_type;     // See config.h for the definition of eastl_size_t, which defaults to uint32_t.
+		typedef value_type&                                                        reference;
+		typedef const value_type&                                                  const_reference;
+		typedef value_type*                                                        pointer;
+		typedef const value_type*                                                  const_pointer;
+		typedef flat_hashtable_iterator<value_type, !bMutableIterators>            iterator;
+		typedef flat_hashtable_iterator<value_type, true>                          const_iterator;
+		typedef eastl::pair<iterator, bool>                                        insert_return_type;
+		typedef flat_hashtable<Key, Value, Allocator, ExtractKey, Hash, Equal, bMutableIterators> this_type;
+		typedef Internal::flat_hash_group                                          group_type;
+		typedef typename group_type::mask_type                                     mask_type;
+		typedef integral_constant<bool, true>                                      has_unique_keys_type;
+
+		static const size_type kGroupWidth      = group_type::kWidth;
+		static const size_type kMinBucketCount  = 16;
+
+	public:
+		flat_hashtable(size_type nBucketCount, const Hash& hashFunction, const Equal& equal,
+					   const allocator_type& allocator = EASTL_FLAT_HASHTABLE_DEFAULT_ALLOCATOR);
+
+		template <typename InputIterator>
+		flat_hashtable(InputIterator first, InputIterator last, size_type nBucketCount, const Hash& hashFunction,
+					   const Equal& equal, const allocator_type& allocator = EASTL_FLAT_HASHTABLE_DEFAULT_ALLOCATOR);
+
+		flat_hashtable(const this_type& x);
+		flat_hashtable(this_type&& x);
+		flat_hashtable(this_type&& x, const allocator_type& allocator);
+
+	   ~flat_hashtable();
+
+		const allocator_type& get_allocator() const EA_NOEXCEPT { return mAllocator; }
+		allocator_type&       get_allocator() EA_NOEXCEPT       { return mAllocator; }
+		void                  set_allocator(const allocator_type& allocator) { mAllocator = allocator; }
+
+		const key_equal& key_eq() const EA_NOEXCEPT        { return mEqual; }
+		key_equal&       key_eq() EA_NOEXCEPT              { return mEqual; }
+		hasher           hash_function() const EA_NOEXCEPT { return mHash; }
+
+		this_type& operator=(const this_type& x);
+		this_type& operator=(this_type&& x);
+		this_type& operator=(std::initializer_list<value_type> ilist);
+
+		void swap(this_type& x);
+
+	public:
+		iterator begin() EA_NOEXCEPT
+			{ iterator i(mpCtrl, mpSlots); i.skip_empty(); return i; }
+
+		const_iterator begin() const EA_NOEXCEPT
+			{ const_iterator i(mpCtrl, mpSlots); i.skip_empty(); return i; }
+
+		const_iterator cbegin() const EA_NOEXCEPT
+			{ return begin(); }
+
+		iterator end() EA_NOEXCEPT
+			{ return iterator(mpCtrl + mnSlotCount, mpSlots + mnSlotCount); }
+
+		const_iterator end() const EA_NOEXCEPT
+			{ return const_iterator(mpCtrl + mnSlotCount, mpSlots + mnSlotCount); }
+
+		const_iterator cend() const EA_NOEXCEPT
+			{ return end(); }
+
+		bool empty() const EA_NOEXCEPT
+			{ return mnElementCount == 0; }
+
+		size_type size() const EA_NOEXCEPT
+			{ return mnElementCount; }
+
+		size_type max_size() const EA_NOEXCEPT
+			{ return (size_type)(eastl::numeric_limits<size_type>::max() / sizeof(value_type)) / 2; }
+
+		/// Returns the number of home positions, always a power of two (or zero before the first insertion).
+		/// The slot array is slightly larger, see slot_count.
+		size_type bucket_count() const EA_NOEXCEPT
+			{ return mnBucketCount; }
+
+		/// Returns the number of slots, which is the bucket count plus the overflow area.
+		/// This is an extension that's not present in hash_map.
+		size_type slot_count() const EA_NOEXCEPT
+			{ return mnSlotCount; }
+
+		float load_factor() const EA_NOEXCEPT
+			{ return mnBucketCount ? (float)mnElementCount / (float)mnBucketCount : 0.f; }
+
+		/// Returns the max load factor, which is the load factor beyond
+		/// which we rebuild the container with twice the bucket count.
+		float get_max_load_factor() const EA_NOEXCEPT
+			{ return mfMaxLoadFactor; }
+
+		/// Unlike hashtable, the load factor can't go above 1 (it's clamped to [0.25, 1]).
+		void set_max_load_factor(float fMaxLoadFactor);
+
+	public:
+		template <class... Args>
+		insert_return_type emplace(Args&&... args);
+
+		template <class... Args>
+		iterator emplace_hint(const_iterator position, Args&&... args);
+
+		insert_return_type insert(const value_type& value);
+		insert_return_type insert(value_type&& value);
+		iterator           insert(const_iterator hint, const value_type& value);
+		iterator           insert(const_iterator hint, value_type&& value);
+		void               insert(std::initializer_list<value_type> ilist);
+
+		template <typename InputIterator>
+		void insert(InputIterator first, InputIterator last);
+
+	public:
+		iterator  erase(const_iterator position);
+		iterator  erase(const_iterator first, const_iterator last);
+		size_type erase(const key_type& k);
+
+		void clear();
+		void clear(bool clearBuckets);                  // If clearBuckets is true, we free the slot memory and go back to the newly constructed state.
+		void reset_lose_memory() EA_NOEXCEPT;           // This is a unilateral reset to an initially empty state. No destructors are called, no deallocation occurs.
+		void rehash(size_type nBucketCount);            // The bucket count is rounded up to a power of two, large enough for the current size.
+		void reserve(size_type nElementCount);          // Makes room for nElementCount elements without further rehash.
+
+	public:
+		iterator       find(const key_type& key);
+		const_iterator find(const key_type& key) const;
+
+		/// Implements a find whereby the user supplies a comparison of a different type
+		/// than the hashtable value_type. See hashtable::find_as. The hash of the other
+		/// type must be equal to the hash of the equivalent key.
+		///
+		/// Example usage:
+		///     flat_hash_set<string> hashSet;
+		///     hashSet.find_as("hello");    // Use default hash and compare.
+		///     hashSet.find_as("hello", hash<char*>(), equal_to_2<string, char*>());
+		///
+		template <typename U, typename UHash, typename BinaryPredicate>
+		iterator       find_as(const U& u, UHash uhash, BinaryPredicate predicate);
+
+		template <typename U, typename UHash, typename BinaryPredicate>
+		const_iterator find_as(const U& u, UHash uhash, BinaryPredicate predicate) const;
+
+		template <typename U>
+		iterator       find_as(const U& u);
+
+		template <typename U>
+		const_iterator find_as(const U& u) const;
+
+		size_type count(const key_type& k) const EA_NOEXCEPT
+			{ return (DoFind(k, DoHash(k), mEqual) != mnSlotCount) ? 1u : 0u; }
+
+		eastl::pair<iterator, iterator>             equal_range(const key_type& k);
+		eastl::pair<const_iterator, const_iterator> equal_range(const key_type& k) const;
+
+	public:
+		bool validate() const;
+		int  validate_iterator(const_iterator i) const;
+
+	protected:
+		template <typename K>
+		insert_return_type DoInsertKey(K&& key);
+
+		template <typename V>
+		insert_return_type DoInsertValue(V&& value);
+
+		uint64_t DoHash(const key_type& key) const
+			{ return Internal::flat_hash_mix(mHash(key)); }
+
+		size_type DoHome(uint64_t hash) const
+			{ return (size_type)(hash >> 7) & (mnBucketCount - 1); }
+
+		static int8_t DoH2(uint64_t hash)
+			{ return (int8_t)(hash & 0x7f); }
+
+		iterator DoMakeIterator(size_type index)
+			{ return iterator(mpCtrl + index, mpSlots + index); }
+
+		const_iterator DoMakeIterator(size_type index) const
+			{ return const_iterator(mpCtrl + index, mpSlots + index); }
+
+		template <typename U, typename BinaryPredicate>
+		size_type DoFind(const U& u, uint64_t hash, BinaryPredicate predicate) const;
+
+		eastl::pair<size_type, bool> DoPrepareInsert(const key_type& key, uint64_t hash);
+		size_type DoFindEmpty(uint64_t hash) const;
+		size_type DoGrowAndFindEmpty(uint64_t hash);
+		size_type DoGetBucketCount(size_type nElementCount) const;
+		static size_type DoRoundUpBucketCount(size_type nBucketCount);
+		void      DoRehash(size_type nBucketCount, size_type nOverflowCount);
+		void      DoErase(size_type first, size_type last);
+		void      DoDestroyValues();
+		void      DoAllocate(size_type nBucketCount, size_type nOverflowCount);
+		void      DoFree();
+
+		static void DoRelocate(value_type* pDest, value_type* pSource)
+		{
+			::new((void*)pDest) value_type(eastl::move(*pSource));
+			pSource->~value_type();
+		}
+
+		static size_type DoGetAllocationSize(size_type nSlotCount)
+			{ return nSlotCount * (size_type)sizeof(value_type) + nSlotCount + kGroupWidth; }
+
+	protected:
+		int8_t*         mpCtrl;             // Control byte per slot, followed by kGroupWidth sentinels.
+		value_type*     mpSlots;            // Slot array, in the same allocation as mpCtrl.
+		size_type       mnBucketCount;      // Power of two, or 0 while using gFlatHashEmptyCtrl.
+		size_type       mnSlotCount;        // mnBucketCount + overflow slots.
+		size_type       mnElementCount;
+		size_type       mnGrowthThreshold;  // Element count at which the bucket count is doubled.
+		float           mfMaxLoadFactor;
+		Hash            mHash;
+		Equal           mEqual;
+		ExtractKey      mExtractKey;
+		allocator_type  mAllocator;         // To do: Use base class optimization to make this go away.
+	};
+
+
+
+	///////////////////////////////////////////////////////////////////////
+	// flat_hashtable
+	///////////////////////////////////////////////////////////////////////
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	const typename flat_hashtable<K, V, A, EK, H, Eq, bM>::size_type flat_hashtable<K, V, A, EK, H, Eq, bM>::kGroupWidth;
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	const typename flat_hashtable<K, V, A, EK, H, Eq, bM>::size_type flat_hashtable<K, V, A, EK, H, Eq, bM>::kMinBucketCount;
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	flat_hashtable<K, V, A, EK, H, Eq, bM>::flat_hashtable(size_type nBucketCount, const H& hashFunction, const Eq& equal, const allocator_type& allocator)
+		: mfMaxLoadFactor(0.875f),
+		  mHash(hashFunction),
+		  mEqual(equal),
+		  mAllocator(allocator)
+	{
+		reset_lose_memory();
+
+		if(nBucketCount > 1)
+			DoRehash(DoRoundUpBucketCount(nBucketCount), kGroupWidth);
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	template <typename InputIterator>
+	flat_hashtable<K, V, A, EK, H, Eq, bM>::flat_hashtable(InputIterator first, InputIterator last, size_type nBucketCount,
+														   const H& hashFunction, const Eq& equal, const allocator_type& allocator)
+		: mfMaxLoadFactor(0.875f),
+		  mHash(hashFunction),
+		  mEqual(equal),
+		  mAllocator(allocator)
+	{
+		reset_lose_memory();
+
+		if(nBucketCount < 2)
+			nBucketCount = (size_type)ht_distance(first, last);
+
+		if(nBucketCount)
+			reserve(nBucketCount);
+
+		insert(first, last);
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	flat_hashtable<K, V, A, EK, H, Eq, bM>::flat_hashtable(const this_type& x)
+		: mfMaxLoadFactor(x.mfMaxLoadFactor),
+		  mHash(x.mHash),
+		  mEqual(x.mEqual),
+		  mAllocator(x.mAllocator)
+	{
+		reset_lose_memory();
+
+		if(x.mnElementCount)
+		{
+			// Same hash function and same sizes, so every element goes to the same slot as in x.
+			DoAllocate(x.mnBucketCount, x.mnSlotCount - x.mnBucketCount);
+
+			#if EASTL_EXCEPTIONS_ENABLED
+				try
+				{
+			#endif
+					for(size_type i = 0; i < x.mnSlotCount; ++i)
+					{
+						if(x.mpCtrl[i] >= 0)
+						{
+							::new((void*)(mpSlots + i)) value_type(x.mpSlots[i]);
+							mpCtrl[i] = x.mpCtrl[i];
+							++mnElementCount;
+						}
+					}
+			#if EASTL_EXCEPTIONS_ENABLED
+				}
+				catch(...)
+				{
+					clear(true);
+					throw;
+				}
+			#endif
+		}
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	flat_hashtable<K, V, A, EK, H, Eq, bM>::flat_hashtable(this_type&& x)
+		: mfMaxLoadFactor(x.mfMaxLoadFactor),
+		  mHash(x.mHash),
+		  mEqual(x.mEqual),
+		  mAllocator(x.mAllocator)
+	{
+		reset_lose_memory();
+		swap(x);
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	flat_hashtable<K, V, A, EK, H, Eq, bM>::flat_hashtable(this_type&& x, const allocator_type& allocator)
+		: mfMaxLoadFactor(x.mfMaxLoadFactor),
+		  mHash(x.mHash),
+		  mEqual(x.mEqual),
+		  mAllocator(allocator)
+	{
+		reset_lose_memory();
+		swap(x); // swap will directly or indirectly handle the possibility that mAllocator != x.mAllocator.
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	inline flat_hashtable<K, V, A, EK, H, Eq, bM>::~flat_hashtable()
+	{
+		DoDestroyValues();
+		DoFree();
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	typename flat_hashtable<K, V, A, EK, H, Eq, bM>::this_type&
+	flat_hashtable<K, V, A, EK, H, Eq, bM>::operator=(const this_type& x)
+	{
+		if(this != &x)
+		{
+			clear();
+
+			#if EASTL_ALLOCATOR_COPY_ENABLED
+				if(mAllocator != x.mAllocator)
+				{
+					DoFree();
+					reset_lose_memory();
+					mAllocator = x.mAllocator;
+				}
+			#endif
+
+			mfMaxLoadFactor = x.mfMaxLoadFactor;
+			reserve(x.mnElementCount);
+			insert(x.begin(), x.end());
+		}
+		return *this;
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	typename flat_hashtable<K, V, A, EK, H, Eq, bM>::this_type&
+	flat_hashtable<K, V, A, EK, H, Eq, bM>::operator=(this_type&& x)
+	{
+		if(this != &x)
+		{
+			clear();
+			swap(x);
+		}
+		return *this;
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	typename flat_hashtable<K, V, A, EK, H, Eq, bM>::this_type&
+	flat_hashtable<K, V, A, EK, H, Eq, bM>::operator=(std::initializer_list<value_type> ilist)
+	{
+		clear();
+		insert(ilist.begin(), ilist.end());
+		return *this;
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	void flat_hashtable<K, V, A, EK, H, Eq, bM>::swap(this_type& x)
+	{
+		eastl::swap(mpCtrl, x.mpCtrl);
+		eastl::swap(mpSlots, x.mpSlots);
+		eastl::swap(mnBucketCount, x.mnBucketCount);
+		eastl::swap(mnSlotCount, x.mnSlotCount);
+		eastl::swap(mnElementCount, x.mnElementCount);
+		eastl::swap(mnGrowthThreshold, x.mnGrowthThreshold);
+		eastl::swap(mfMaxLoadFactor, x.mfMaxLoadFactor);
+		eastl::swap(mHash, x.mHash);
+		eastl::swap(mEqual, x.mEqual);
+
+		if(mAllocator != x.mAllocator) // If allocators are not equivalent...
+			eastl::swap(mAllocator, x.mAllocator);
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	void flat_hashtable<K, V, A, EK, H, Eq, bM>::set_max_load_factor(float fMaxLoadFactor)
+	{
+		mfMaxLoadFactor = eastl::min_alt(eastl::max_alt(fMaxLoadFactor, 0.25f), 1.f);
+
+		if(mnBucketCount)
+		{
+			const size_type nBucketCount = DoGetBucketCount(mnElementCount);
+			if(nBucketCount > mnBucketCount)
+				DoRehash(nBucketCount, mnSlotCount - mnBucketCount);
+			else
+				mnGrowthThreshold = (size_type)((float)mnBucketCount * mfMaxLoadFactor);
+		}
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	template <class... Args>
+	inline typename flat_hashtable<K, V, A, EK, H, Eq, bM>::insert_return_type
+	flat_hashtable<K, V, A, EK, H, Eq, bM>::emplace(Args&&... args)
+	{
+		// The key is only known once the value is built, so we build it on the stack
+		// and move it into its slot. insert(value_type&&) is the way to avoid this.
+		value_type value(eastl::forward<Args>(args)...);
+		return DoInsertValue(eastl::move(value));
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	template <class... Args>
+	inline typename flat_hashtable<K, V, A, EK, H, Eq, bM>::iterator
+	flat_hashtable<K, V, A, EK, H, Eq, bM>::emplace_hint(const_iterator, Args&&... args)
+	{
+		return emplace(eastl::forward<Args>(args)...).first;
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	inline typename flat_hashtable<K, V, A, EK, H, Eq, bM>::insert_return_type
+	flat_hashtable<K, V, A, EK, H, Eq, bM>::insert(const value_type& value)
+	{
+		return DoInsertValue(value);
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	inline typename flat_hashtable<K, V, A, EK, H, Eq, bM>::insert_return_type
+	flat_hashtable<K, V, A, EK, H, Eq, bM>::insert(value_type&& value)
+	{
+		return DoInsertValue(eastl::move(value));
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	inline typename flat_hashtable<K, V, A, EK, H, Eq, bM>::iterator
+	flat_hashtable<K, V, A, EK, H, Eq, bM>::insert(const_iterator, const value_type& value)
+	{
+		return DoInsertValue(value).first;
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	inline typename flat_hashtable<K, V, A, EK, H, Eq, bM>::iterator
+	flat_hashtable<K, V, A, EK, H, Eq, bM>::insert(const_iterator, value_type&& value)
+	{
+		return DoInsertValue(eastl::move(value)).first;
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	inline void flat_hashtable<K, V, A, EK, H, Eq, bM>::insert(std::initializer_list<value_type> ilist)
+	{
+		insert(ilist.begin(), ilist.end());
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	template <typename InputIterator>
+	void flat_hashtable<K, V, A, EK, H, Eq, bM>::insert(InputIterator first, InputIterator last)
+	{
+		const size_type nElementAdd = (size_type)ht_distance(first, last);
+
+		if(nElementAdd)
+			reserve(mnElementCount + nElementAdd);
+
+		for(; first != last; ++first)
+			insert(*first); // Converts *first to value_type first, if needed, as DoInsertValue keeps a reference to its key.
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	template <typename Kx>
+	typename flat_hashtable<K, V, A, EK, H, Eq, bM>::insert_return_type
+	flat_hashtable<K, V, A, EK, H, Eq, bM>::DoInsertKey(Kx&& key)
+	{
+		const uint64_t hash = DoHash(key);
+		const eastl::pair<size_type, bool> result = DoPrepareInsert(key, hash);
+
+		if(result.second)
+		{
+			::new((void*)(mpSlots + result.first)) value_type(eastl::forward<Kx>(key));
+			mpCtrl[result.first] = DoH2(hash);
+			++mnElementCount;
+		}
+		return insert_return_type(DoMakeIterator(result.first), result.second);
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	template <typename Vx>
+	typename flat_hashtable<K, V, A, EK, H, Eq, bM>::insert_return_type
+	flat_hashtable<K, V, A, EK, H, Eq, bM>::DoInsertValue(Vx&& value)
+	{
+		const key_type& key = mExtractKey(value);
+		const uint64_t hash = DoHash(key);
+		const eastl::pair<size_type, bool> result = DoPrepareInsert(key, hash);
+
+		if(result.second)
+		{
+			::new((void*)(mpSlots + result.first)) value_type(eastl::forward<Vx>(value));
+			mpCtrl[result.first] = DoH2(hash);
+			++mnElementCount;
+		}
+		return insert_return_type(DoMakeIterator(result.first), result.second);
+	}
+
+
+	// Returns the slot of key and false if it's already present, else a free slot for
+	// it and true. The table is grown as needed, but the element count isn't updated.
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	eastl::pair<typename flat_hashtable<K, V, A, EK, H, Eq, bM>::size_type, bool>
+	flat_hashtable<K, V, A, EK, H, Eq, bM>::DoPrepareInsert(const key_type& key, uint64_t hash)
+	{
+		const int8_t   h2    = DoH2(hash);
+		size_type      index = mnSlotCount;
+
+		for(size_type pos = DoHome(hash); pos < mnSlotCount; pos += kGroupWidth)
+		{
+			const group_type group(mpCtrl + pos);
+
+			for(mask_type mask = group.Match(h2); mask; mask &= (mask - 1))
+			{
+				const size_type i = pos + group_type::LowestIndex(mask);
+				if(mEqual(mExtractKey(mpSlots[i]), key))
+					return eastl::pair<size_type, bool>(i, false);
+			}
+
+			// The first empty slot of the probe sequence is where the key belongs.
+			const mask_type maskEmpty = group.MatchEmpty();
+			if(maskEmpty)
+			{
+				index = pos + group_type::LowestIndex(maskEmpty);
+				break;
+			}
+		}
+
+		if((mnElementCount >= mnGrowthThreshold) || (index == mnSlotCount))
+			index = DoGrowAndFindEmpty(hash);
+
+		return eastl::pair<size_type, bool>(index, true);
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	typename flat_hashtable<K, V, A, EK, H, Eq, bM>::size_type
+	flat_hashtable<K, V, A, EK, H, Eq, bM>::DoFindEmpty(uint64_t hash) const
+	{
+		for(size_type pos = DoHome(hash); pos < mnSlotCount; pos += kGroupWidth)
+		{
+			const mask_type maskEmpty = group_type(mpCtrl + pos).MatchEmpty();
+			if(maskEmpty)
+				return pos + group_type::LowestIndex(maskEmpty);
+		}
+		return mnSlotCount;
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	typename flat_hashtable<K, V, A, EK, H, Eq, bM>::size_type
+	flat_hashtable<K, V, A, EK, H, Eq, bM>::DoGrowAndFindEmpty(uint64_t hash)
+	{
+		for(;;)
+		{
+			if(mnElementCount >= mnGrowthThreshold)
+				DoRehash(mnBucketCount ? (mnBucketCount * 2) : DoGetBucketCount(mnElementCount + 1), mnSlotCount - mnBucketCount);
+			else
+				DoRehash(mnBucketCount, (mnSlotCount - mnBucketCount) * 2); // The cluster of this hash runs past the last slot.
+
+			const size_type index = DoFindEmpty(hash);
+			if(index != mnSlotCount)
+				return index;
+		}
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	typename flat_hashtable<K, V, A, EK, H, Eq, bM>::size_type
+	flat_hashtable<K, V, A, EK, H, Eq, bM>::DoGetBucketCount(size_type nElementCount) const
+	{
+		size_type nBucketCount = kMinBucketCount;
+
+		while((size_type)((float)nBucketCount * mfMaxLoadFactor) <= nElementCount)
+			nBucketCount *= 2;
+
+		return nBucketCount;
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	typename flat_hashtable<K, V, A, EK, H, Eq, bM>::size_type
+	flat_hashtable<K, V, A, EK, H, Eq, bM>::DoRoundUpBucketCount(size_type nBucketCount)
+	{
+		size_type nResult = kMinBucketCount;
+
+		while(nResult < nBucketCount)
+			nResult *= 2;
+
+		return nResult;
+	}
+
+
+	// Moves every element into a newly allocated slot array. nOverflowCount is the
+	// size of the area past the last bucket, which is doubled again if a cluster
+	// still runs past it (this only happens with poorly distributed hashes).
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	void flat_hashtable<K, V, A, EK, H, Eq, bM>::DoRehash(size_type nBucketCount, size_type nOverflowCount)
+	{
+		int8_t* const      pCtrl      = mpCtrl;
+		value_type* const  pSlots     = mpSlots;
+		const size_type    nSlotCount = mnSlotCount;
+
+		DoAllocate(nBucketCount, (nOverflowCount > kGroupWidth) ? nOverflowCount : kGroupWidth);
+
+		for(size_type i = 0; i < nSlotCount; ++i)
+		{
+			if(pCtrl[i] >= 0)
+			{
+				const uint64_t hash  = DoHash(mExtractKey(pSlots[i]));
+				size_type      index = DoFindEmpty(hash);
+
+				while(index == mnSlotCount)
+				{
+					DoRehash(mnBucketCount, (mnSlotCount - mnBucketCount) * 2);
+					index = DoFindEmpty(hash);
+				}
+
+				DoRelocate(mpSlots + index, pSlots + i);
+				mpCtrl[index] = pCtrl[i];
+			}
+		}
+
+		if(nSlotCount)
+			EASTLFree(mAllocator, pSlots, DoGetAllocationSize(nSlotCount));
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	void flat_hashtable<K, V, A, EK, H, Eq, bM>::DoAllocate(size_type nBucketCount, size_type nOverflowCount)
+	{
+		const size_type nSlotCount = nBucketCount + nOverflowCount;
+		void* const     pMemory    = allocate_memory(mAllocator, DoGetAllocationSize(nSlotCount), EASTL_ALIGN_OF(value_type), 0);
+		EASTL_ASSERT_MSG(pMemory != nullptr, "the behaviour of eastl::allocators that return nullptr is not defined.");
+
+		mpSlots           = (value_type*)pMemory;
+		mpCtrl            = (int8_t*)(mpSlots + nSlotCount);
+		mnBucketCount     = nBucketCount;
+		mnSlotCount       = nSlotCount;
+		mnGrowthThreshold = eastl::min_alt((size_type)((float)nBucketCount * mfMaxLoadFactor), nBucketCount - 1);
+
+		memset(mpCtrl, Internal::kFlatHashEmpty, nSlotCount);
+		memset(mpCtrl + nSlotCount, Internal::kFlatHashSentinel, kGroupWidth);
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	inline void flat_hashtable<K, V, A, EK, H, Eq, bM>::DoFree()
+	{
+		if(mnSlotCount)
+			EASTLFree(mAllocator, mpSlots, DoGetAllocationSize(mnSlotCount));
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	void flat_hashtable<K, V, A, EK, H, Eq, bM>::DoDestroyValues()
+	{
+		if(mnElementCount)
+		{
+			for(size_type i = 0; i < mnSlotCount; ++i)
+			{
+				if(mpCtrl[i] >= 0)
+					mpSlots[i].~value_type();
+			}
+		}
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	inline typename flat_hashtable<K, V, A, EK, H, Eq, bM>::iterator
+	flat_hashtable<K, V, A, EK, H, Eq, bM>::erase(const_iterator position)
+	{
+		const size_type index = (size_type)(position.mpCtrl - mpCtrl);
+
+		DoErase(index, index + 1);
+
+		iterator i(DoMakeIterator(index));
+		i.skip_empty();
+		return i;
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	typename flat_hashtable<K, V, A, EK, H, Eq, bM>::iterator
+	flat_hashtable<K, V, A, EK, H, Eq, bM>::erase(const_iterator first, const_iterator last)
+	{
+		const size_type index = (size_type)(first.mpCtrl - mpCtrl);
+
+		DoErase(index, (size_type)(last.mpCtrl - mpCtrl));
+
+		iterator i(DoMakeIterator(index));
+		i.skip_empty();
+		return i;
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	typename flat_hashtable<K, V, A, EK, H, Eq, bM>::size_type
+	flat_hashtable<K, V, A, EK, H, Eq, bM>::erase(const key_type& k)
+	{
+		const size_type index = DoFind(k, DoHash(k), mEqual);
+
+		if(index == mnSlotCount)
+			return 0;
+
+		DoErase(index, index + 1);
+		return 1;
+	}
+
+
+	// Erases the elements of the slots [first, last), then shifts back the elements
+	// that follow into the holes. As the probe sequence doesn't wrap around, an element
+	// only ever moves to a lower slot, so the elements that are yet to be iterated stay
+	// after first and the ones already iterated aren't touched.
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	void flat_hashtable<K, V, A, EK, H, Eq, bM>::DoErase(size_type first, size_type last)
+	{
+		if(first == last)
+			return;
+
+		for(size_type i = first; i < last; ++i)
+		{
+			if(mpCtrl[i] >= 0)
+			{
+				mpSlots[i].~value_type();
+				mpCtrl[i] = Internal::kFlatHashEmpty;
+				--mnElementCount;
+			}
+		}
+
+		// Every element up to the end of the cluster that follows the holes may
+		// have a hole between its home and its slot, and must move there.
+		for(size_type i = first + 1; i < mnSlotCount; ++i)
+		{
+			const int8_t ctrl = mpCtrl[i];
+
+			if(ctrl == Internal::kFlatHashEmpty)
+			{
+				if(i >= last)
+					break;
+				continue;
+			}
+
+			const uint64_t hash = DoHash(mExtractKey(mpSlots[i]));
+			if(DoHome(hash) < i)
+			{
+				const size_type index = DoFindEmpty(hash);
+				if(index < i)
+				{
+					DoRelocate(mpSlots + index, mpSlots + i);
+					mpCtrl[index] = ctrl;
+					mpCtrl[i]     = Internal::kFlatHashEmpty;
+				}
+			}
+		}
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	void flat_hashtable<K, V, A, EK, H, Eq, bM>::clear()
+	{
+		DoDestroyValues();
+
+		if(mnSlotCount)
+			memset(mpCtrl, Internal::kFlatHashEmpty, mnSlotCount);
+
+		mnElementCount = 0;
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	void flat_hashtable<K, V, A, EK, H, Eq, bM>::clear(bool clearBuckets)
+	{
+		DoDestroyValues();
+
+		if(clearBuckets)
+		{
+			DoFree();
+			reset_lose_memory();
+		}
+		else
+		{
+			if(mnSlotCount)
+				memset(mpCtrl, Internal::kFlatHashEmpty, mnSlotCount);
+			mnElementCount = 0;
+		}
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	inline void flat_hashtable<K, V, A, EK, H, Eq, bM>::reset_lose_memory() EA_NOEXCEPT
+	{
+		mpCtrl            = const_cast<int8_t*>(gFlatHashEmptyCtrl);
+		mpSlots           = NULL;
+		mnBucketCount     = 0;
+		mnSlotCount       = 0;
+		mnElementCount    = 0;
+		mnGrowthThreshold = 0;
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	void flat_hashtable<K, V, A, EK, H, Eq, bM>::rehash(size_type nBucketCount)
+	{
+		nBucketCount = eastl::max_alt(DoRoundUpBucketCount(nBucketCount), DoGetBucketCount(mnElementCount));
+
+		if(nBucketCount != mnBucketCount)
+			DoRehash(nBucketCount, mnSlotCount - mnBucketCount);
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	void flat_hashtable<K, V, A, EK, H, Eq, bM>::reserve(size_type nElementCount)
+	{
+		const size_type nBucketCount = DoGetBucketCount(nElementCount);
+
+		if(nBucketCount > mnBucketCount)
+			DoRehash(nBucketCount, mnSlotCount - mnBucketCount);
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	template <typename U, typename BinaryPredicate>
+	typename flat_hashtable<K, V, A, EK, H, Eq, bM>::size_type
+	flat_hashtable<K, V, A, EK, H, Eq, bM>::DoFind(const U& u, uint64_t hash, BinaryPredicate predicate) const
+	{
+		const int8_t h2 = DoH2(hash);
+
+		for(size_type pos = DoHome(hash); pos < mnSlotCount; pos += kGroupWidth)
+		{
+			const group_type group(mpCtrl + pos);
+
+			for(mask_type mask = group.Match(h2); mask; mask &= (mask - 1))
+			{
+				const size_type i = pos + group_type::LowestIndex(mask);
+				if(predicate(mExtractKey(mpSlots[i]), u)) // Intentionally compare with key as first arg and other as second arg.
+					return i;
+			}
+
+			if(group.MatchEmpty())
+				break;
+		}
+		return mnSlotCount;
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	inline typename flat_hashtable<K, V, A, EK, H, Eq, bM>::iterator
+	flat_hashtable<K, V, A, EK, H, Eq, bM>::find(const key_type& key)
+	{
+		return DoMakeIterator(DoFind(key, DoHash(key), mEqual));
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	inline typename flat_hashtable<K, V, A, EK, H, Eq, bM>::const_iterator
+	flat_hashtable<K, V, A, EK, H, Eq, bM>::find(const key_type& key) const
+	{
+		return DoMakeIterator(DoFind(key, DoHash(key), mEqual));
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	template <typename U, typename UHash, typename BinaryPredicate>
+	inline typename flat_hashtable<K, V, A, EK, H, Eq, bM>::iterator
+	flat_hashtable<K, V, A, EK, H, Eq, bM>::find_as(const U& other, UHash uhash, BinaryPredicate predicate)
+	{
+		return DoMakeIterator(DoFind(other, Internal::flat_hash_mix(uhash(other)), predicate));
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	template <typename U, typename UHash, typename BinaryPredicate>
+	inline typename flat_hashtable<K, V, A, EK, H, Eq, bM>::const_iterator
+	flat_hashtable<K, V, A, EK, H, Eq, bM>::find_as(const U& other, UHash uhash, BinaryPredicate predicate) const
+	{
+		return DoMakeIterator(DoFind(other, Internal::flat_hash_mix(uhash(other)), predicate));
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	template <typename U>
+	inline typename flat_hashtable<K, V, A, EK, H, Eq, bM>::iterator
+	flat_hashtable<K, V, A, EK, H, Eq, bM>::find_as(const U& other)
+	{
+		return eastl::hashtable_find(*this, other); // Takes other by value, so that find_as("hello") uses hash<const char*>.
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	template <typename U>
+	inline typename flat_hashtable<K, V, A, EK, H, Eq, bM>::const_iterator
+	flat_hashtable<K, V, A, EK, H, Eq, bM>::find_as(const U& other) const
+	{
+		return eastl::hashtable_find(*this, other); // Takes other by value, so that find_as("hello") uses hash<const char*>.
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	eastl::pair<typename flat_hashtable<K, V, A, EK, H, Eq, bM>::iterator, typename flat_hashtable<K, V, A, EK, H, Eq, bM>::iterator>
+	flat_hashtable<K, V, A, EK, H, Eq, bM>::equal_range(const key_type& k)
+	{
+		iterator i(find(k));
+
+		if(i == end())
+			return eastl::pair<iterator, iterator>(i, i);
+
+		iterator iNext(i);
+		return eastl::pair<iterator, iterator>(i, ++iNext);
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	eastl::pair<typename flat_hashtable<K, V, A, EK, H, Eq, bM>::const_iterator, typename flat_hashtable<K, V, A, EK, H, Eq, bM>::const_iterator>
+	flat_hashtable<K, V, A, EK, H, Eq, bM>::equal_range(const key_type& k) const
+	{
+		const_iterator i(find(k));
+
+		if(i == end())
+			return eastl::pair<const_iterator, const_iterator>(i, i);
+
+		const_iterator iNext(i);
+		return eastl::pair<const_iterator, const_iterator>(i, ++iNext);
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	bool flat_hashtable<K, V, A, EK, H, Eq, bM>::validate() const
+	{
+		// Verify that gFlatHashEmptyCtrl is used exactly for tables without slots.
+		if(mnSlotCount == 0)
+			return (mpCtrl == gFlatHashEmptyCtrl) && (mnBucketCount == 0) && (mnElementCount == 0);
+
+		if((mnBucketCount < kMinBucketCount) || (mnBucketCount & (mnBucketCount - 1)) || (mnSlotCount < mnBucketCount + kGroupWidth))
+			return false;
+
+		if(mnGrowthThreshold >= mnBucketCount)
+			return false;
+
+		for(size_type i = 0; i < kGroupWidth; ++i)
+		{
+			if(mpCtrl[mnSlotCount + i] != Internal::kFlatHashSentinel)
+				return false;
+		}
+
+		// Verify that each element has the control byte of its hash and is reachable
+		// from its home, which means there is no empty slot in between.
+		size_type nElementCount = 0;
+
+		for(size_type i = 0; i < mnSlotCount; ++i)
+		{
+			if(mpCtrl[i] == Internal::kFlatHashEmpty)
+				continue;
+
+			if(mpCtrl[i] < 0)
+				return false;
+
+			const uint64_t hash = DoHash(mExtractKey(mpSlots[i]));
+			if(mpCtrl[i] != DoH2(hash))
+				return false;
+
+			const size_type home = DoHome(hash);
+			if((home > i) || (DoFindEmpty(hash) < i))
+				return false;
+
+			++nElementCount;
+		}
+
+		return nElementCount == mnElementCount;
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	int flat_hashtable<K, V, A, EK, H, Eq, bM>::validate_iterator(const_iterator i) const
+	{
+		if((i.mpCtrl >= mpCtrl) && (i.mpCtrl < (mpCtrl + mnSlotCount)) && (*i.mpCtrl >= 0))
+			return (isf_valid | isf_current | isf_can_dereference);
+
+		if(i == end())
+			return (isf_valid | isf_current);
+
+		return isf_none;
+	}
+
+
+
+	///////////////////////////////////////////////////////////////////////
+	// global operators
+	///////////////////////////////////////////////////////////////////////
+
+	// operator==, != are in the specific container subclasses (e.g. flat_hash_map).
+
+	template <typename K, typename V, typename A, typename EK, typename H, typename Eq, bool bM>
+	inline void swap(flat_hashtable<K, V, A, EK, H, Eq, bM>& a, flat_hashtable<K, V, A, EK, H, Eq, bM>& b)
+	{
+		a.swap(b);
+	}
+
+
+} // namespace eastl
+
+
+#endif // Header include guard
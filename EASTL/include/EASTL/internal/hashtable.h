@@ -370,6 +370,71 @@ namespace eastl
 
 
 
+	/// hashtable_incremental_iterator
+	///
+	/// The iterator of a hashtable which uses incremental_rehash_policy. While such
+	/// a hashtable is moving its nodes to a new bucket array, the buckets which
+	/// haven't been moved yet are in the old array, which is iterated first. The
+	/// trailing bucket of the old array then holds the address of the new array
+	/// with its low bit set instead of the end sentinel, and iteration continues
+	/// from there. Other hashtables don't pay for this check.
+	///
+	template <typename Value, bool bConst, bool bCacheHashCode>
+	struct hashtable_incremental_iterator : public hashtable_iterator<Value, bConst, bCacheHashCode>
+	{
+	public:
+		typedef hashtable_iterator<Value, bConst, bCacheHashCode>             base_type;
+		typedef hashtable_incremental_iterator<Value, bConst, bCacheHashCode> this_type;
+		typedef hashtable_incremental_iterator<Value, false, bCacheHashCode>  this_type_non_const;
+		typedef typename base_type::node_type                                 node_type;
+
+	public:
+		hashtable_incremental_iterator(node_type* pNode = NULL, node_type** pBucket = NULL)
+			: base_type(pNode, pBucket) { }
+
+		hashtable_incremental_iterator(node_type** pBucket)
+			: base_type(pBucket) { }
+
+		hashtable_incremental_iterator(const this_type_non_const& x)
+			: base_type(x) { }
+
+		hashtable_incremental_iterator& operator++()
+			{ increment(); return *this; }
+
+		hashtable_incremental_iterator operator++(int)
+			{ hashtable_incremental_iterator temp(*this); increment(); return temp; }
+
+		void increment_bucket()
+		{
+			base_type::increment_bucket();
+			follow_bridge();
+		}
+
+		void increment()
+		{
+			base_type::increment();
+			follow_bridge();
+		}
+
+	protected:
+		void follow_bridge()
+		{
+			// Both the end sentinel (~0) and the bridge have the low bit set, nodes never do.
+			if(EASTL_UNLIKELY(((uintptr_t)this->mpNode & 1) && ((uintptr_t)this->mpNode != (uintptr_t)~0)))
+			{
+				this->mpBucket = (node_type**)((uintptr_t)this->mpNode & ~(uintptr_t)1);
+				this->mpNode   = *this->mpBucket;
+
+				while(this->mpNode == NULL)
+					this->mpNode = *++this->mpBucket;
+			}
+		}
+
+	}; // hashtable_incremental_iterator
+
+
+
+
 	/// ht_distance
 	///
 	/// This function returns the same thing as distance() for 
@@ -433,6 +498,9 @@ namespace eastl
 	///
 	struct EASTL_API prime_rehash_policy
 	{
+	public:
+		typedef mod_range_hashing range_hashing_type; // The range-hashing function (H2) that goes with this bucket count sequence.
+
 	public:
 		float            mfMaxLoadFactor;
 		float            mfGrowthFactor;
@@ -471,6 +539,173 @@ namespace eastl
 
 
 
+	/// fast_range_hashing
+	///
+	/// Range-hashing function that goes with power_of_two_rehash_policy. The hash
+	/// is first scrambled by a Fibonacci (multiplicative) finalizer, as hash<integral>
+	/// is the identity and would otherwise leave most buckets empty for keys that are
+	/// multiples of the bucket count. It is then reduced to [0, BucketCount) with a
+	/// multiply and shift (Lemire's fastrange) instead of a modulo. For the power of two
+	/// bucket counts the policy uses, this selects the top bits of the scrambled hash,
+	/// but the result is also in range for any other bucket count (e.g. rehash(100)).
+	///
+	struct fast_range_hashing
+	{
+		uint32_t operator()(size_t r, uint32_t n) const
+		{
+			const uint64_t x = (uint64_t)r * UINT64_C(0x9e3779b97f4a7c15);
+			const uint32_t h = (uint32_t)(x >> 32) ^ (uint32_t)x;
+			return (uint32_t)(((uint64_t)h * n) >> 32);
+		}
+	};
+
+
+	/// power_of_two_rehash_policy
+	///
+	/// Alternative to prime_rehash_policy which uses power of two bucket counts, so
+	/// that bucket_index is a multiply instead of an integer division by a runtime
+	/// prime. It has the same interface as prime_rehash_policy and is selected with
+	/// power_of_two_hash (see below).
+	///
+	struct EASTL_API power_of_two_rehash_policy
+	{
+	public:
+		typedef fast_range_hashing range_hashing_type;
+
+	public:
+		float            mfMaxLoadFactor;
+		float            mfGrowthFactor;
+		mutable uint32_t mnNextResize;
+
+	public:
+		power_of_two_rehash_policy(float fMaxLoadFactor = 1.f)
+			: mfMaxLoadFactor(fMaxLoadFactor), mfGrowthFactor(2.f), mnNextResize(0) { }
+
+		float GetMaxLoadFactor() const
+			{ return mfMaxLoadFactor; }
+
+		/// Return a bucket count no greater than nBucketCountHint, 
+		/// Don't update member variables while at it.
+		static uint32_t GetPrevBucketCountOnly(uint32_t nBucketCountHint);
+
+		/// Return a bucket count no greater than nBucketCountHint.
+		/// This function has a side effect of updating mnNextResize.
+		uint32_t GetPrevBucketCount(uint32_t nBucketCountHint) const;
+
+		/// Return a bucket count no smaller than nBucketCountHint.
+		/// This function has a side effect of updating mnNextResize.
+		uint32_t GetNextBucketCount(uint32_t nBucketCountHint) const;
+
+		/// Return a bucket count appropriate for nElementCount elements.
+		/// This function has a side effect of updating mnNextResize.
+		uint32_t GetBucketCount(uint32_t nElementCount) const;
+
+		/// See prime_rehash_policy::GetRehashRequired.
+		eastl::pair<bool, uint32_t>
+		GetRehashRequired(uint32_t nBucketCount, uint32_t nElementCount, uint32_t nElementAdd) const;
+	};
+
+
+	/// incremental_rehash_policy
+	///
+	/// prime_rehash_policy, except that when an insertion grows the bucket array the
+	/// work isn't all done in that insertion. The new array is allocated but not cleared:
+	/// the following insertions each clear a slice of it (mnMigrateBucketCount times the
+	/// growth ratio) while the table keeps using the current array. Once it is cleared,
+	/// the old array is kept until each subsequent insertion has moved the nodes of the
+	/// next mnMigrateBucketCount of its buckets. This bounds the latency of any insertion
+	/// instead of stalling for the whole table every time it grows. Lookups and
+	/// iteration see both arrays while nodes move. It is selected with
+	/// incremental_rehash_hash (see below).
+	///
+	struct incremental_rehash_policy : public prime_rehash_policy
+	{
+	public:
+		uint32_t mnMigrateBucketCount; // Number of old buckets emptied by each insertion while a rehash is in progress.
+
+	public:
+		incremental_rehash_policy(float fMaxLoadFactor = 1.f, uint32_t nMigrateBucketCount = 16)
+			: prime_rehash_policy(fMaxLoadFactor), mnMigrateBucketCount(nMigrateBucketCount ? nMigrateBucketCount : 1) { }
+	};
+
+
+	namespace Internal
+	{
+		// has_rehash_policy_type
+		template <class T>
+		struct has_rehash_policy_type
+		{
+		private:
+			template <class U> static eastl::no_type test(...);
+			template <class U> static eastl::yes_type test(typename U::rehash_policy_type* = 0);
+		public:
+			static const bool value = sizeof(test<T>(0)) == sizeof(eastl::yes_type);
+		};
+	}
+
+
+	/// hash_rehash_policy
+	///
+	/// Selects the rehash policy of hash_map, hash_set, their multi and fixed
+	/// variants from their Hash template parameter: Hash::rehash_policy_type if
+	/// the hash function object declares one, else prime_rehash_policy. The
+	/// range-hashing function is the policy's range_hashing_type. This lets a
+	/// container opt in to another policy without changing its template signature.
+	///
+	template <typename Hash, bool = Internal::has_rehash_policy_type<Hash>::value>
+	struct hash_rehash_policy
+	{
+		typedef typename Hash::rehash_policy_type type;
+	};
+
+	template <typename Hash>
+	struct hash_rehash_policy<Hash, false>
+	{
+		typedef prime_rehash_policy type;
+	};
+
+
+	/// power_of_two_hash
+	///
+	/// Hash function object adapter which opts a container in to power_of_two_rehash_policy.
+	/// Weak hashes such as the identity hash<uint32_t> are fine, as fast_range_hashing
+	/// scrambles them before use.
+	///
+	/// Example usage:
+	///     hash_map<uint32_t, Widget, power_of_two_hash<uint32_t> > widgetMap;
+	///     fixed_hash_set<string, 64, 65, true, power_of_two_hash<string> > stringSet;
+	///
+	template <typename Key, typename Hash = eastl::hash<Key> >
+	struct power_of_two_hash : public Hash
+	{
+		typedef power_of_two_rehash_policy rehash_policy_type;
+
+		power_of_two_hash() { }
+		power_of_two_hash(const Hash& hash) : Hash(hash) { }
+	};
+
+
+	/// incremental_rehash_hash
+	///
+	/// Hash function object adapter which opts a container in to incremental_rehash_policy.
+	/// While a rehash is in progress, insertions invalidate iterators (but not pointers or
+	/// references to elements) and the bucket interface (bucket_size, begin(n), etc.) only
+	/// describes the new bucket array.
+	///
+	/// Example usage:
+	///     hash_map<uint32_t, Entity, incremental_rehash_hash<uint32_t> > entityMap;
+	///
+	template <typename Key, typename Hash = eastl::hash<Key> >
+	struct incremental_rehash_hash : public Hash
+	{
+		typedef incremental_rehash_policy rehash_policy_type;
+
+		incremental_rehash_hash() { }
+		incremental_rehash_hash(const Hash& hash) : Hash(hash) { }
+	};
+
+
+
 
 
 	///////////////////////////////////////////////////////////////////////
@@ -488,7 +723,9 @@ namespace eastl
 	/// rehash_base
 	///
 	/// Give hashtable the get_max_load_factor functions if the rehash 
-	/// policy is prime_rehash_policy.
+	/// policy is prime_rehash_policy, power_of_two_rehash_policy or
+	/// incremental_rehash_policy. The latter also holds the state of
+	/// a rehash in progress.
 	///
 	template <typename RehashPolicy, typename Hashtable>
 	struct rehash_base { };
@@ -513,6 +750,65 @@ namespace eastl
 		}
 	};
 
+	template <typename Hashtable>
+	struct rehash_base<power_of_two_rehash_policy, Hashtable>
+	{
+		float get_max_load_factor() const
+		{
+			const Hashtable* const pThis = static_cast<const Hashtable*>(this);
+			return pThis->rehash_policy().GetMaxLoadFactor();
+		}
+
+		void set_max_load_factor(float fMaxLoadFactor)
+		{
+			Hashtable* const pThis = static_cast<Hashtable*>(this);
+			pThis->rehash_policy(power_of_two_rehash_policy(fMaxLoadFactor));
+		}
+	};
+
+	template <typename Hashtable>
+	struct rehash_base<incremental_rehash_policy, Hashtable>
+	{
+		rehash_base()
+			: mpOldBucketArray(NULL), mnOldBucketCount(0), mnMigrateIndex(0),
+			  mpNextBucketArray(NULL), mnNextBucketCount(0), mnClearIndex(0) { }
+
+		// The rehash state belongs to the bucket arrays, which copies don't share.
+		rehash_base(const rehash_base&)
+			: mpOldBucketArray(NULL), mnOldBucketCount(0), mnMigrateIndex(0),
+			  mpNextBucketArray(NULL), mnNextBucketCount(0), mnClearIndex(0) { }
+
+		rehash_base& operator=(const rehash_base&)
+			{ return *this; }
+
+		float get_max_load_factor() const
+		{
+			const Hashtable* const pThis = static_cast<const Hashtable*>(this);
+			return pThis->rehash_policy().GetMaxLoadFactor();
+		}
+
+		void set_max_load_factor(float fMaxLoadFactor)
+		{
+			Hashtable* const pThis = static_cast<Hashtable*>(this);
+			pThis->rehash_policy(incremental_rehash_policy(fMaxLoadFactor, pThis->rehash_policy().mnMigrateBucketCount));
+		}
+
+	protected:
+		// The bucket array whose nodes are being moved to the hashtable's bucket array,
+		// or NULL if no rehash is in progress. Its buckets below mnMigrateIndex are empty.
+		// Hashtable is incomplete here, so the array is stored untyped.
+		void**       mpOldBucketArray;
+		eastl_size_t mnOldBucketCount;
+		eastl_size_t mnMigrateIndex;
+
+		// The bucket array the next rehash will move nodes to, or NULL. It isn't used
+		// until it is cleared; its buckets below mnClearIndex are. At most one of
+		// mpOldBucketArray and mpNextBucketArray is set.
+		void**       mpNextBucketArray;
+		eastl_size_t mnNextBucketCount;
+		eastl_size_t mnClearIndex;
+	};
+
 
 
 
@@ -862,8 +1158,13 @@ namespace eastl
 		typedef const value_type&                                                                   const_reference;
 		typedef node_iterator<value_type, !bMutableIterators, bCacheHashCode>                       local_iterator;
 		typedef node_iterator<value_type, true,               bCacheHashCode>                       const_local_iterator;
-		typedef hashtable_iterator<value_type, !bMutableIterators, bCacheHashCode>                  iterator;
-		typedef hashtable_iterator<value_type, true,               bCacheHashCode>                  const_iterator;
+		typedef integral_constant<bool, is_same<RehashPolicy, incremental_rehash_policy>::value>    has_incremental_rehash_type;
+		typedef typename type_select<has_incremental_rehash_type::value,
+					hashtable_incremental_iterator<value_type, !bMutableIterators, bCacheHashCode>,
+					hashtable_iterator<value_type, !bMutableIterators, bCacheHashCode> >::type      iterator;
+		typedef typename type_select<has_incremental_rehash_type::value,
+					hashtable_incremental_iterator<value_type, true, bCacheHashCode>,
+					hashtable_iterator<value_type, true, bCacheHashCode> >::type                    const_iterator;
 		typedef hash_node<value_type, bCacheHashCode>                                               node_type;
 		typedef typename type_select<bUniqueKeys, eastl::pair<iterator, bool>, iterator>::type      insert_return_type;
 		typedef hashtable<Key, Value, Allocator, ExtractKey, Equal, H1, H2, H, 
@@ -889,7 +1190,8 @@ namespace eastl
 		enum
 		{
 			// This enumeration is deprecated in favor of eastl::kHashtableAllocFlagBuckets.
-			kAllocFlagBuckets = eastl::kHashtableAllocFlagBuckets                  // Flag to allocator which indicates that we are allocating buckets and not nodes.
+			kAllocFlagBuckets = eastl::kHashtableAllocFlagBuckets,                 // Flag to allocator which indicates that we are allocating buckets and not nodes.
+			kFindBatchSize    = 16                                                 // Number of keys whose lookups find_batch overlaps.
 		};
 
 	protected:
@@ -936,7 +1238,7 @@ namespace eastl
 	public:
 		iterator begin() EA_NOEXCEPT
 		{
-			iterator i(mpBucketArray);
+			iterator i(DoGetFirstBucketArray(has_incremental_rehash_type()));
 			if(!i.mpNode)
 				i.increment_bucket();
 			return i;
@@ -944,7 +1246,7 @@ namespace eastl
 
 		const_iterator begin() const EA_NOEXCEPT
 		{
-			const_iterator i(mpBucketArray);
+			const_iterator i(DoGetFirstBucketArray(has_incremental_rehash_type()));
 			if(!i.mpNode)
 				i.increment_bucket();
 			return i;
@@ -1125,6 +1427,25 @@ namespace eastl
 		template <typename U>
 		const_iterator find_as(const U& u) const;
 
+		/// Looks up every key in [first, last) and writes the result of find(key) to out,
+		/// in the same order. Returns out past the last written iterator. Keys are resolved
+		/// kFindBatchSize at a time: all their hashes are computed and their buckets
+		/// prefetched, then the first node of each bucket is prefetched, and only then are
+		/// the nodes compared. The cache misses of independent keys thus overlap instead of
+		/// being paid one after the other, which pays off on tables bigger than the cache.
+		/// ForwardIterator is read twice per batch, so it must be multi-pass.
+		///
+		/// Example usage:
+		///     hash_map<uint32_t, Component> componentMap;
+		///     vector<hash_map<uint32_t, Component>::iterator> results(entityIdArray.size());
+		///     componentMap.find_batch(entityIdArray.begin(), entityIdArray.end(), results.begin());
+		///
+		template <typename ForwardIterator, typename OutputIterator>
+		OutputIterator find_batch(ForwardIterator first, ForwardIterator last, OutputIterator out);
+
+		template <typename ForwardIterator, typename OutputIterator>
+		OutputIterator find_batch(ForwardIterator first, ForwardIterator last, OutputIterator out) const;
+
 		// Note: find_by_hash and find_range_by_hash both perform a search based on a hash value.
 		// It is important to note that multiple hash values may map to the same hash bucket, so
 		// it would be incorrect to assume all items returned match the hash value that
@@ -1141,11 +1462,11 @@ namespace eastl
 				"so it requires cached hash codes.  Consider setting template parameter "
 				"bCacheHashCode to true or using find_by_hash(const key_type& k, hash_code_t c) instead.");
 
-			const size_type n = (size_type)bucket_index(c, (uint32_t)mnBucketCount);
+			node_type** const pBucket = DoGetBucket(c);
 
-			node_type* const pNode = DoFindNode(mpBucketArray[n], c);
+			node_type* const pNode = DoFindNode(*pBucket, c);
 
-			return pNode ? iterator(pNode, mpBucketArray + n) :
+			return pNode ? iterator(pNode, pBucket) :
 						   iterator(mpBucketArray + mnBucketCount); // iterator(mpBucketArray + mnBucketCount) == end()
 		}
 
@@ -1157,29 +1478,29 @@ namespace eastl
 								"so it requires cached hash codes.  Consider setting template parameter "
 								"bCacheHashCode to true or using find_by_hash(const key_type& k, hash_code_t c) instead.");
 
-			const size_type n = (size_type)bucket_index(c, (uint32_t)mnBucketCount);
+			node_type** const pBucket = DoGetBucket(c);
 
-			node_type* const pNode = DoFindNode(mpBucketArray[n], c);
+			node_type* const pNode = DoFindNode(*pBucket, c);
 
 			return pNode ?
-					   const_iterator(pNode, mpBucketArray + n) :
+					   const_iterator(pNode, pBucket) :
 					   const_iterator(mpBucketArray + mnBucketCount); // iterator(mpBucketArray + mnBucketCount) == end()
 		}
 
 		iterator find_by_hash(const key_type& k, hash_code_t c)
 		{
-			const size_type n = (size_type)bucket_index(c, (uint32_t)mnBucketCount);
+			node_type** const pBucket = DoGetBucket(c);
 
-			node_type* const pNode = DoFindNode(mpBucketArray[n], k, c);
-			return pNode ? iterator(pNode, mpBucketArray + n) : iterator(mpBucketArray + mnBucketCount); // iterator(mpBucketArray + mnBucketCount) == end()
+			node_type* const pNode = DoFindNode(*pBucket, k, c);
+			return pNode ? iterator(pNode, pBucket) : iterator(mpBucketArray + mnBucketCount); // iterator(mpBucketArray + mnBucketCount) == end()
 		}
 
 		const_iterator find_by_hash(const key_type& k, hash_code_t c) const
 		{
-			const size_type n = (size_type)bucket_index(c, (uint32_t)mnBucketCount);
+			node_type** const pBucket = DoGetBucket(c);
 
-			node_type* const pNode = DoFindNode(mpBucketArray[n], k, c);
-			return pNode ? const_iterator(pNode, mpBucketArray + n) : const_iterator(mpBucketArray + mnBucketCount); // iterator(mpBucketArray + mnBucketCount) == end()
+			node_type* const pNode = DoFindNode(*pBucket, k, c);
+			return pNode ? const_iterator(pNode, pBucket) : const_iterator(mpBucketArray + mnBucketCount); // iterator(mpBucketArray + mnBucketCount) == end()
 		}
 
 		// Returns a pair that allows iterating over all nodes in a hash bucket
@@ -1230,6 +1551,7 @@ namespace eastl
 		void        DoFreeNodes(node_type** pBucketArray, size_type);
 
 		node_type** DoAllocateBuckets(size_type n);
+		node_type** DoAllocateBucketsUncleared(size_type n);
 		void        DoFreeBuckets(node_type** pBucketArray, size_type n);
 
 		#if EASTL_MOVE_SEMANTICS_ENABLED && EASTL_VARIADIC_TEMPLATES_ENABLED
@@ -1308,6 +1630,129 @@ namespace eastl
 		void       DoRehash(size_type nBucketCount);
 		node_type* DoFindNode(node_type* pNode, const key_type& k, hash_code_t c) const;
 
+		// Returns the bucket which holds the nodes with key k (or hash code c), which while an
+		// incremental rehash is in progress is in the old bucket array unless it was moved already.
+		// The incremental versions are templates so that they aren't instantiated by an explicit
+		// instantiation of a hashtable whose rehash_base has no old bucket array.
+		node_type** DoGetBucket(const key_type& k, hash_code_t c) const
+			{ return DoGetKeyBucket(has_incremental_rehash_type(), k, c); }
+
+		node_type** DoGetBucket(hash_code_t c) const
+			{ return DoGetHashBucket(has_incremental_rehash_type(), c); }
+
+		template <typename BoolConstantT>
+		node_type** DoGetKeyBucket(BoolConstantT, const key_type& k, hash_code_t c, DISABLE_IF_TRUETYPE(BoolConstantT) = 0) const
+			{ return mpBucketArray + bucket_index(k, c, (uint32_t)mnBucketCount); }
+
+		template <typename BoolConstantT>
+		node_type** DoGetKeyBucket(BoolConstantT, const key_type& k, hash_code_t c, ENABLE_IF_TRUETYPE(BoolConstantT) = 0) const
+		{
+			if(this->mpOldBucketArray)
+			{
+				const size_type n = (size_type)bucket_index(k, c, (uint32_t)this->mnOldBucketCount);
+				if(n >= this->mnMigrateIndex)
+					return (node_type**)this->mpOldBucketArray + n;
+			}
+			return mpBucketArray + bucket_index(k, c, (uint32_t)mnBucketCount);
+		}
+
+		template <typename BoolConstantT>
+		node_type** DoGetHashBucket(BoolConstantT, hash_code_t c, DISABLE_IF_TRUETYPE(BoolConstantT) = 0) const
+			{ return mpBucketArray + bucket_index(c, (uint32_t)mnBucketCount); }
+
+		template <typename BoolConstantT>
+		node_type** DoGetHashBucket(BoolConstantT, hash_code_t c, ENABLE_IF_TRUETYPE(BoolConstantT) = 0) const
+		{
+			if(this->mpOldBucketArray)
+			{
+				const size_type n = (size_type)bucket_index(c, (uint32_t)this->mnOldBucketCount);
+				if(n >= this->mnMigrateIndex)
+					return (node_type**)this->mpOldBucketArray + n;
+			}
+			return mpBucketArray + bucket_index(c, (uint32_t)mnBucketCount);
+		}
+
+		template <typename BoolConstantT>
+		node_type** DoGetFirstBucketArray(BoolConstantT, DISABLE_IF_TRUETYPE(BoolConstantT) = 0) const
+			{ return mpBucketArray; }
+
+		template <typename BoolConstantT>
+		node_type** DoGetFirstBucketArray(BoolConstantT, ENABLE_IF_TRUETYPE(BoolConstantT) = 0) const
+			{ return this->mpOldBucketArray ? (node_type**)this->mpOldBucketArray : mpBucketArray; }
+
+		// Acts on the result of GetRehashRequired before an insertion. Returns true if the
+		// buckets may have changed, in which case DoGetBucket must be called again.
+		template <typename BoolConstantT>
+		bool DoRehashForInsert(BoolConstantT, const eastl::pair<bool, uint32_t>& bRehash, DISABLE_IF_TRUETYPE(BoolConstantT) = 0)
+		{
+			if(bRehash.first)
+			{
+				DoRehash(bRehash.second);
+				return true;
+			}
+			return false;
+		}
+
+		template <typename BoolConstantT>
+		bool DoRehashForInsert(BoolConstantT, const eastl::pair<bool, uint32_t>& bRehash, ENABLE_IF_TRUETYPE(BoolConstantT) = 0);
+
+		template <typename BoolConstantT>
+		void DoRehashStep(BoolConstantT, size_type nOldBucketCount);
+
+		template <typename BoolConstantT>
+		void DoFinishRehash(BoolConstantT, DISABLE_IF_TRUETYPE(BoolConstantT) = 0) { }
+
+		template <typename BoolConstantT>
+		void DoFinishRehash(BoolConstantT, ENABLE_IF_TRUETYPE(BoolConstantT) = 0)
+		{
+			// Either count is 0, and the other covers every bucket left to clear or move.
+			if(this->mpOldBucketArray || this->mpNextBucketArray)
+				DoRehashStep(true_type(), this->mnOldBucketCount + this->mnNextBucketCount);
+		}
+
+		template <typename BoolConstantT>
+		void DoFreeOldBuckets(BoolConstantT, DISABLE_IF_TRUETYPE(BoolConstantT) = 0) { }
+
+		template <typename BoolConstantT>
+		void DoFreeOldBuckets(BoolConstantT, ENABLE_IF_TRUETYPE(BoolConstantT) = 0);
+
+		template <typename BoolConstantT>
+		void DoResetOldBuckets(BoolConstantT, DISABLE_IF_TRUETYPE(BoolConstantT) = 0) { }
+
+		template <typename BoolConstantT>
+		void DoResetOldBuckets(BoolConstantT, ENABLE_IF_TRUETYPE(BoolConstantT) = 0)
+		{
+			this->mpOldBucketArray  = NULL;
+			this->mnOldBucketCount  = 0;
+			this->mnMigrateIndex    = 0;
+			this->mpNextBucketArray = NULL;
+			this->mnNextBucketCount = 0;
+			this->mnClearIndex      = 0;
+		}
+
+		template <typename BoolConstantT>
+		void DoSwapOldBuckets(BoolConstantT, this_type&, DISABLE_IF_TRUETYPE(BoolConstantT) = 0) { }
+
+		template <typename BoolConstantT>
+		void DoSwapOldBuckets(BoolConstantT, this_type& x, ENABLE_IF_TRUETYPE(BoolConstantT) = 0)
+		{
+			EASTL_MACRO_SWAP(void**, this->mpOldBucketArray, x.mpOldBucketArray);
+			eastl::swap(this->mnOldBucketCount, x.mnOldBucketCount);
+			eastl::swap(this->mnMigrateIndex, x.mnMigrateIndex);
+			EASTL_MACRO_SWAP(void**, this->mpNextBucketArray, x.mpNextBucketArray);
+			eastl::swap(this->mnNextBucketCount, x.mnNextBucketCount);
+			eastl::swap(this->mnClearIndex, x.mnClearIndex);
+		}
+
+		template <typename BoolConstantT>
+		void DoCopyOldBuckets(BoolConstantT, const this_type&, DISABLE_IF_TRUETYPE(BoolConstantT) = 0) { }
+
+		template <typename BoolConstantT>
+		void DoCopyOldBuckets(BoolConstantT, const this_type& x, ENABLE_IF_TRUETYPE(BoolConstantT) = 0);
+
+		template <typename Iterator, typename ForwardIterator, typename OutputIterator>
+		OutputIterator DoFindBatch(ForwardIterator first, ForwardIterator last, OutputIterator out) const;
+
 		template <typename T>
 		ENABLE_IF_HAS_HASHCODE(T, node_type) DoFindNode(T* pNode, hash_code_t c) const
 		{
@@ -1462,6 +1907,8 @@ namespace eastl
 							pNodeSource = pNodeSource->mpNext;
 						}
 					}
+
+					DoCopyOldBuckets(has_incremental_rehash_type(), x);
 			#if EASTL_EXCEPTIONS_ENABLED
 				}
 				catch(...)
@@ -1692,9 +2139,22 @@ namespace eastl
 		// non-null pointer. Iterator increment relies on this.
 		EASTL_ASSERT(n > 1); // We reserve an mnBucketCount of 1 for the shared gpEmptyBucketArray.
 		EASTL_CT_ASSERT(kHashtableAllocFlagBuckets == 0x00400000); // Currently we expect this to be so, because the allocator has a copy of this enum.
-		node_type** const pBucketArray = (node_type**)EASTLAllocAlignedFlags(mAllocator, (n + 1) * sizeof(node_type*), EASTL_ALIGN_OF(node_type*), 0, kHashtableAllocFlagBuckets);
+		node_type** const pBucketArray = DoAllocateBucketsUncleared(n);
 		//eastl::fill(pBucketArray, pBucketArray + n, (node_type*)NULL);
 		memset(pBucketArray, 0, n * sizeof(node_type*));
+		return pBucketArray;
+	}
+
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq,
+			  typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
+	typename hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::node_type**
+	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::DoAllocateBucketsUncleared(size_type n)
+	{
+		// Only the sentinel is set, the caller must clear buckets [0, n) before using them.
+		EASTL_ASSERT(n > 1);
+		node_type** const pBucketArray = (node_type**)EASTLAllocAlignedFlags(mAllocator, (n + 1) * sizeof(node_type*), EASTL_ALIGN_OF(node_type*), 0, kHashtableAllocFlagBuckets);
 		pBucketArray[n] = reinterpret_cast<node_type*>((uintptr_t)~0);
 		return pBucketArray;
 	}
@@ -1722,6 +2182,7 @@ namespace eastl
 		EASTL_MACRO_SWAP(node_type**, mpBucketArray, x.mpBucketArray);
 		eastl::swap(mnBucketCount, x.mnBucketCount);
 		eastl::swap(mnElementCount, x.mnElementCount);
+		DoSwapOldBuckets(has_incremental_rehash_type(), x);
 
 		if (mAllocator != x.mAllocator) // If allocators are not equivalent...
 		{
@@ -1749,11 +2210,11 @@ namespace eastl
 	inline typename hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::iterator
 	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::find(const key_type& k)
 	{
-		const hash_code_t c = get_hash_code(k);
-		const size_type   n = (size_type)bucket_index(k, c, (uint32_t)mnBucketCount);
+		const hash_code_t c       = get_hash_code(k);
+		node_type** const pBucket = DoGetBucket(k, c);
 
-		node_type* const pNode = DoFindNode(mpBucketArray[n], k, c);
-		return pNode ? iterator(pNode, mpBucketArray + n) : iterator(mpBucketArray + mnBucketCount); // iterator(mpBucketArray + mnBucketCount) == end()
+		node_type* const pNode = DoFindNode(*pBucket, k, c);
+		return pNode ? iterator(pNode, pBucket) : iterator(mpBucketArray + mnBucketCount); // iterator(mpBucketArray + mnBucketCount) == end()
 	}
 
 
@@ -1763,11 +2224,11 @@ namespace eastl
 	inline typename hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::const_iterator
 	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::find(const key_type& k) const
 	{
-		const hash_code_t c = get_hash_code(k);
-		const size_type   n = (size_type)bucket_index(k, c, (uint32_t)mnBucketCount);
+		const hash_code_t c       = get_hash_code(k);
+		node_type** const pBucket = DoGetBucket(k, c);
 
-		node_type* const pNode = DoFindNode(mpBucketArray[n], k, c);
-		return pNode ? const_iterator(pNode, mpBucketArray + n) : const_iterator(mpBucketArray + mnBucketCount); // iterator(mpBucketArray + mnBucketCount) == end()
+		node_type* const pNode = DoFindNode(*pBucket, k, c);
+		return pNode ? const_iterator(pNode, pBucket) : const_iterator(mpBucketArray + mnBucketCount); // iterator(mpBucketArray + mnBucketCount) == end()
 	}
 
 
@@ -1778,11 +2239,11 @@ namespace eastl
 	inline typename hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::iterator
 	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::find_as(const U& other, UHash uhash, BinaryPredicate predicate)
 	{
-		const hash_code_t c = (hash_code_t)uhash(other);
-		const size_type   n = (size_type)(c % mnBucketCount); // This assumes we are using the mod range policy.
+		const hash_code_t c       = (hash_code_t)uhash(other);
+		node_type** const pBucket = DoGetBucket(c);
 
-		node_type* const pNode = DoFindNodeT(mpBucketArray[n], other, predicate);
-		return pNode ? iterator(pNode, mpBucketArray + n) : iterator(mpBucketArray + mnBucketCount); // iterator(mpBucketArray + mnBucketCount) == end()
+		node_type* const pNode = DoFindNodeT(*pBucket, other, predicate);
+		return pNode ? iterator(pNode, pBucket) : iterator(mpBucketArray + mnBucketCount); // iterator(mpBucketArray + mnBucketCount) == end()
 	}
 
 
@@ -1793,11 +2254,76 @@ namespace eastl
 	inline typename hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::const_iterator
 	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::find_as(const U& other, UHash uhash, BinaryPredicate predicate) const
 	{
-		const hash_code_t c = (hash_code_t)uhash(other);
-		const size_type   n = (size_type)(c % mnBucketCount); // This assumes we are using the mod range policy.
+		const hash_code_t c       = (hash_code_t)uhash(other);
+		node_type** const pBucket = DoGetBucket(c);
 
-		node_type* const pNode = DoFindNodeT(mpBucketArray[n], other, predicate);
-		return pNode ? const_iterator(pNode, mpBucketArray + n) : const_iterator(mpBucketArray + mnBucketCount); // iterator(mpBucketArray + mnBucketCount) == end()
+		node_type* const pNode = DoFindNodeT(*pBucket, other, predicate);
+		return pNode ? const_iterator(pNode, pBucket) : const_iterator(mpBucketArray + mnBucketCount); // iterator(mpBucketArray + mnBucketCount) == end()
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq,
+			  typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
+	template <typename ForwardIterator, typename OutputIterator>
+	inline OutputIterator
+	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::find_batch(ForwardIterator first, ForwardIterator last, OutputIterator out)
+	{
+		return DoFindBatch<iterator>(first, last, out);
+	}
+
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq,
+			  typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
+	template <typename ForwardIterator, typename OutputIterator>
+	inline OutputIterator
+	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::find_batch(ForwardIterator first, ForwardIterator last, OutputIterator out) const
+	{
+		return DoFindBatch<const_iterator>(first, last, out);
+	}
+
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq,
+			  typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
+	template <typename Iterator, typename ForwardIterator, typename OutputIterator>
+	OutputIterator
+	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::DoFindBatch(ForwardIterator first, ForwardIterator last, OutputIterator out) const
+	{
+		hash_code_t codeArray[kFindBatchSize];
+		node_type** bucketArray[kFindBatchSize];
+		node_type*  nodeArray[kFindBatchSize];
+
+		while(first != last)
+		{
+			size_type nCount = 0;
+
+			// Hash the keys of this batch and start loading their buckets.
+			for(ForwardIterator it = first; (it != last) && (nCount < (size_type)kFindBatchSize); ++it, ++nCount)
+			{
+				const key_type& k = *it;
+
+				codeArray[nCount]   = get_hash_code(k);
+				bucketArray[nCount] = DoGetBucket(k, codeArray[nCount]);
+				EASTL_PREFETCH(bucketArray[nCount]);
+			}
+
+			// Read the buckets and start loading their first node.
+			for(size_type i = 0; i < nCount; ++i)
+			{
+				nodeArray[i] = *bucketArray[i];
+				EASTL_PREFETCH(nodeArray[i]);
+			}
+
+			// Compare the keys, which by now should mostly be in the cache.
+			for(size_type i = 0; i < nCount; ++i, ++first, ++out)
+			{
+				node_type* const pNode = DoFindNode(nodeArray[i], *first, codeArray[i]);
+				*out = pNode ? Iterator(pNode, bucketArray[i]) : Iterator(mpBucketArray + mnBucketCount);
+			}
+		}
+
+		return out;
 	}
 
 
@@ -1854,13 +2380,13 @@ namespace eastl
 				typename hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::const_iterator>
 	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::find_range_by_hash(hash_code_t c) const
 	{
-		const size_type start = (size_type)bucket_index(c, (uint32_t)mnBucketCount);
-		node_type* const pNodeStart = mpBucketArray[start];
+		node_type** const pBucket = DoGetBucket(c);
+		node_type* const pNodeStart = *pBucket;
 
 		if (pNodeStart)
 		{
-			eastl::pair<const_iterator, const_iterator> pair(const_iterator(pNodeStart, mpBucketArray + start), 
-															 const_iterator(pNodeStart, mpBucketArray + start));
+			eastl::pair<const_iterator, const_iterator> pair(const_iterator(pNodeStart, pBucket), 
+															 const_iterator(pNodeStart, pBucket));
 			pair.second.increment_bucket();
 			return pair;
 		}
@@ -1877,13 +2403,13 @@ namespace eastl
 				typename hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::iterator>
 	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::find_range_by_hash(hash_code_t c)
 	{
-		const size_type start = (size_type)bucket_index(c, (uint32_t)mnBucketCount);
-		node_type* const pNodeStart = mpBucketArray[start];
+		node_type** const pBucket = DoGetBucket(c);
+		node_type* const pNodeStart = *pBucket;
 
 		if (pNodeStart)
 		{
-			eastl::pair<iterator, iterator> pair(iterator(pNodeStart, mpBucketArray + start), 
-												 iterator(pNodeStart, mpBucketArray + start));
+			eastl::pair<iterator, iterator> pair(iterator(pNodeStart, pBucket), 
+												 iterator(pNodeStart, pBucket));
 			pair.second.increment_bucket();
 			return pair;
 
@@ -1901,12 +2427,11 @@ namespace eastl
 	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::count(const key_type& k) const EA_NOEXCEPT
 	{
 		const hash_code_t c      = get_hash_code(k);
-		const size_type   n      = (size_type)bucket_index(k, c, (uint32_t)mnBucketCount);
 		size_type         result = 0;
 
 		// To do: Make a specialization for bU (unique keys) == true and take 
 		// advantage of the fact that the count will always be zero or one in that case. 
-		for(node_type* pNode = mpBucketArray[n]; pNode; pNode = pNode->mpNext)
+		for(node_type* pNode = *DoGetBucket(k, c); pNode; pNode = pNode->mpNext)
 		{
 			if(compare(k, c, pNode))
 				++result;
@@ -1923,8 +2448,7 @@ namespace eastl
 	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::equal_range(const key_type& k)
 	{
 		const hash_code_t c     = get_hash_code(k);
-		const size_type   n     = (size_type)bucket_index(k, c, (uint32_t)mnBucketCount);
-		node_type**       head  = mpBucketArray + n;
+		node_type**       head  = DoGetBucket(k, c);
 		node_type*        pNode = DoFindNode(*head, k, c);
 
 		if(pNode)
@@ -1960,8 +2484,7 @@ namespace eastl
 	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::equal_range(const key_type& k) const
 	{
 		const hash_code_t c     = get_hash_code(k);
-		const size_type   n     = (size_type)bucket_index(k, c, (uint32_t)mnBucketCount);
-		node_type**       head  = mpBucketArray + n;
+		node_type**       head  = DoGetBucket(k, c);
 		node_type*        pNode = DoFindNode(*head, k, c);
 
 		if(pNode)
@@ -2041,8 +2564,8 @@ namespace eastl
 			node_type* const  pNodeNew = DoAllocateNode(eastl::forward<Args>(args)...);
 			const key_type&   k        = mExtractKey(pNodeNew->mValue);
 			const hash_code_t c        = get_hash_code(k);
-			size_type         n        = (size_type)bucket_index(k, c, (uint32_t)mnBucketCount);
-			node_type* const  pNode    = DoFindNode(mpBucketArray[n], k, c);
+			node_type**       pBucket  = DoGetBucket(k, c);
+			node_type* const  pNode    = DoFindNode(*pBucket, k, c);
 
 			if(pNode == NULL) // If value is not present... add it.
 			{
@@ -2054,18 +2577,15 @@ namespace eastl
 					try
 					{
 				#endif
-						if(bRehash.first)
-						{
-							n = (size_type)bucket_index(k, c, (uint32_t)bRehash.second);
-							DoRehash(bRehash.second);
-						}
+						if(DoRehashForInsert(has_incremental_rehash_type(), bRehash))
+							pBucket = DoGetBucket(k, c);
 
 						EASTL_ASSERT((uintptr_t)mpBucketArray != (uintptr_t)&gpEmptyBucketArray[0]);
-						pNodeNew->mpNext = mpBucketArray[n];
-						mpBucketArray[n] = pNodeNew;
+						pNodeNew->mpNext = *pBucket;
+						*pBucket = pNodeNew;
 						++mnElementCount;
 
-						return eastl::pair<iterator, bool>(iterator(pNodeNew, mpBucketArray + n), true);
+						return eastl::pair<iterator, bool>(iterator(pNodeNew, pBucket), true);
 				#if EASTL_EXCEPTIONS_ENABLED
 					}
 					catch(...)
@@ -2087,7 +2607,7 @@ namespace eastl
 				DoFreeNode(pNodeNew);
 			}
 
-			return eastl::pair<iterator, bool>(iterator(pNode, mpBucketArray + n), false);
+			return eastl::pair<iterator, bool>(iterator(pNode, pBucket), false);
 		}
 
 
@@ -2099,13 +2619,12 @@ namespace eastl
 		{
 			const eastl::pair<bool, uint32_t> bRehash = mRehashPolicy.GetRehashRequired((uint32_t)mnBucketCount, (uint32_t)mnElementCount, (uint32_t)1);
 
-			if(bRehash.first)
-				DoRehash(bRehash.second);
+			DoRehashForInsert(has_incremental_rehash_type(), bRehash);
 
 			node_type*        pNodeNew = DoAllocateNode(eastl::forward<Args>(args)...);
 			const key_type&   k        = mExtractKey(pNodeNew->mValue);
 			const hash_code_t c        = get_hash_code(k);
-			const size_type   n        = (size_type)bucket_index(k, c, (uint32_t)mnBucketCount);
+			node_type** const pBucket  = DoGetBucket(k, c);
 
 			set_code(pNodeNew, c); // This is a no-op for most hashtables.
 
@@ -2115,13 +2634,13 @@ namespace eastl
 			// erase(value) can more quickly find equal values. The downside is that
 			// this insertion operation taking some extra time. How important is it to
 			// us that equal_range span all equal items? 
-			node_type* const pNodePrev = DoFindNode(mpBucketArray[n], k, c);
+			node_type* const pNodePrev = DoFindNode(*pBucket, k, c);
 
 			if(pNodePrev == NULL)
 			{
 				EASTL_ASSERT((void**)mpBucketArray != &gpEmptyBucketArray[0]);
-				pNodeNew->mpNext = mpBucketArray[n];
-				mpBucketArray[n] = pNodeNew;
+				pNodeNew->mpNext = *pBucket;
+				*pBucket = pNodeNew;
 			}
 			else
 			{
@@ -2131,7 +2650,7 @@ namespace eastl
 
 			++mnElementCount;
 
-			return iterator(pNodeNew, mpBucketArray + n);
+			return iterator(pNodeNew, pBucket);
 		}
 
 
@@ -2183,8 +2702,8 @@ namespace eastl
 		{
 			// Adds the value to the hash table if not already present. 
 			// If already present then the existing value is returned via an iterator/bool pair.
-			size_type         n     = (size_type)bucket_index(k, c, (uint32_t)mnBucketCount);
-			node_type* const  pNode = DoFindNode(mpBucketArray[n], k, c);
+			node_type**       pBucket = DoGetBucket(k, c);
+			node_type* const  pNode   = DoFindNode(*pBucket, k, c);
 
 			if(pNode == NULL) // If value is not present... add it.
 			{
@@ -2217,18 +2736,15 @@ namespace eastl
 					try
 					{
 				#endif
-						if(bRehash.first)
-						{
-							n = (size_type)bucket_index(k, c, (uint32_t)bRehash.second);
-							DoRehash(bRehash.second);
-						}
+						if(DoRehashForInsert(has_incremental_rehash_type(), bRehash))
+							pBucket = DoGetBucket(k, c);
 
 						EASTL_ASSERT((uintptr_t)mpBucketArray != (uintptr_t)&gpEmptyBucketArray[0]);
-						pNodeNew->mpNext = mpBucketArray[n];
-						mpBucketArray[n] = pNodeNew;
+						pNodeNew->mpNext = *pBucket;
+						*pBucket = pNodeNew;
 						++mnElementCount;
 
-						return eastl::pair<iterator, bool>(iterator(pNodeNew, mpBucketArray + n), true);
+						return eastl::pair<iterator, bool>(iterator(pNodeNew, pBucket), true);
 				#if EASTL_EXCEPTIONS_ENABLED
 					}
 					catch(...)
@@ -2241,7 +2757,7 @@ namespace eastl
 			}
 			// Else the value is already present, so don't add a new node. And don't free pNodeNew.
 
-			return eastl::pair<iterator, bool>(iterator(pNode, mpBucketArray + n), false);
+			return eastl::pair<iterator, bool>(iterator(pNode, pBucket), false);
 		}
 
 
@@ -2267,10 +2783,9 @@ namespace eastl
 		{
 			const eastl::pair<bool, uint32_t> bRehash = mRehashPolicy.GetRehashRequired((uint32_t)mnBucketCount, (uint32_t)mnElementCount, (uint32_t)1);
 
-			if(bRehash.first)
-				DoRehash(bRehash.second); // Note: We don't need to wrap this call with try/catch because there's nothing we would need to do in the catch.
+			DoRehashForInsert(has_incremental_rehash_type(), bRehash); // Note: We don't need to wrap this call with try/catch because there's nothing we would need to do in the catch.
 
-			const size_type n = (size_type)bucket_index(k, c, (uint32_t)mnBucketCount);
+			node_type** const pBucket = DoGetBucket(k, c);
 
 			if(pNodeNew)
 				::new((void*)&pNodeNew->mValue) value_type(eastl::move(value)); // It's expected that pNodeNew was allocated with allocate_uninitialized_node.
@@ -2285,13 +2800,13 @@ namespace eastl
 			// erase(value) can more quickly find equal values. The downside is that
 			// this insertion operation taking some extra time. How important is it to
 			// us that equal_range span all equal items? 
-			node_type* const pNodePrev = DoFindNode(mpBucketArray[n], k, c);
+			node_type* const pNodePrev = DoFindNode(*pBucket, k, c);
 
 			if(pNodePrev == NULL)
 			{
 				EASTL_ASSERT((void**)mpBucketArray != &gpEmptyBucketArray[0]);
-				pNodeNew->mpNext = mpBucketArray[n];
-				mpBucketArray[n] = pNodeNew;
+				pNodeNew->mpNext = *pBucket;
+				*pBucket = pNodeNew;
 			}
 			else
 			{
@@ -2301,7 +2816,7 @@ namespace eastl
 
 			++mnElementCount;
 
-			return iterator(pNodeNew, mpBucketArray + n);
+			return iterator(pNodeNew, pBucket);
 		}
 
 
@@ -2354,8 +2869,8 @@ namespace eastl
 	{
 		// Adds the value to the hash table if not already present. 
 		// If already present then the existing value is returned via an iterator/bool pair.
-		size_type         n     = (size_type)bucket_index(k, c, (uint32_t)mnBucketCount);
-		node_type* const  pNode = DoFindNode(mpBucketArray[n], k, c);
+		node_type**       pBucket = DoGetBucket(k, c);
+		node_type* const  pNode   = DoFindNode(*pBucket, k, c);
 
 		if(pNode == NULL) // If value is not present... add it.
 		{
@@ -2388,18 +2903,15 @@ namespace eastl
 				try
 				{
 			#endif
-					if(bRehash.first)
-					{
-						n = (size_type)bucket_index(k, c, (uint32_t)bRehash.second);
-						DoRehash(bRehash.second);
-					}
+					if(DoRehashForInsert(has_incremental_rehash_type(), bRehash))
+						pBucket = DoGetBucket(k, c);
 
 					EASTL_ASSERT((uintptr_t)mpBucketArray != (uintptr_t)&gpEmptyBucketArray[0]);
-					pNodeNew->mpNext = mpBucketArray[n];
-					mpBucketArray[n] = pNodeNew;
+					pNodeNew->mpNext = *pBucket;
+					*pBucket = pNodeNew;
 					++mnElementCount;
 
-					return eastl::pair<iterator, bool>(iterator(pNodeNew, mpBucketArray + n), true);
+					return eastl::pair<iterator, bool>(iterator(pNodeNew, pBucket), true);
 			#if EASTL_EXCEPTIONS_ENABLED
 				}
 				catch(...)
@@ -2412,7 +2924,7 @@ namespace eastl
 		}
 		// Else the value is already present, so don't add a new node. And don't free pNodeNew.
 
-		return eastl::pair<iterator, bool>(iterator(pNode, mpBucketArray + n), false);
+		return eastl::pair<iterator, bool>(iterator(pNode, pBucket), false);
 	}
 
 
@@ -2438,10 +2950,9 @@ namespace eastl
 	{
 		const eastl::pair<bool, uint32_t> bRehash = mRehashPolicy.GetRehashRequired((uint32_t)mnBucketCount, (uint32_t)mnElementCount, (uint32_t)1);
 
-		if(bRehash.first)
-			DoRehash(bRehash.second); // Note: We don't need to wrap this call with try/catch because there's nothing we would need to do in the catch.
+		DoRehashForInsert(has_incremental_rehash_type(), bRehash); // Note: We don't need to wrap this call with try/catch because there's nothing we would need to do in the catch.
 
-		const size_type n = (size_type)bucket_index(k, c, (uint32_t)mnBucketCount);
+		node_type** const pBucket = DoGetBucket(k, c);
 
 		if(pNodeNew)
 			::new((void*)&pNodeNew->mValue) value_type(value); // It's expected that pNodeNew was allocated with allocate_uninitialized_node.
@@ -2456,13 +2967,13 @@ namespace eastl
 		// erase(value) can more quickly find equal values. The downside is that
 		// this insertion operation taking some extra time. How important is it to
 		// us that equal_range span all equal items? 
-		node_type* const pNodePrev = DoFindNode(mpBucketArray[n], k, c);
+		node_type* const pNodePrev = DoFindNode(*pBucket, k, c);
 
 		if(pNodePrev == NULL)
 		{
 			EASTL_ASSERT((void**)mpBucketArray != &gpEmptyBucketArray[0]);
-			pNodeNew->mpNext = mpBucketArray[n];
-			mpBucketArray[n] = pNodeNew;
+			pNodeNew->mpNext = *pBucket;
+			*pBucket = pNodeNew;
 		}
 		else
 		{
@@ -2472,7 +2983,7 @@ namespace eastl
 
 		++mnElementCount;
 
-		return iterator(pNodeNew, mpBucketArray + n);
+		return iterator(pNodeNew, pBucket);
 	}
 
 
@@ -2543,9 +3054,9 @@ namespace eastl
 	eastl::pair<typename hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::iterator, bool>
 	hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::DoInsertKey(true_type, const key_type& key) // true_type means bUniqueKeys is true.
 	{
-		const hash_code_t c     = get_hash_code(key);
-		size_type         n     = (size_type)bucket_index(key, c, (uint32_t)mnBucketCount);
-		node_type* const  pNode = DoFindNode(mpBucketArray[n], key, c);
+		const hash_code_t c       = get_hash_code(key);
+		node_type**       pBucket = DoGetBucket(key, c);
+		node_type* const  pNode   = DoFindNode(*pBucket, key, c);
 
 		if(pNode == NULL)
 		{
@@ -2560,18 +3071,15 @@ namespace eastl
 				try
 				{
 			#endif
-					if(bRehash.first)
-					{
-						n = (size_type)bucket_index(key, c, (uint32_t)bRehash.second);
-						DoRehash(bRehash.second);
-					}
+					if(DoRehashForInsert(has_incremental_rehash_type(), bRehash))
+						pBucket = DoGetBucket(key, c);
 
 					EASTL_ASSERT((void**)mpBucketArray != &gpEmptyBucketArray[0]);
-					pNodeNew->mpNext = mpBucketArray[n];
-					mpBucketArray[n] = pNodeNew;
+					pNodeNew->mpNext = *pBucket;
+					*pBucket = pNodeNew;
 					++mnElementCount;
 
-					return eastl::pair<iterator, bool>(iterator(pNodeNew, mpBucketArray + n), true);
+					return eastl::pair<iterator, bool>(iterator(pNodeNew, pBucket), true);
 			#if EASTL_EXCEPTIONS_ENABLED
 				}
 				catch(...)
@@ -2582,7 +3090,7 @@ namespace eastl
 			#endif
 		}
 
-		return eastl::pair<iterator, bool>(iterator(pNode, mpBucketArray + n), false);
+		return eastl::pair<iterator, bool>(iterator(pNode, pBucket), false);
 	}
 
 
@@ -2594,11 +3102,10 @@ namespace eastl
 	{
 		const eastl::pair<bool, uint32_t> bRehash = mRehashPolicy.GetRehashRequired((uint32_t)mnBucketCount, (uint32_t)mnElementCount, (uint32_t)1);
 
-		if(bRehash.first)
-			DoRehash(bRehash.second);
+		DoRehashForInsert(has_incremental_rehash_type(), bRehash);
 
-		const hash_code_t c = get_hash_code(key);
-		const size_type   n = (size_type)bucket_index(key, c, (uint32_t)mnBucketCount);
+		const hash_code_t c       = get_hash_code(key);
+		node_type** const pBucket = DoGetBucket(key, c);
 
 		node_type* const pNodeNew = DoAllocateNodeFromKey(key);
 		set_code(pNodeNew, c); // This is a no-op for most hashtables.
@@ -2609,13 +3116,13 @@ namespace eastl
 		// erase(value) can more quickly find equal values. The downside is that
 		// this insertion operation taking some extra time. How important is it to
 		// us that equal_range span all equal items? 
-		node_type* const pNodePrev = DoFindNode(mpBucketArray[n], key, c);
+		node_type* const pNodePrev = DoFindNode(*pBucket, key, c);
 
 		if(pNodePrev == NULL)
 		{
 			EASTL_ASSERT((void**)mpBucketArray != &gpEmptyBucketArray[0]);
-			pNodeNew->mpNext = mpBucketArray[n];
-			mpBucketArray[n] = pNodeNew;
+			pNodeNew->mpNext = *pBucket;
+			*pBucket = pNodeNew;
 		}
 		else
 		{
@@ -2625,7 +3132,7 @@ namespace eastl
 
 		++mnElementCount;
 
-		return iterator(pNodeNew, mpBucketArray + n);
+		return iterator(pNodeNew, pBucket);
 	}
 
 
@@ -2635,9 +3142,9 @@ namespace eastl
 		eastl::pair<typename hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::iterator, bool>
 		hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::DoInsertKey(true_type, const key_type&& key) // true_type means bUniqueKeys is true.
 		{
-			const hash_code_t c     = get_hash_code(key);
-			size_type         n     = (size_type)bucket_index(key, c, (uint32_t)mnBucketCount);
-			node_type* const  pNode = DoFindNode(mpBucketArray[n], key, c);
+			const hash_code_t c       = get_hash_code(key);
+			node_type**       pBucket = DoGetBucket(key, c);
+			node_type* const  pNode   = DoFindNode(*pBucket, key, c);
 
 			if(pNode == NULL)
 			{
@@ -2652,18 +3159,15 @@ namespace eastl
 					try
 					{
 				#endif
-						if(bRehash.first)
-						{
-							n = (size_type)bucket_index(key, c, (uint32_t)bRehash.second);
-							DoRehash(bRehash.second);
-						}
+						if(DoRehashForInsert(has_incremental_rehash_type(), bRehash))
+							pBucket = DoGetBucket(key, c);
 
 						EASTL_ASSERT((void**)mpBucketArray != &gpEmptyBucketArray[0]);
-						pNodeNew->mpNext = mpBucketArray[n];
-						mpBucketArray[n] = pNodeNew;
+						pNodeNew->mpNext = *pBucket;
+						*pBucket = pNodeNew;
 						++mnElementCount;
 
-						return eastl::pair<iterator, bool>(iterator(pNodeNew, mpBucketArray + n), true);
+						return eastl::pair<iterator, bool>(iterator(pNodeNew, pBucket), true);
 				#if EASTL_EXCEPTIONS_ENABLED
 					}
 					catch(...)
@@ -2674,7 +3178,7 @@ namespace eastl
 				#endif
 			}
 
-			return eastl::pair<iterator, bool>(iterator(pNode, mpBucketArray + n), false);
+			return eastl::pair<iterator, bool>(iterator(pNode, pBucket), false);
 		}
 	#endif
 
@@ -2687,11 +3191,10 @@ namespace eastl
 		{
 			const eastl::pair<bool, uint32_t> bRehash = mRehashPolicy.GetRehashRequired((uint32_t)mnBucketCount, (uint32_t)mnElementCount, (uint32_t)1);
 
-			if(bRehash.first)
-				DoRehash(bRehash.second);
+			DoRehashForInsert(has_incremental_rehash_type(), bRehash);
 
-			const hash_code_t c = get_hash_code(key);
-			const size_type   n = (size_type)bucket_index(key, c, (uint32_t)mnBucketCount);
+			const hash_code_t c       = get_hash_code(key);
+			node_type** const pBucket = DoGetBucket(key, c);
 
 			node_type* const pNodeNew = DoAllocateNodeFromKey(eastl::move(key));
 			set_code(pNodeNew, c); // This is a no-op for most hashtables.
@@ -2702,13 +3205,13 @@ namespace eastl
 			// erase(value) can more quickly find equal values. The downside is that
 			// this insertion operation taking some extra time. How important is it to
 			// us that equal_range span all equal items? 
-			node_type* const pNodePrev = DoFindNode(mpBucketArray[n], key, c);
+			node_type* const pNodePrev = DoFindNode(*pBucket, key, c);
 
 			if(pNodePrev == NULL)
 			{
 				EASTL_ASSERT((void**)mpBucketArray != &gpEmptyBucketArray[0]);
-				pNodeNew->mpNext = mpBucketArray[n];
-				mpBucketArray[n] = pNodeNew;
+				pNodeNew->mpNext = *pBucket;
+				*pBucket = pNodeNew;
 			}
 			else
 			{
@@ -2718,7 +3221,7 @@ namespace eastl
 
 			++mnElementCount;
 
-			return iterator(pNodeNew, mpBucketArray + n);
+			return iterator(pNodeNew, pBucket);
 		}
 	#endif
 
@@ -2867,8 +3370,7 @@ namespace eastl
 		const uint32_t nElementAdd = (uint32_t)eastl::ht_distance(first, last);
 		const eastl::pair<bool, uint32_t> bRehash = mRehashPolicy.GetRehashRequired((uint32_t)mnBucketCount, (uint32_t)mnElementCount, nElementAdd);
 
-		if(bRehash.first)
-			DoRehash(bRehash.second);
+		DoRehashForInsert(has_incremental_rehash_type(), bRehash);
 
 		for(; first != last; ++first)
 			DoInsertValue(has_unique_keys_type(), *first);
@@ -2934,10 +3436,9 @@ namespace eastl
 		// buckets are heavily overloaded; otherwise this mechanism may be slightly slower.
 
 		const hash_code_t c = get_hash_code(k);
-		const size_type   n = (size_type)bucket_index(k, c, (uint32_t)mnBucketCount);
 		const size_type   nElementCountSaved = mnElementCount;
 
-		node_type** pBucketArray = mpBucketArray + n;
+		node_type** pBucketArray = DoGetBucket(k, c);
 
 		while(*pBucketArray && !compare(k, c, *pBucketArray))
 			pBucketArray = &(*pBucketArray)->mpNext;
@@ -2960,6 +3461,7 @@ namespace eastl
 	inline void hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::clear()
 	{
 		DoFreeNodes(mpBucketArray, mnBucketCount);
+		DoFreeOldBuckets(has_incremental_rehash_type());
 		mnElementCount = 0;
 	}
 
@@ -2970,6 +3472,7 @@ namespace eastl
 	inline void hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::clear(bool clearBuckets)
 	{
 		DoFreeNodes(mpBucketArray, mnBucketCount);
+		DoFreeOldBuckets(has_incremental_rehash_type());
 		if(clearBuckets)
 		{
 			DoFreeBuckets(mpBucketArray, mnBucketCount);
@@ -3011,6 +3514,7 @@ namespace eastl
 
 		mnElementCount = 0;
 		mRehashPolicy.mnNextResize = 0;
+		DoResetOldBuckets(has_incremental_rehash_type());
 	}
 
 
@@ -3038,6 +3542,8 @@ namespace eastl
 			  typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
 	void hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::DoRehash(size_type nNewBucketCount)
 	{
+		DoFinishRehash(has_incremental_rehash_type()); // An explicit rehash is done at once.
+
 		node_type** const pBucketArray = DoAllocateBuckets(nNewBucketCount); // nNewBucketCount should always be >= 2.
 
 		#if EASTL_EXCEPTIONS_ENABLED
@@ -3078,6 +3584,140 @@ namespace eastl
 	}
 
 
+	template <typename K, typename V, typename A, typename EK, typename Eq,
+			  typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
+	template <typename BoolConstantT>
+	bool hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::DoRehashForInsert(BoolConstantT, const eastl::pair<bool, uint32_t>& bRehash,
+																					 ENABLE_IF_TRUETYPE(BoolConstantT))
+	{
+		if(bRehash.first)
+		{
+			DoFinishRehash(true_type()); // We keep at most two bucket arrays alive.
+
+			if(mnBucketCount <= mRehashPolicy.mnMigrateBucketCount) // Small tables (including the shared empty one) aren't worth migrating.
+				DoRehash(bRehash.second);
+			else
+			{
+				// Clearing the new array is spread over the next insertions too, see DoRehashStep.
+				this->mpNextBucketArray = (void**)DoAllocateBucketsUncleared(bRehash.second);
+				this->mnNextBucketCount = bRehash.second;
+				this->mnClearIndex      = 0;
+				DoRehashStep(true_type(), mRehashPolicy.mnMigrateBucketCount);
+			}
+		}
+		else if(this->mpOldBucketArray || this->mpNextBucketArray)
+			DoRehashStep(true_type(), mRehashPolicy.mnMigrateBucketCount);
+		else
+			return false;
+
+		return true;
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq,
+			  typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
+	template <typename BoolConstantT>
+	void hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::DoRehashStep(BoolConstantT, size_type nOldBucketCount)
+	{
+		if(this->mpNextBucketArray)
+		{
+			// Clear nOldBucketCount times the growth ratio, so that clearing takes about as
+			// many insertions as moving the nodes afterwards.
+			node_type** const pNextBucketArray = (node_type**)this->mpNextBucketArray;
+			const size_type   nRatio           = (size_type)(this->mnNextBucketCount / mnBucketCount) + 1;
+			const size_type   nClearLeft       = this->mnNextBucketCount - this->mnClearIndex;
+			const size_type   nClearCount      = (nOldBucketCount >= nClearLeft / nRatio) ? nClearLeft : nOldBucketCount * nRatio;
+
+			memset(pNextBucketArray + this->mnClearIndex, 0, nClearCount * sizeof(node_type*));
+			this->mnClearIndex += nClearCount;
+
+			if(this->mnClearIndex < this->mnNextBucketCount)
+				return;
+
+			// The old array's end sentinel becomes a tagged pointer to the new array, which
+			// hashtable_incremental_iterator follows when it walks off the end of the old array.
+			mpBucketArray[mnBucketCount] = (node_type*)((uintptr_t)pNextBucketArray | 1);
+
+			this->mpOldBucketArray  = (void**)mpBucketArray;
+			this->mnOldBucketCount  = mnBucketCount;
+			this->mnMigrateIndex    = 0;
+			mpBucketArray = pNextBucketArray;
+			mnBucketCount = this->mnNextBucketCount;
+			this->mpNextBucketArray = NULL;
+			this->mnNextBucketCount = 0;
+			this->mnClearIndex      = 0;
+		}
+
+		node_type** const pOldBucketArray = (node_type**)this->mpOldBucketArray;
+		const size_type   nOldBucketEnd   = eastl::min_alt(this->mnMigrateIndex + nOldBucketCount, this->mnOldBucketCount);
+		node_type*        pNode;
+
+		for(size_type i = this->mnMigrateIndex; i < nOldBucketEnd; ++i)
+		{
+			while((pNode = pOldBucketArray[i]) != NULL)
+			{
+				const size_type nNewBucketIndex = (size_type)bucket_index(pNode, (uint32_t)mnBucketCount);
+
+				pOldBucketArray[i] = pNode->mpNext;
+				pNode->mpNext      = mpBucketArray[nNewBucketIndex];
+				mpBucketArray[nNewBucketIndex] = pNode;
+			}
+
+			this->mnMigrateIndex = i + 1; // Updated per bucket so that a throwing hash function leaves us consistent.
+		}
+
+		if(this->mnMigrateIndex == this->mnOldBucketCount)
+		{
+			DoFreeBuckets(pOldBucketArray, this->mnOldBucketCount);
+			DoResetOldBuckets(true_type());
+		}
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq,
+			  typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
+	template <typename BoolConstantT>
+	void hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::DoFreeOldBuckets(BoolConstantT, ENABLE_IF_TRUETYPE(BoolConstantT))
+	{
+		if(this->mpOldBucketArray)
+		{
+			node_type** const pOldBucketArray = (node_type**)this->mpOldBucketArray;
+
+			DoFreeNodes(pOldBucketArray + this->mnMigrateIndex, this->mnOldBucketCount - this->mnMigrateIndex);
+			DoFreeBuckets(pOldBucketArray, this->mnOldBucketCount);
+		}
+		if(this->mpNextBucketArray) // Holds no node yet.
+			DoFreeBuckets((node_type**)this->mpNextBucketArray, this->mnNextBucketCount);
+		DoResetOldBuckets(true_type());
+	}
+
+
+	template <typename K, typename V, typename A, typename EK, typename Eq,
+			  typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
+	template <typename BoolConstantT>
+	void hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::DoCopyOldBuckets(BoolConstantT, const this_type& x, ENABLE_IF_TRUETYPE(BoolConstantT))
+	{
+		// The copy doesn't inherit x's migration; the nodes x hasn't moved yet go straight into our new array.
+		if(x.mpOldBucketArray)
+		{
+			node_type** const pOldBucketArray = (node_type**)x.mpOldBucketArray;
+
+			for(size_type i = x.mnMigrateIndex; i < x.mnOldBucketCount; ++i)
+			{
+				for(node_type* pNodeSource = pOldBucketArray[i]; pNodeSource; pNodeSource = pNodeSource->mpNext)
+				{
+					node_type* const pNodeDest       = DoAllocateNode(pNodeSource->mValue);
+					const size_type  nNewBucketIndex = (size_type)bucket_index(pNodeSource, (uint32_t)mnBucketCount);
+
+					copy_code(pNodeDest, pNodeSource);
+					pNodeDest->mpNext = mpBucketArray[nNewBucketIndex];
+					mpBucketArray[nNewBucketIndex] = pNodeDest;
+				}
+			}
+		}
+	}
+
+
 	template <typename K, typename V, typename A, typename EK, typename Eq,
 			  typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
 	inline bool hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::validate() const
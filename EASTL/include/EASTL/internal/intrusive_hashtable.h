@@ -284,7 +284,8 @@ namespace eastl
 
 		enum
 		{
-			kBucketCount = bucketCount
+			kBucketCount   = bucketCount,
+			kFindBatchSize = 16         // Number of keys whose lookups find_batch overlaps.
 		};
 
 	protected:
@@ -414,6 +415,18 @@ namespace eastl
 		template <typename U>
 		const_iterator find_as(const U& u) const;
 
+		/// Looks up every key in [first, last) and writes the result of find(key) to out,
+		/// in the same order. Returns out past the last written iterator. As with
+		/// hashtable::find_batch, keys are hashed and their buckets and first nodes
+		/// prefetched kFindBatchSize at a time, so that their cache misses overlap.
+		/// ForwardIterator is read twice per batch, so it must be multi-pass.
+		///
+		template <typename ForwardIterator, typename OutputIterator>
+		OutputIterator find_batch(ForwardIterator first, ForwardIterator last, OutputIterator out);
+
+		template <typename ForwardIterator, typename OutputIterator>
+		OutputIterator find_batch(ForwardIterator first, ForwardIterator last, OutputIterator out) const;
+
 		size_type      count(const key_type& k) const;
 
 		// The use for equal_range in a hash_table seems somewhat questionable.
@@ -447,6 +460,9 @@ namespace eastl
 		template <typename U, typename BinaryPredicate>
 		node_type* DoFindNode(node_type* pNode, const U& u, BinaryPredicate predicate) const;
 
+		template <typename Iterator, typename ForwardIterator, typename OutputIterator>
+		OutputIterator DoFindBatch(ForwardIterator first, ForwardIterator last, OutputIterator out) const;
+
 	}; // class intrusive_hashtable
 
 
@@ -601,6 +617,60 @@ namespace eastl
 		//{ return find_as(other, eastl::hash<U>(), eastl::equal_to_2<const key_type, U>()); }
 
 
+	template <typename K, typename V, typename H, typename Eq, size_t bC, bool bM, bool bU>
+	template <typename ForwardIterator, typename OutputIterator>
+	inline OutputIterator
+	intrusive_hashtable<K, V, H, Eq, bC, bM, bU>::find_batch(ForwardIterator first, ForwardIterator last, OutputIterator out)
+	{
+		return DoFindBatch<iterator>(first, last, out);
+	}
+
+
+	template <typename K, typename V, typename H, typename Eq, size_t bC, bool bM, bool bU>
+	template <typename ForwardIterator, typename OutputIterator>
+	inline OutputIterator
+	intrusive_hashtable<K, V, H, Eq, bC, bM, bU>::find_batch(ForwardIterator first, ForwardIterator last, OutputIterator out) const
+	{
+		return DoFindBatch<const_iterator>(first, last, out);
+	}
+
+
+	template <typename K, typename V, typename H, typename Eq, size_t bC, bool bM, bool bU>
+	template <typename Iterator, typename ForwardIterator, typename OutputIterator>
+	OutputIterator
+	intrusive_hashtable<K, V, H, Eq, bC, bM, bU>::DoFindBatch(ForwardIterator first, ForwardIterator last, OutputIterator out) const
+	{
+		node_type** const pBucketArray = const_cast<node_type**>(mBucketArray);
+		size_type         bucketArray[kFindBatchSize];
+		node_type*        nodeArray[kFindBatchSize];
+
+		while(first != last)
+		{
+			size_type nCount = 0;
+
+			for(ForwardIterator it = first; (it != last) && (nCount < (size_type)kFindBatchSize); ++it, ++nCount)
+			{
+				bucketArray[nCount] = (size_type)(mHash(*it) % kBucketCount);
+				EASTL_PREFETCH(pBucketArray + bucketArray[nCount]);
+			}
+
+			for(size_type i = 0; i < nCount; ++i)
+			{
+				nodeArray[i] = pBucketArray[bucketArray[i]];
+				EASTL_PREFETCH(nodeArray[i]);
+			}
+
+			for(size_type i = 0; i < nCount; ++i, ++first, ++out)
+			{
+				node_type* const pNode = DoFindNode(nodeArray[i], *first);
+				*out = pNode ? Iterator(pNode, pBucketArray + bucketArray[i]) : Iterator(pBucketArray + kBucketCount);
+			}
+		}
+
+		return out;
+	}
+
+
 	template <typename K, typename V, typename H, typename Eq, size_t bC, bool bM, bool bU>
 	typename intrusive_hashtable<K, V, H, Eq, bC, bM, bU>::size_type
 	intrusive_hashtable<K, V, H, Eq, bC, bM, bU>::count(const key_type& k) const
@@ -3758,39 +3758,21 @@ namespace eastl
 	struct hash<string>
 	{
 		size_t operator()(const string& x) const
-		{
-			const unsigned char* p = (const unsigned char*)x.c_str(); // To consider: limit p to at most 256 chars.
-			unsigned int c, result = 2166136261U; // We implement an FNV-like string hash. 
-			while((c = *p++) != 0) // Using '!=' disables compiler warnings.
-				result = (result * 16777619) ^ c;
-			return (size_t)result;
-		}
+			{ return Internal::hash_chars(x.data(), (size_t)x.size()); }
 	};
 
 	template <>
 	struct hash<string16>
 	{
 		size_t operator()(const string16& x) const
-		{
-			const char16_t* p = x.c_str();
-			unsigned int c, result = 2166136261U;
-			while((c = *p++) != 0)
-				result = (result * 16777619) ^ c;
-			return (size_t)result;
-		}
+			{ return Internal::hash_chars(x.data(), (size_t)x.size()); }
 	};
 
 	template <>
 	struct hash<string32>
 	{
 		size_t operator()(const string32& x) const
-		{
-			const char32_t* p = x.c_str();
-			unsigned int c, result = 2166136261U;
-			while((c = (unsigned int)*p++) != 0)
-				result = (result * 16777619) ^ c;
-			return (size_t)result;
-		}
+			{ return Internal::hash_chars(x.data(), (size_t)x.size()); }
 	};
 
 	#if defined(EA_WCHAR_UNIQUE) && EA_WCHAR_UNIQUE
@@ -3798,13 +3780,7 @@ namespace eastl
 		struct hash<wstring>
 		{
 			size_t operator()(const wstring& x) const
-			{
-				const wchar_t* p = x.c_str();
-				unsigned int c, result = 2166136261U;
-				while((c = (unsigned int)*p++) != 0)
-					result = (result * 16777619) ^ c;
-				return (size_t)result;
-			}
+				{ return Internal::hash_chars(x.data(), (size_t)x.size()); }
 		};
 	#endif
 
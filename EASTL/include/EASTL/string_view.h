@@ -16,6 +16,7 @@ EA_ONCE()
 
 #include <EASTL/internal/config.h>
 #include <EASTL/internal/char_traits.h>
+#include <EASTL/functional.h>
 #include <EASTL/numeric_limits.h>
 
 EA_DISABLE_VC_WARNING(4814)
@@ -457,50 +458,26 @@ namespace eastl
 	template<> struct hash<string_view>
 	{
 		size_t operator()(const string_view& x) const
-		{
-			const unsigned char* p = (const unsigned char*)x.data(); // To consider: limit p to at most 256 chars.
-			unsigned int c, result = 2166136261U; // We implement an FNV-like string hash. 
-			while((c = *p++) != 0) // Using '!=' disables compiler warnings.
-				result = (result * 16777619) ^ c;
-			return (size_t)result;
-		}
+			{ return Internal::hash_chars(x.data(), (size_t)x.size()); }
 	};
 
 	template<> struct hash<u16string_view>
 	{
 		size_t operator()(const u16string_view& x) const
-		{
-			const char16_t* p = x.data();
-			unsigned int c, result = 2166136261U;
-			while((c = *p++) != 0)
-				result = (result * 16777619) ^ c;
-			return (size_t)result;
-		}
+			{ return Internal::hash_chars(x.data(), (size_t)x.size()); }
 	};
 
 	template<> struct hash<u32string_view>
 	{
 		size_t operator()(const u32string_view& x) const
-		{
-			const char32_t* p = x.data();
-			unsigned int c, result = 2166136261U;
-			while((c = (unsigned int)*p++) != 0)
-				result = (result * 16777619) ^ c;
-			return (size_t)result;
-		}
+			{ return Internal::hash_chars(x.data(), (size_t)x.size()); }
 	};
 
 	#if defined(EA_WCHAR_UNIQUE) && EA_WCHAR_UNIQUE
 		template<> struct hash<wstring_view>
 		{
 			size_t operator()(const wstring_view& x) const
-			{
-				const wchar_t* p = x.data();
-				unsigned int c, result = 2166136261U;
-				while((c = (unsigned int)*p++) != 0)
-					result = (result * 16777619) ^ c;
-				return (size_t)result;
-			}
+				{ return Internal::hash_chars(x.data(), (size_t)x.size()); }
 		};
 	#endif
 
@@ -4,6 +4,7 @@
 
 
 #include <EASTL/internal/hashtable.h>
+#include <EASTL/internal/flat_hashtable.h>
 #include <EASTL/utility.h>
 #include <math.h>  // Not all compilers support <cmath> and std::ceilf(), which we need below.
 #include <stddef.h>
@@ -26,6 +27,14 @@ namespace eastl
 	EASTL_API void* gpEmptyBucketArray[2] = { NULL, (void*)uintptr_t(~0) };
 
 
+	/// gFlatHashEmptyCtrl
+	///
+	/// The control bytes of an empty flat_hashtable. It has no slot, so it holds only
+	/// the trailing sentinels, enough of them for a full group load of any width.
+	///
+	EASTL_API const int8_t gFlatHashEmptyCtrl[16] = { -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 };
+
+
 
 	/// gPrimeNumberArray
 	///
@@ -174,6 +183,115 @@ namespace eastl
 	}
 
 
+
+
+	/// kMaxPowerOfTwoBucketCount
+	///
+	/// The largest bucket count of power_of_two_rehash_policy.
+	///
+	const uint32_t kMaxPowerOfTwoBucketCount = UINT32_C(0x80000000);
+
+
+	/// RoundUpPowerOfTwoBucketCount
+	/// Return the smallest power of two that is >= nBucketCount, and at least 2.
+	///
+	static uint32_t RoundUpPowerOfTwoBucketCount(uint32_t nBucketCount)
+	{
+		if(nBucketCount > kMaxPowerOfTwoBucketCount)
+			return kMaxPowerOfTwoBucketCount;
+
+		uint32_t n = 2;
+		while(n < nBucketCount)
+			n <<= 1;
+		return n;
+	}
+
+
+	/// GetPrevBucketCountOnly
+	/// Return a bucket count no greater than nBucketCountHint.
+	///
+	uint32_t power_of_two_rehash_policy::GetPrevBucketCountOnly(uint32_t nBucketCountHint)
+	{
+		uint32_t n = 2;
+		while((n < kMaxPowerOfTwoBucketCount) && ((n << 1) <= nBucketCountHint))
+			n <<= 1;
+		return n;
+	}
+
+
+	/// GetPrevBucketCount
+	/// Return a bucket count no greater than nBucketCountHint.
+	/// This function has a side effect of updating mnNextResize.
+	///
+	uint32_t power_of_two_rehash_policy::GetPrevBucketCount(uint32_t nBucketCountHint) const
+	{
+		const uint32_t n = GetPrevBucketCountOnly(nBucketCountHint);
+
+		mnNextResize = (uint32_t)ceilf(n * mfMaxLoadFactor);
+		return n;
+	}
+
+
+	/// GetNextBucketCount
+	/// Return a power of two no smaller than nBucketCountHint.
+	/// This function has a side effect of updating mnNextResize.
+	///
+	uint32_t power_of_two_rehash_policy::GetNextBucketCount(uint32_t nBucketCountHint) const
+	{
+		const uint32_t n = RoundUpPowerOfTwoBucketCount(nBucketCountHint);
+
+		mnNextResize = (uint32_t)ceilf(n * mfMaxLoadFactor);
+		return n;
+	}
+
+
+	/// GetBucketCount
+	/// Return the smallest power of two n such that alpha n >= nElementCount, where alpha 
+	/// is the load factor. This function has a side effect of updating mnNextResize.
+	///
+	uint32_t power_of_two_rehash_policy::GetBucketCount(uint32_t nElementCount) const
+	{
+		const uint32_t nMinBucketCount = (uint32_t)(nElementCount / mfMaxLoadFactor);
+		const uint32_t n               = RoundUpPowerOfTwoBucketCount(nMinBucketCount);
+
+		mnNextResize = (uint32_t)ceilf(n * mfMaxLoadFactor);
+		return n;
+	}
+
+
+	/// GetRehashRequired
+	/// Same as prime_rehash_policy::GetRehashRequired, but rounds the new bucket count
+	/// up to a power of two instead of a prime.
+	///
+	eastl::pair<bool, uint32_t>
+	power_of_two_rehash_policy::GetRehashRequired(uint32_t nBucketCount, uint32_t nElementCount, uint32_t nElementAdd) const
+	{
+		if((nElementCount + nElementAdd) > mnNextResize) // It is significant that we specify > next resize and not >= next resize.
+		{
+			if(nBucketCount == 1) // We force rehashing to occur if the bucket count is < 2.
+				nBucketCount = 0;
+
+			float fMinBucketCount = (nElementCount + nElementAdd) / mfMaxLoadFactor;
+
+			if(fMinBucketCount > (float)nBucketCount)
+			{
+				fMinBucketCount  = eastl::max_alt(fMinBucketCount, mfGrowthFactor * nBucketCount);
+				const uint32_t n = RoundUpPowerOfTwoBucketCount((uint32_t)fMinBucketCount);
+				mnNextResize     = (uint32_t)ceilf(n * mfMaxLoadFactor);
+
+				return eastl::pair<bool, uint32_t>(true, n);
+			}
+			else
+			{
+				mnNextResize = (uint32_t)ceilf(nBucketCount * mfMaxLoadFactor);
+				return eastl::pair<bool, uint32_t>(false, (uint32_t)0);
+			}
+		}
+
+		return eastl::pair<bool, uint32_t>(false, (uint32_t)0);
+	}
+
+
 } // namespace eastl
 
 
@@ -63,6 +63,7 @@ int TestSet();
 int TestFixedSet();
 int TestHash();
 int TestFixedHash();
+int TestFlatHash();
 int TestStringHashMap();
 int TestIntrusiveHash();
 int TestVectorMap();
@@ -136,6 +136,11 @@ template class eastl::fixed_hash_map<A, A, 1, 2, true, eastl::hash<A>, eastl::eq
 template class eastl::fixed_hash_multiset<A, 1, 2, true, eastl::hash<A>, eastl::equal_to<A>, false, MallocAllocator>;
 template class eastl::fixed_hash_multimap<A, A, 1, 2, true, eastl::hash<A>, eastl::equal_to<A>, false, MallocAllocator>;
 
+template class eastl::fixed_hash_set<int, 1, 2, true, eastl::power_of_two_hash<int> >;
+template class eastl::fixed_hash_map<int, int, 1, 2, true, eastl::power_of_two_hash<int> >;
+template class eastl::fixed_hash_multiset<int, 1, 2, true, eastl::power_of_two_hash<int> >;
+template class eastl::fixed_hash_multimap<int, int, 1, 2, true, eastl::power_of_two_hash<int> >;
+
 
 EA_DISABLE_VC_WARNING(6262)
 int TestFixedHash()
@@ -622,6 +627,25 @@ int TestFixedHash()
 		#endif
 	}
 
+	{
+		// power_of_two_hash
+		// The fixed bucket count is rounded down to a power of two instead of a prime.
+		typedef fixed_hash_map<uint32_t, int, 100, 101, false, power_of_two_hash<uint32_t> > Pow2FixedHashMap;
+
+		Pow2FixedHashMap hashMap;
+		EATEST_VERIFY(hashMap.bucket_count() == 64);
+
+		for(uint32_t i = 0; i < 100; i++)
+			hashMap.insert(Pow2FixedHashMap::value_type(i * 64, (int)i));
+
+		EATEST_VERIFY(hashMap.validate());
+		EATEST_VERIFY(hashMap.size() == 100);
+		EATEST_VERIFY(hashMap.bucket_count() == 64); // Overflow is disabled, so it never rehashes.
+
+		for(uint32_t i = 0; i < 100; i++)
+			EATEST_VERIFY(hashMap.find(i * 64) != hashMap.end());
+	}
+
 	return nErrorCount;
 }
 EA_RESTORE_VC_WARNING()
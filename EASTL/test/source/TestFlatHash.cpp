@@ -0,0 +1,373 @@
+/////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+
+#include "EASTLTest.h"
+#include "TestMap.h"
+#include "TestSet.h"
+#include <EASTL/flat_hash_set.h>
+#include <EASTL/flat_hash_map.h>
+#include <EASTL/hash_map.h>
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+
+
+using namespace eastl;
+
+
+namespace
+{
+	// Every key collides, which makes a single cluster that runs past the last bucket.
+	struct ConstantHash
+	{
+		size_t operator()(int) const
+			{ return 7; }
+	};
+
+	struct Align32Hash
+	{
+		size_t operator()(const Align32& a32) const
+			{ return static_cast<size_t>(a32.mX); }
+	};
+}
+
+
+int TestFlatHash()
+{
+	int nErrorCount = 0;
+
+	{   // Test declarations
+		flat_hash_set<int>      hashSet;
+		flat_hash_map<int, int> hashMap;
+
+		flat_hash_set<int> hashSet2(hashSet);
+		EATEST_VERIFY(hashSet2.size() == hashSet.size());
+		EATEST_VERIFY(hashSet2 == hashSet);
+
+		flat_hash_map<int, int> hashMap2(hashMap);
+		EATEST_VERIFY(hashMap2.size() == hashMap.size());
+		EATEST_VERIFY(hashMap2 == hashMap);
+
+		// allocator_type& get_allocator();
+		// void            set_allocator(const allocator_type& allocator);
+		flat_hash_set<int>::allocator_type& allocator = hashSet.get_allocator();
+		hashSet.set_allocator(EASTLAllocatorType());
+		hashSet.set_allocator(allocator);
+
+		// const key_equal& key_eq() const;
+		// key_equal&       key_eq();
+		flat_hash_set<int>       hs;
+		const flat_hash_set<int> hsc;
+
+		const flat_hash_set<int>::key_equal& ke = hsc.key_eq();
+		hs.key_eq() = ke;
+
+		#if EASTL_NAME_ENABLED
+			hashMap.get_allocator().set_name("test");
+			const char* pName = hashMap.get_allocator().get_name();
+			EATEST_VERIFY(equal(pName, pName + 5, "test"));
+		#endif
+	}
+
+
+	{   // An empty container doesn't allocate, and clear(true) goes back to that state.
+		flat_hash_set<int> hashSet;
+
+		EATEST_VERIFY(hashSet.validate());
+		EATEST_VERIFY(hashSet.bucket_count() == 0);
+		EATEST_VERIFY(hashSet.begin() == hashSet.end());
+		EATEST_VERIFY(hashSet.find(3) == hashSet.end());
+		EATEST_VERIFY(hashSet.erase(3) == 0);
+
+		hashSet.clear(true);
+		EATEST_VERIFY(hashSet.validate());
+
+		for(int i = 0; i < 100; ++i)
+			hashSet.insert(i);
+		EATEST_VERIFY(hashSet.validate());
+		EATEST_VERIFY(hashSet.size() == 100);
+		EATEST_VERIFY((hashSet.bucket_count() & (hashSet.bucket_count() - 1)) == 0);
+		EATEST_VERIFY(hashSet.load_factor() <= hashSet.get_max_load_factor());
+
+		hashSet.clear();
+		EATEST_VERIFY(hashSet.validate());
+		EATEST_VERIFY(hashSet.size() == 0);
+		EATEST_VERIFY(hashSet.bucket_count() != 0);
+
+		hashSet.clear(true);
+		EATEST_VERIFY(hashSet.validate());
+		EATEST_VERIFY(hashSet.size() == 0);
+		EATEST_VERIFY(hashSet.bucket_count() == 0);
+	}
+
+
+	{   // Test flat_hash_map against hash_map, with a mix of insertions and erasures.
+		typedef flat_hash_map<int, int> FlatMap;
+		typedef hash_map<int, int>      RefMap;
+
+		FlatMap  flatMap;
+		RefMap   refMap;
+		uint32_t nSeed = 12345;
+
+		for(int i = 0; i < 20000; ++i)
+		{
+			nSeed = (nSeed * 1103515245u) + 12345u;
+			const int key = (int)((nSeed >> 8) % 4096);
+
+			if(nSeed & 0x40000000)
+			{
+				const FlatMap::insert_return_type result = flatMap.insert(FlatMap::value_type(key, i));
+				EATEST_VERIFY(result.second == refMap.insert(RefMap::value_type(key, i)).second);
+				EATEST_VERIFY(result.first->first == key);
+			}
+			else
+				EATEST_VERIFY(flatMap.erase(key) == refMap.erase(key));
+
+			if((i % 1000) == 0)
+				EATEST_VERIFY(flatMap.validate());
+		}
+
+		EATEST_VERIFY(flatMap.validate());
+		EATEST_VERIFY(flatMap.size() == refMap.size());
+
+		for(int key = 0; key < 4096; ++key)
+		{
+			const FlatMap::const_iterator it = flatMap.find(key);
+			const RefMap::const_iterator  itRef = refMap.find(key);
+
+			EATEST_VERIFY(flatMap.count(key) == refMap.count(key));
+			EATEST_VERIFY((it == flatMap.end()) == (itRef == refMap.end()));
+			if((it != flatMap.end()) && (itRef != refMap.end()))
+				EATEST_VERIFY(it->second == itRef->second);
+		}
+
+		size_t nIterated = 0;
+		for(FlatMap::iterator it = flatMap.begin(); it != flatMap.end(); ++it, ++nIterated)
+			EATEST_VERIFY(refMap.find(it->first) != refMap.end());
+		EATEST_VERIFY(nIterated == flatMap.size());
+	}
+
+
+	{   // Erase while iterating visits every element once, even though erasures shift elements back.
+		flat_hash_map<int, int> hashMap;
+		vector<int>             visited(2000, 0);
+
+		for(int i = 0; i < 2000; ++i)
+			hashMap[i] = i;
+
+		for(flat_hash_map<int, int>::iterator it = hashMap.begin(); it != hashMap.end(); )
+		{
+			++visited[it->first];
+
+			if(it->first % 3)
+				it = hashMap.erase(it);
+			else
+				++it;
+		}
+
+		EATEST_VERIFY(hashMap.validate());
+		EATEST_VERIFY(hashMap.size() == 667);
+		EATEST_VERIFY(eastl::count(visited.begin(), visited.end(), 1) == 2000);
+
+		for(int i = 0; i < 2000; ++i)
+			EATEST_VERIFY(hashMap.count(i) == ((i % 3) ? 0u : 1u));
+
+		// iterator erase(const_iterator first, const_iterator last);
+		flat_hash_map<int, int>::iterator itFirst = hashMap.begin();
+		flat_hash_map<int, int>::iterator itLast  = hashMap.begin();
+		eastl::advance(itFirst, 100);
+		eastl::advance(itLast, 400);
+
+		const int nLastKey = itLast->first;
+		vector<int> erasedKeys;
+		for(flat_hash_map<int, int>::iterator it = itFirst; it != itLast; ++it)
+			erasedKeys.push_back(it->first);
+
+		flat_hash_map<int, int>::iterator itNext = hashMap.erase(itFirst, itLast);
+		EATEST_VERIFY(hashMap.validate());
+		EATEST_VERIFY(hashMap.size() == 367);
+		EATEST_VERIFY(itNext != hashMap.end());
+		EATEST_VERIFY(hashMap.find(nLastKey) != hashMap.end());
+
+		for(eastl_size_t i = 0; i < erasedKeys.size(); ++i)
+			EATEST_VERIFY(hashMap.find(erasedKeys[i]) == hashMap.end());
+
+		hashMap.erase(hashMap.begin(), hashMap.end());
+		EATEST_VERIFY(hashMap.validate());
+		EATEST_VERIFY(hashMap.empty());
+	}
+
+
+	{   // Test operator[], at, insert(key), equal_range.
+		flat_hash_map<int, int> hashMap;
+
+		hashMap[3] = 30;
+		hashMap[4] = 40;
+		EATEST_VERIFY(hashMap[3] == 30);
+		EATEST_VERIFY(hashMap.at(4) == 40);
+		EATEST_VERIFY(hashMap.size() == 2);
+
+		flat_hash_map<int, int>::insert_return_type result = hashMap.insert(5);
+		EATEST_VERIFY(result.second && (result.first->second == 0));
+		result = hashMap.insert(3);
+		EATEST_VERIFY(!result.second && (result.first->second == 30));
+
+		eastl::pair<flat_hash_map<int, int>::iterator, flat_hash_map<int, int>::iterator> range = hashMap.equal_range(4);
+		EATEST_VERIFY((eastl::distance(range.first, range.second) == 1) && (range.first->second == 40));
+		range = hashMap.equal_range(9);
+		EATEST_VERIFY((range.first == hashMap.end()) && (range.second == hashMap.end()));
+
+		#if EASTL_EXCEPTIONS_ENABLED
+			bool bThrown = false;
+			try
+			{
+				hashMap.at(9);
+			}
+			catch(std::out_of_range&)
+			{
+				bThrown = true;
+			}
+			EATEST_VERIFY(bThrown);
+		#endif
+	}
+
+
+	{   // Test construction, assignment and swap.
+		flat_hash_map<int, int> hashMapA = { {1, 10}, {2, 20}, {3, 30} };
+		EATEST_VERIFY(hashMapA.size() == 3);
+		EATEST_VERIFY(hashMapA[2] == 20);
+
+		flat_hash_map<int, int> hashMapB(hashMapA.begin(), hashMapA.end());
+		EATEST_VERIFY(hashMapB == hashMapA);
+
+		hashMapB[4] = 40;
+		EATEST_VERIFY(hashMapB != hashMapA);
+
+		flat_hash_map<int, int> hashMapC(eastl::move(hashMapB));
+		EATEST_VERIFY(hashMapC.size() == 4);
+		EATEST_VERIFY(hashMapB.empty() && hashMapB.validate());
+
+		hashMapB = hashMapC;
+		EATEST_VERIFY(hashMapB == hashMapC);
+
+		hashMapC = { {5, 50} };
+		EATEST_VERIFY((hashMapC.size() == 1) && (hashMapC[5] == 50));
+
+		hashMapA.swap(hashMapC);
+		EATEST_VERIFY((hashMapA.size() == 1) && (hashMapC.size() == 3));
+
+		hashMapA = eastl::move(hashMapC);
+		EATEST_VERIFY((hashMapA.size() == 3) && hashMapA.validate());
+
+		flat_hash_set<int> hashSet = { 3, 4, 5, 4 };
+		EATEST_VERIFY(hashSet.size() == 3);
+		EATEST_VERIFY((hashSet.count(4) == 1) && (hashSet.count(6) == 0));
+	}
+
+
+	{   // Test rehash, reserve and set_max_load_factor.
+		flat_hash_set<int> hashSet(100);
+		EATEST_VERIFY(hashSet.bucket_count() == 128);
+
+		hashSet.reserve(1000);
+		const flat_hash_set<int>::size_type nBucketCount = hashSet.bucket_count();
+		for(int i = 0; i < 1000; ++i)
+			hashSet.insert(i);
+		EATEST_VERIFY(hashSet.bucket_count() == nBucketCount);
+		EATEST_VERIFY(hashSet.validate());
+
+		hashSet.set_max_load_factor(0.5f);
+		EATEST_VERIFY(hashSet.load_factor() <= 0.5f);
+		EATEST_VERIFY(hashSet.validate());
+
+		hashSet.rehash(1 << 14);
+		EATEST_VERIFY(hashSet.bucket_count() == (1 << 14));
+		EATEST_VERIFY(hashSet.validate() && (hashSet.size() == 1000));
+
+		hashSet.rehash(0); // Shrinks to the smallest bucket count which fits the elements.
+		EATEST_VERIFY(hashSet.bucket_count() == 2048);
+		EATEST_VERIFY(hashSet.validate() && (hashSet.size() == 1000));
+	}
+
+
+	{   // Test a hash function without any distribution. The overflow area grows instead of the bucket array.
+		flat_hash_set<int, ConstantHash> hashSet;
+
+		for(int i = 0; i < 200; ++i)
+			hashSet.insert(i);
+
+		EATEST_VERIFY(hashSet.validate());
+		EATEST_VERIFY(hashSet.size() == 200);
+		EATEST_VERIFY(hashSet.bucket_count() <= 256);
+
+		for(int i = 0; i < 200; i += 2)
+			hashSet.erase(i);
+
+		EATEST_VERIFY(hashSet.validate());
+		for(int i = 0; i < 200; ++i)
+			EATEST_VERIFY(hashSet.count(i) == (eastl_size_t)(i & 1));
+	}
+
+
+	{   // Test find_as with string keys.
+		flat_hash_map<string, int> hashMap;
+
+		hashMap["alpha"] = 1;
+		hashMap["beta"]  = 2;
+		hashMap[string("gamma")] = 3;
+
+		flat_hash_map<string, int>::iterator it = hashMap.find_as("beta");
+		EATEST_VERIFY((it != hashMap.end()) && (it->second == 2));
+
+		it = hashMap.find_as("gamma", eastl::hash<const char*>(), eastl::equal_to_2<const string, const char*>());
+		EATEST_VERIFY((it != hashMap.end()) && (it->second == 3));
+
+		EATEST_VERIFY(hashMap.find_as("delta") == hashMap.end());
+
+		flat_hash_set<string> hashSet;
+		hashSet.insert(string("hello"));
+		EATEST_VERIFY(hashSet.find_as("hello") != hashSet.end());
+		EATEST_VERIFY(hashSet.find_as("world") == hashSet.end());
+	}
+
+
+	{   // Test elements with alignment requirements.
+		flat_hash_set<Align32, Align32Hash> hashSet;
+
+		for(int i = 0; i < 100; ++i)
+			hashSet.insert(Align32(i));
+
+		for(flat_hash_set<Align32, Align32Hash>::const_iterator it = hashSet.begin(); it != hashSet.end(); ++it)
+			EATEST_VERIFY(((uintptr_t)&*it % kEASTLTestAlign32) == 0);
+	}
+
+
+	{   // Test that elements are constructed and destroyed in pairs, through rehashes and erasures.
+		TestObject::Reset();
+		{
+			flat_hash_map<int, TestObject> hashMap;
+
+			for(int i = 0; i < 1000; ++i)
+				hashMap.insert(flat_hash_map<int, TestObject>::value_type(i, TestObject(i)));
+
+			for(int i = 0; i < 1000; i += 2)
+				hashMap.erase(i);
+
+			flat_hash_map<int, TestObject> hashMap2(hashMap);
+			EATEST_VERIFY(hashMap2 == hashMap);
+			hashMap.clear();
+			EATEST_VERIFY(hashMap2.at(501).mX == 501);
+		}
+		EATEST_VERIFY(TestObject::IsClear());
+		TestObject::Reset();
+	}
+
+
+	{   // C++11 emplace and related functionality
+		nErrorCount += TestMapCpp11<eastl::flat_hash_map<int, TestObject>>();
+		nErrorCount += TestSetCpp11<eastl::flat_hash_set<TestObject>>();
+	}
+
+	return nErrorCount;
+}
@@ -11,6 +11,9 @@
 #include <EASTL/hash_set.h>
 #include <EASTL/set.h>
 #include <EASTL/list.h>
+#include <EASTL/string.h>
+#include <EASTL/string_view.h>
+#include <EASTL/fixed_string.h>
 #include <EAStdC/EAString.h>
 
 
@@ -356,6 +359,54 @@ int TestFunctional()
 		EATEST_VERIFY(hs16.empty());
 	}
 
+	{
+		// string hashes
+		// hash<char*>, hash<string>, hash<string_view>, hash<fixed_string> and string_hash
+		// must agree for the same characters, whatever EASTL_STRING_OPT_FAST_HASH is.
+		char buffer[320];
+		for(int i = 0; i < (int)sizeof(buffer); i++)
+			buffer[i] = (char)('a' + (i % 26));
+
+		size_t nPrevHash = 0;
+
+		for(eastl_size_t n = 0; n < 300; n = (n < 20) ? (n + 1) : (n + 7))
+		{
+			const eastl::string str(buffer, n);
+			const eastl::string_view sv(buffer, n); // Not 0-terminated, the hash must not read past n.
+			const eastl::fixed_string<char, 64> fs(buffer, n);
+			const String8MA s8(buffer, n);
+
+			const size_t h = eastl::hash<const char*>()(str.c_str());
+			EATEST_VERIFY(eastl::hash<char*>()((char*)str.c_str()) == h);
+			EATEST_VERIFY(eastl::hash<eastl::string>()(str) == h);
+			EATEST_VERIFY(eastl::hash<eastl::string_view>()(sv) == h);
+			EATEST_VERIFY((eastl::hash<eastl::fixed_string<char, 64> >()(fs) == h));
+			EATEST_VERIFY(eastl::string_hash<String8MA>()(s8) == h);
+			EATEST_VERIFY((n == 0) || (h != nPrevHash)); // Prefixes of each other, but they should still hash differently.
+			nPrevHash = h;
+
+			const eastl::string16 str16(n, (char16_t)'x');
+			EATEST_VERIFY(eastl::hash<const char16_t*>()(str16.c_str()) == eastl::hash<eastl::string16>()(str16));
+			EATEST_VERIFY(eastl::hash<eastl::u16string_view>()(eastl::u16string_view(str16.data(), str16.size())) == eastl::hash<eastl::string16>()(str16));
+
+			const eastl::string32 str32(n, (char32_t)'x');
+			EATEST_VERIFY(eastl::hash<const char32_t*>()(str32.c_str()) == eastl::hash<eastl::string32>()(str32));
+		}
+
+		// A single differing byte anywhere in a long string changes the hash.
+		const eastl::string strLong(buffer, 257);
+		for(eastl_size_t i = 0; i < strLong.size(); i += 16)
+		{
+			eastl::string strCopy(strLong);
+			strCopy[i] = '#';
+			EATEST_VERIFY(eastl::hash<eastl::string>()(strCopy) != eastl::hash<eastl::string>()(strLong));
+		}
+
+		hash_set<eastl::fixed_string<char, 16> > fixedStringSet;
+		fixedStringSet.insert(eastl::fixed_string<char, 16>("hello"));
+		EATEST_VERIFY(fixedStringSet.find_as("hello") != fixedStringSet.end());
+	}
+
 	{
 		// unary_compose
 		/*
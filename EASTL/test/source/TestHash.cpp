@@ -134,6 +134,10 @@ template class eastl::hash_set<Align32>;
 template class eastl::hash_multiset<Align32>;
 template class eastl::hash_map<Align32, Align32>;
 template class eastl::hash_multimap<Align32, Align32>;
+template class eastl::hash_set<int, eastl::power_of_two_hash<int> >;
+template class eastl::hash_map<int, int, eastl::power_of_two_hash<int>, eastl::equal_to<int>, eastl::allocator, true>;
+template class eastl::hash_map<int, int, eastl::incremental_rehash_hash<int> >;
+template class eastl::hash_multiset<int, eastl::incremental_rehash_hash<int> >;
 
 // validate static assumptions about hashtable core types
 typedef eastl::hash_node<int, false> HashNode1;
@@ -1305,6 +1309,227 @@ int TestHash()
 		#endif
 	}
 
+	{
+		// template <typename ForwardIterator, typename OutputIterator>
+		// OutputIterator find_batch(ForwardIterator first, ForwardIterator last, OutputIterator out);
+		// template <typename ForwardIterator, typename OutputIterator>
+		// OutputIterator find_batch(ForwardIterator first, ForwardIterator last, OutputIterator out) const;
+		typedef hash_map<int, int> HashMapIntInt;
+
+		HashMapIntInt hashMap;
+		vector<int>   keyArray;
+
+		for(int i = 0; i < 1000; i++)
+		{
+			if((i % 3) != 0)
+				hashMap[i] = i * 2;
+			keyArray.push_back(i);
+			keyArray.push_back(-i); // Mostly misses.
+		}
+
+		for(eastl_size_t nCount = 0; nCount < 100; nCount = (nCount * 2) + 1) // Batch counts which aren't multiples of kFindBatchSize.
+		{
+			vector<HashMapIntInt::iterator> results(nCount + 1, hashMap.begin());
+			vector<HashMapIntInt::iterator>::iterator itEnd = hashMap.find_batch(keyArray.begin(), keyArray.begin() + nCount, results.begin());
+
+			EATEST_VERIFY(itEnd == results.begin() + nCount);
+			EATEST_VERIFY(results[nCount] == hashMap.begin()); // Verify nothing was written past the end.
+
+			for(eastl_size_t i = 0; i < nCount; i++)
+				EATEST_VERIFY(results[i] == hashMap.find(keyArray[i]));
+		}
+
+		const HashMapIntInt& hashMapConst = hashMap;
+		vector<HashMapIntInt::const_iterator> constResults(keyArray.size());
+		hashMapConst.find_batch(keyArray.begin(), keyArray.end(), constResults.begin());
+
+		for(eastl_size_t i = 0; i < keyArray.size(); i++)
+		{
+			EATEST_VERIFY(constResults[i] == hashMapConst.find(keyArray[i]));
+			if(constResults[i] != hashMapConst.end())
+				EATEST_VERIFY(constResults[i]->second == (keyArray[i] * 2));
+		}
+
+		HashMapIntInt hashMapEmpty;
+		vector<HashMapIntInt::iterator> emptyResults(keyArray.size());
+		hashMapEmpty.find_batch(keyArray.begin(), keyArray.end(), emptyResults.begin());
+		EATEST_VERIFY(eastl::count(emptyResults.begin(), emptyResults.end(), hashMapEmpty.end()) == (ptrdiff_t)keyArray.size());
+
+		// Keys of another type, converted to key_type.
+		hash_multiset<string> stringSet;
+		stringSet.insert(string("a"));
+		stringSet.insert(string("b"));
+		stringSet.insert(string("b"));
+		const char* const pKeyArray[3] = { "b", "c", "a" };
+		hash_multiset<string>::iterator stringResults[3];
+		stringSet.find_batch(pKeyArray, pKeyArray + 3, stringResults);
+		EATEST_VERIFY((stringResults[0] != stringSet.end()) && (*stringResults[0] == "b"));
+		EATEST_VERIFY(stringResults[1] == stringSet.end());
+		EATEST_VERIFY((stringResults[2] != stringSet.end()) && (*stringResults[2] == "a"));
+	}
+
+	{
+		// power_of_two_hash / power_of_two_rehash_policy
+		typedef hash_map<uint32_t, int, power_of_two_hash<uint32_t> > Pow2HashMap;
+
+		static_assert(eastl::is_same<hash_map<uint32_t, int>::rehash_policy_type, prime_rehash_policy>::value, "hash_rehash_policy error");
+		static_assert(eastl::is_same<Pow2HashMap::rehash_policy_type, power_of_two_rehash_policy>::value, "hash_rehash_policy error");
+		static_assert(eastl::is_same<Pow2HashMap::h2_type, fast_range_hashing>::value, "hash_rehash_policy error");
+
+		for(uint32_t n = 1; n < 100000; n = (n * 3) + 1)
+		{
+			const uint32_t r = fast_range_hashing()(n * 2654435761u, n);
+			EATEST_VERIFY(r < n);
+		}
+
+		Pow2HashMap hashMap;
+		const uint32_t kCount = 10000;
+
+		// Keys that are multiples of the bucket count, which the identity hash<uint32_t> alone would put in a single bucket.
+		for(uint32_t i = 0; i < kCount; i++)
+			hashMap[i * 4096] = (int)i;
+
+		EATEST_VERIFY(hashMap.validate());
+		EATEST_VERIFY(hashMap.size() == kCount);
+		EATEST_VERIFY((hashMap.bucket_count() & (hashMap.bucket_count() - 1)) == 0);
+		EATEST_VERIFY(hashMap.load_factor() <= hashMap.get_max_load_factor());
+
+		Pow2HashMap::size_type nMaxBucketSize = 0;
+		for(Pow2HashMap::size_type n = 0; n < hashMap.bucket_count(); n++)
+			nMaxBucketSize = eastl::max_alt(nMaxBucketSize, hashMap.bucket_size(n));
+		EATEST_VERIFY(nMaxBucketSize < 16);
+
+		for(uint32_t i = 0; i < kCount; i++)
+		{
+			Pow2HashMap::iterator it = hashMap.find(i * 4096);
+			EATEST_VERIFY((it != hashMap.end()) && (it->second == (int)i));
+		}
+
+		for(uint32_t i = 0; i < kCount; i += 2)
+			hashMap.erase(i * 4096);
+		EATEST_VERIFY(hashMap.validate());
+		EATEST_VERIFY(hashMap.size() == (kCount / 2));
+
+		// An explicit rehash uses the given count even if it's not a power of two.
+		hashMap.rehash(1000);
+		EATEST_VERIFY(hashMap.bucket_count() == 1000);
+		EATEST_VERIFY(hashMap.validate());
+		for(uint32_t i = 1; i < kCount; i += 2)
+			EATEST_VERIFY(hashMap.find(i * 4096) != hashMap.end());
+
+		hashMap.set_max_load_factor(0.5f);
+		EATEST_VERIFY(hashMap.get_max_load_factor() == 0.5f);
+		hashMap.reserve(kCount);
+		EATEST_VERIFY(hashMap.bucket_count() == 32768);
+		EATEST_VERIFY(hashMap.validate());
+
+		Pow2HashMap hashMapCopy(hashMap);
+		EATEST_VERIFY(hashMapCopy == hashMap);
+		hashMap.clear(true);
+		EATEST_VERIFY(hashMap.validate());
+		EATEST_VERIFY(hashMap.empty());
+
+		hash_set<string, power_of_two_hash<string> > stringSet(3);
+		EATEST_VERIFY(stringSet.bucket_count() == 4);
+		stringSet.insert(string("hello"));
+		stringSet.insert(string("world"));
+		EATEST_VERIFY(stringSet.find_as("hello") != stringSet.end());
+		EATEST_VERIFY(stringSet.find_as("world") != stringSet.end());
+		EATEST_VERIFY(stringSet.find_as("nope") == stringSet.end());
+	}
+
+	{
+		// incremental_rehash_hash / incremental_rehash_policy
+		typedef hash_map<int, int, incremental_rehash_hash<int> >      IncHashMap;
+		typedef hash_multimap<int, int, incremental_rehash_hash<int> > IncHashMultiMap;
+
+		static_assert(eastl::is_same<IncHashMap::rehash_policy_type, incremental_rehash_policy>::value, "hash_rehash_policy error");
+
+		IncHashMap hashMap;
+		IncHashMultiMap hashMultiMap;
+		const int kCount = 20000;
+		int nMigratingCount = 0;
+
+		for(int i = 0; i < kCount; i++)
+		{
+			hashMap[i] = i;
+			hashMultiMap.insert(eastl::make_pair(i % 1000, i));
+
+			// While buckets are being migrated, the bucket interface sees only the ones that were moved to the new array.
+			IncHashMap::size_type nBucketElementCount = 0;
+			for(IncHashMap::size_type n = 0; n < hashMap.bucket_count(); n++)
+				nBucketElementCount += hashMap.bucket_size(n);
+
+			if(nBucketElementCount < hashMap.size())
+			{
+				if((nMigratingCount++ % 64) == 0)
+				{
+					EATEST_VERIFY(hashMap.validate());
+					EATEST_VERIFY(hashMultiMap.validate());
+					EATEST_VERIFY(eastl::distance(hashMap.begin(), hashMap.end()) == (i + 1));
+
+					for(int j = 0; j <= i; j += 7)
+					{
+						IncHashMap::iterator it = hashMap.find(j);
+						EATEST_VERIFY((it != hashMap.end()) && (it->second == j));
+					}
+					EATEST_VERIFY(hashMap.find(i + 1) == hashMap.end());
+					EATEST_VERIFY(hashMultiMap.count(i % 1000) == (IncHashMultiMap::size_type)((i / 1000) + 1));
+
+					IncHashMap hashMapCopy(hashMap);
+					EATEST_VERIFY(hashMapCopy.validate());
+					EATEST_VERIFY(hashMapCopy == hashMap);
+
+					IncHashMap hashMapSwap;
+					hashMapSwap.swap(hashMapCopy);
+					EATEST_VERIFY(hashMapSwap.validate() && hashMapCopy.validate());
+					EATEST_VERIFY(hashMapCopy.empty() && (hashMapSwap == hashMap));
+				}
+			}
+		}
+
+		EATEST_VERIFY(nMigratingCount > 0);
+		EATEST_VERIFY(hashMap.size() == (IncHashMap::size_type)kCount);
+		EATEST_VERIFY(hashMap.load_factor() <= hashMap.get_max_load_factor());
+
+		// Erase while migrating, both by key and by iterator.
+		while(hashMap.size() < 40000)
+		{
+			const int n = (int)hashMap.size();
+			hashMap[n] = n;
+		}
+		for(int i = 0; i < 40000; i += 2)
+			EATEST_VERIFY(hashMap.erase(i) == 1);
+		for(IncHashMap::iterator it = hashMap.begin(); it != hashMap.end(); )
+		{
+			if((it->first % 4) == 1)
+				it = hashMap.erase(it);
+			else
+				++it;
+		}
+		EATEST_VERIFY(hashMap.validate());
+		EATEST_VERIFY(hashMap.size() == 10000);
+		for(int i = 3; i < 40000; i += 4)
+			EATEST_VERIFY(hashMap.find(i) != hashMap.end());
+
+		// An explicit rehash finishes any migration at once.
+		hashMap.rehash(3);
+		EATEST_VERIFY(hashMap.validate());
+		IncHashMap::size_type nBucketElementCount = 0;
+		for(IncHashMap::size_type n = 0; n < hashMap.bucket_count(); n++)
+			nBucketElementCount += hashMap.bucket_size(n);
+		EATEST_VERIFY(nBucketElementCount == hashMap.size());
+
+		hashMap.set_max_load_factor(2.f);
+		EATEST_VERIFY(hashMap.get_max_load_factor() == 2.f);
+		EATEST_VERIFY(hashMap.rehash_policy().mnMigrateBucketCount == 16);
+
+		hashMap.clear(true);
+		hashMultiMap.clear();
+		EATEST_VERIFY(hashMap.validate() && hashMap.empty());
+		EATEST_VERIFY(hashMultiMap.validate() && hashMultiMap.empty());
+	}
+
 	// Can't use move semantics with hash_map::operator[]
 	//
 	// GCC has a bug with overloading rvalue and lvalue function templates.
@@ -751,6 +751,48 @@ int TestIntrusiveHash()
 		VERIFY(hs.validate());
 	}
 
+
+	{
+		// template <typename ForwardIterator, typename OutputIterator>
+		// OutputIterator find_batch(ForwardIterator first, ForwardIterator last, OutputIterator out);
+		// template <typename ForwardIterator, typename OutputIterator>
+		// OutputIterator find_batch(ForwardIterator first, ForwardIterator last, OutputIterator out) const;
+		typedef intrusive_hash_map<int, MapWidget, 37> IHM_MW;
+
+		const int kArraySize = 100;
+		MapWidget mwArray[kArraySize];
+		int       keyArray[kArraySize * 2];
+		IHM_MW    ihmMW;
+
+		for(int i = 0; i < kArraySize; i++)
+		{
+			mwArray[i].mKey = i;
+			mwArray[i].mX   = i;
+			ihmMW.insert(mwArray[i]);
+			keyArray[i * 2]     = i;
+			keyArray[i * 2 + 1] = kArraySize + i; // Misses.
+		}
+
+		IHM_MW::iterator results[kArraySize * 2];
+		IHM_MW::iterator* pResultEnd = ihmMW.find_batch(keyArray, keyArray + (kArraySize * 2), results);
+		VERIFY(pResultEnd == results + (kArraySize * 2));
+
+		for(int i = 0; i < (kArraySize * 2); i++)
+		{
+			VERIFY(results[i] == ihmMW.find(keyArray[i]));
+			VERIFY((results[i] != ihmMW.end()) == (keyArray[i] < kArraySize));
+		}
+
+		const IHM_MW& ihmMWConst = ihmMW;
+		IHM_MW::const_iterator constResults[3];
+		ihmMWConst.find_batch(keyArray + 3, keyArray + 6, constResults);
+		VERIFY(constResults[0] == ihmMWConst.end());
+		VERIFY((constResults[1] != ihmMWConst.end()) && (constResults[1]->mX == 2));
+		VERIFY(constResults[2] == ihmMWConst.end());
+
+		ihmMW.clear();
+	}
+
 	return nErrorCount;
 }
 
@@ -101,6 +101,7 @@ int EAMain(int argc, char* argv[])
 	testSuite.AddTest("FixedSet",				TestFixedSet);
 	testSuite.AddTest("FixedString",			TestFixedString);
 	testSuite.AddTest("FixedVector",			TestFixedVector);
+	testSuite.AddTest("FlatHash",				TestFlatHash);
 	testSuite.AddTest("Functional",				TestFunctional);
 	testSuite.AddTest("Hash",					TestHash);
 	testSuite.AddTest("Heap",					TestHeap);
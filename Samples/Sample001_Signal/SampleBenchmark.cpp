@@ -0,0 +1,294 @@
+#include "SampleBenchmark.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(_WIN32)
+	#define WIN32_LEAN_AND_MEAN
+	#define NOMINMAX
+	#include <windows.h>
+#elif defined(__linux__)
+	#include <pthread.h>
+	#include <sched.h>
+#endif
+
+namespace
+{
+	//! Cores this thread may run on
+	std::vector<uint32_t> GetAllowedCores()
+	{
+		std::vector<uint32_t> aCores;
+	#if defined(_WIN32)
+		DWORD_PTR ProcessMask(0), SystemMask(0);
+		if( GetProcessAffinityMask(GetCurrentProcess(), &ProcessMask, &SystemMask) )
+			for( uint32_t Core(0); Core<sizeof(DWORD_PTR)*8; ++Core )
+				if( ProcessMask & (DWORD_PTR(1) << Core) )
+					aCores.push_back(Core);
+	#elif defined(__linux__)
+		cpu_set_t Set;
+		CPU_ZERO(&Set);
+		if( pthread_getaffinity_np(pthread_self(), sizeof(Set), &Set) == 0 )
+			for( uint32_t Core(0); Core<CPU_SETSIZE; ++Core )
+				if( CPU_ISSET(Core, &Set) )
+					aCores.push_back(Core);
+	#endif
+		return aCores;
+	}
+
+	bool SetAffinity(const std::vector<uint32_t>& _aCores)
+	{
+	#if defined(_WIN32)
+		DWORD_PTR Mask(0);
+		for( uint32_t Core : _aCores )
+			Mask |= DWORD_PTR(1) << Core;
+		return SetThreadAffinityMask(GetCurrentThread(), Mask) != 0;
+	#elif defined(__linux__)
+		cpu_set_t Set;
+		CPU_ZERO(&Set);
+		for( uint32_t Core : _aCores )
+			CPU_SET(Core, &Set);
+		return pthread_setaffinity_np(pthread_self(), sizeof(Set), &Set) == 0;
+	#else
+		(void)_aCores;
+		return false;
+	#endif
+	}
+
+	//! Sample of sorted values at 1-based rank, clamped to valid ranks
+	inline double GetRank(const std::vector<double>& _aSorted, long long _Rank)
+	{
+		_Rank = std::min<long long>(std::max<long long>(_Rank, 1), static_cast<long long>(_aSorted.size()));
+		return _aSorted[static_cast<size_t>(_Rank - 1)];
+	}
+
+	void WriteJsonString(FILE* _pFile, const std::string& _String)
+	{
+		fputc('"', _pFile);
+		for( char Char : _String )
+		{
+			if( Char == '"' || Char == '\\' )
+				fputc('\\', _pFile);
+			fputc(Char, _pFile);
+		}
+		fputc('"', _pFile);
+	}
+
+	const char* GetCompilerName()
+	{
+	#if defined(__clang__)
+		return "clang " __clang_version__;
+	#elif defined(__GNUC__)
+		return "gcc " __VERSION__;
+	#elif defined(_MSC_VER)
+		#define zenStringify2(_Value) #_Value
+		#define zenStringify(_Value) zenStringify2(_Value)
+		return "msvc " zenStringify(_MSC_FULL_VER);
+	#else
+		return "unknown";
+	#endif
+	}
+}
+
+//==================================================================================================
+// zBenchmarkConfig
+//==================================================================================================
+bool zBenchmarkConfig::Parse(int _ArgCount, char** _pArgs)
+{
+	for( int idx(1); idx<_ArgCount; ++idx )
+	{
+		const char* zArg	= _pArgs[idx];
+		const char* zValue	= idx + 1 < _ArgCount ? _pArgs[idx + 1] : nullptr;
+		if( strcmp(zArg, "--no-pause") == 0 )
+			mbPause = false;
+		else if( strcmp(zArg, "--no-concurrent") == 0 )
+			mbConcurrent = false;
+		else if( zValue && strcmp(zArg, "--samples") == 0 && atoi(zValue) > 0 )
+			mSampleCount = static_cast<uint32_t>(atoi(_pArgs[++idx]));
+		else if( zValue && strcmp(zArg, "--warmup") == 0 && atoi(zValue) >= 0 )
+			mWarmupCount = static_cast<uint32_t>(atoi(_pArgs[++idx]));
+		else if( zValue && strcmp(zArg, "--core") == 0 )
+		{
+			++idx;
+			mCore = strcmp(zValue, "auto") == 0 ? kCoreAuto : strcmp(zValue, "none") == 0 ? kCoreNone : atoi(zValue);
+			if( mCore < 0 && strcmp(zValue, "auto") != 0 && strcmp(zValue, "none") != 0 )
+			{
+				PrintUsage(_pArgs[0]);
+				return false;
+			}
+		}
+		else if( zValue && strcmp(zArg, "--filter") == 0 )
+			mFilter = _pArgs[++idx];
+		else if( zValue && strcmp(zArg, "--json") == 0 )
+			mJsonPath = _pArgs[++idx];
+		else if( zValue && strcmp(zArg, "--csv") == 0 )
+			mCsvPath = _pArgs[++idx];
+		else
+		{
+			PrintUsage(_pArgs[0]);
+			return false;
+		}
+	}
+	return true;
+}
+
+void zBenchmarkConfig::PrintUsage(const char* _zExecutable)
+{
+	printf("\nUsage: %s [options]", _zExecutable);
+	printf("\n  --samples N        Timed runs per case (default 21)");
+	printf("\n  --warmup N         Untimed runs per case (default 3)");
+	printf("\n  --core N|auto|none Core the benchmark thread is pinned to (default auto : last allowed core)");
+	printf("\n  --filter Text      Only run cases whose name contains Text");
+	printf("\n  --json Path        Write results as Json");
+	printf("\n  --csv Path         Write results as Csv");
+	printf("\n  --no-concurrent    Skip the multi threaded sample");
+	printf("\n  --no-pause         Exit without waiting for 'Enter'");
+	printf("\n");
+}
+
+//==================================================================================================
+// zBenchmark
+//==================================================================================================
+zBenchmark::zBenchmark(const zBenchmarkConfig& _Config)
+: mConfig(_Config)
+{
+	if( mConfig.mCore != zBenchmarkConfig::kCoreNone )
+	{
+		maSavedCores = GetAllowedCores();
+		const int Core = mConfig.mCore == zBenchmarkConfig::kCoreAuto ? (maSavedCores.empty() ? -1 : static_cast<int>(maSavedCores.back())) : mConfig.mCore;
+		if( Core >= 0 && SetAffinity(std::vector<uint32_t>(1, static_cast<uint32_t>(Core))) )
+			mPinnedCore = Core;
+		else
+			printf("\n Warning: Couldn't pin benchmark thread to a core");
+	}
+}
+
+zBenchmark::~zBenchmark()
+{
+	if( mPinnedCore >= 0 && !maSavedCores.empty() )
+		SetAffinity(maSavedCores);
+}
+
+bool zBenchmark::IsSelected(const char* _zName)const
+{
+	return mConfig.mFilter.empty() || strstr(_zName, mConfig.mFilter.c_str()) != nullptr;
+}
+
+const char* zBenchmark::GetCycleCounterName()
+{
+#if (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))) || defined(__x86_64__) || defined(__i386__)
+	return "rdtsc";
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+	return "cntvct";
+#else
+	return "none";
+#endif
+}
+
+void zBenchmark::PrintHeader()const
+{
+	printf("\n (%u samples after %u warmup runs, per operation, pinned core %i, %s ticks)", mConfig.mSampleCount, mConfig.mWarmupCount, mPinnedCore, GetCycleCounterName());
+	printf("\n %-30s | %6s | %4s | %-30s | %7s | %7s | %7s | %s", "Case", "Slots", "Arg", "Median ns [95% CI]", "Min", "P99", "Ticks", "Check");
+}
+
+void zBenchmark::AddResult(const Case& _Case, std::vector<double>& _aSamplesNs, std::vector<double>& _aSamplesCycles, bool _bPassed)
+{
+	Result NewResult;
+	NewResult.mName			= _Case.mzName;
+	NewResult.mSlotCount	= _Case.mSlotCount;
+	NewResult.mArgBytes		= _Case.mArgBytes;
+	NewResult.mOpCount		= _Case.mOpCount;
+	NewResult.mSampleCount	= static_cast<uint32_t>(_aSamplesNs.size());
+	NewResult.mbPassed		= _bPassed;
+
+	if( !_aSamplesNs.empty() )
+	{
+		const double OpCount	= static_cast<double>(std::max<uint64_t>(_Case.mOpCount, 1));
+		const long long Count	= static_cast<long long>(_aSamplesNs.size());
+		std::sort(_aSamplesNs.begin(), _aSamplesNs.end());
+		std::sort(_aSamplesCycles.begin(), _aSamplesCycles.end());
+
+		// Median confidence interval : ranks n/2 -/+ 1.96*sqrt(n)/2 of the sorted samples
+		const double HalfWidth	= 0.98 * std::sqrt(static_cast<double>(Count));
+		NewResult.mMinNs		= _aSamplesNs.front() / OpCount;
+		NewResult.mMedianNs		= (GetRank(_aSamplesNs, (Count + 1) / 2) + GetRank(_aSamplesNs, Count / 2 + 1)) / 2.0 / OpCount;
+		NewResult.mMedianLowNs	= GetRank(_aSamplesNs, static_cast<long long>(std::floor(Count / 2.0 - HalfWidth))) / OpCount;
+		NewResult.mMedianHighNs	= GetRank(_aSamplesNs, static_cast<long long>(std::ceil(Count / 2.0 + 1.0 + HalfWidth))) / OpCount;
+		NewResult.mP99Ns		= GetRank(_aSamplesNs, static_cast<long long>(std::ceil(Count * 0.99))) / OpCount;
+		NewResult.mMedianCycles	= (GetRank(_aSamplesCycles, (Count + 1) / 2) + GetRank(_aSamplesCycles, Count / 2 + 1)) / 2.0 / OpCount;
+
+		double Sum(0), SumSquared(0);
+		for( double Sample : _aSamplesNs )
+			Sum += Sample / OpCount;
+		NewResult.mMeanNs		= Sum / Count;
+		for( double Sample : _aSamplesNs )
+			SumSquared += (Sample / OpCount - NewResult.mMeanNs) * (Sample / OpCount - NewResult.mMeanNs);
+		NewResult.mStdDevNs		= Count > 1 ? std::sqrt(SumSquared / (Count - 1)) : 0.0;
+	}
+
+	mFailedCount += _bPassed ? 0 : 1;
+	printf("\n %-30s | %6u | %4u | %8.02f [%8.02f - %8.02f] | %7.02f | %7.02f | %7.02f | %s", NewResult.mName.c_str(), NewResult.mSlotCount, NewResult.mArgBytes,
+		NewResult.mMedianNs, NewResult.mMedianLowNs, NewResult.mMedianHighNs, NewResult.mMinNs, NewResult.mP99Ns, NewResult.mMedianCycles, _bPassed ? "Ok" : "FAILED");
+	fflush(stdout);
+	maResults.push_back(std::move(NewResult));
+}
+
+bool zBenchmark::WriteReports()const
+{
+	bool bSuccess = true;
+	if( !mConfig.mJsonPath.empty() )
+		bSuccess &= WriteJson(mConfig.mJsonPath.c_str());
+	if( !mConfig.mCsvPath.empty() )
+		bSuccess &= WriteCsv(mConfig.mCsvPath.c_str());
+	return bSuccess;
+}
+
+bool zBenchmark::WriteJson(const char* _zPath)const
+{
+	FILE* pFile = fopen(_zPath, "w");
+	if( !pFile )
+	{
+		printf("\n Error: Couldn't write '%s'", _zPath);
+		return false;
+	}
+
+	fprintf(pFile, "{\n\t\"sample\": \"Sample001_Signal\",\n\t\"compiler\": ");
+	WriteJsonString(pFile, GetCompilerName());
+#if defined(NDEBUG)
+	fprintf(pFile, ",\n\t\"optimized\": true");
+#else
+	fprintf(pFile, ",\n\t\"optimized\": false");
+#endif
+	fprintf(pFile, ",\n\t\"cycle_counter\": \"%s\",\n\t\"pinned_core\": %i,\n\t\"warmup\": %u,\n\t\"samples\": %u,\n\t\"unit\": \"ns_per_op\",\n\t\"results\": [", GetCycleCounterName(), mPinnedCore, mConfig.mWarmupCount, mConfig.mSampleCount);
+	for( size_t idx(0); idx<maResults.size(); ++idx )
+	{
+		const Result& ResultItem = maResults[idx];
+		fprintf(pFile, "%s\n\t\t{ \"name\": ", idx ? "," : "");
+		WriteJsonString(pFile, ResultItem.mName);
+		fprintf(pFile, ", \"slots\": %u, \"arg_bytes\": %u, \"ops\": %llu, \"samples\": %u, \"min\": %.04f, \"median\": %.04f, \"median_ci_low\": %.04f, \"median_ci_high\": %.04f, \"p99\": %.04f, \"mean\": %.04f, \"stddev\": %.04f, \"median_ticks\": %.04f, \"passed\": %s }",
+			ResultItem.mSlotCount, ResultItem.mArgBytes, static_cast<unsigned long long>(ResultItem.mOpCount), ResultItem.mSampleCount, ResultItem.mMinNs, ResultItem.mMedianNs, ResultItem.mMedianLowNs, ResultItem.mMedianHighNs,
+			ResultItem.mP99Ns, ResultItem.mMeanNs, ResultItem.mStdDevNs, ResultItem.mMedianCycles, ResultItem.mbPassed ? "true" : "false");
+	}
+	fprintf(pFile, "\n\t]\n}\n");
+	return fclose(pFile) == 0;
+}
+
+bool zBenchmark::WriteCsv(const char* _zPath)const
+{
+	FILE* pFile = fopen(_zPath, "w");
+	if( !pFile )
+	{
+		printf("\n Error: Couldn't write '%s'", _zPath);
+		return false;
+	}
+
+	fprintf(pFile, "name,slots,arg_bytes,ops,samples,min_ns,median_ns,median_ci_low_ns,median_ci_high_ns,p99_ns,mean_ns,stddev_ns,median_ticks,passed\n");
+	for( const Result& ResultItem : maResults )
+	{
+		fprintf(pFile, "\"%s\",%u,%u,%llu,%u,%.04f,%.04f,%.04f,%.04f,%.04f,%.04f,%.04f,%.04f,%i\n", ResultItem.mName.c_str(), ResultItem.mSlotCount, ResultItem.mArgBytes,
+			static_cast<unsigned long long>(ResultItem.mOpCount), ResultItem.mSampleCount, ResultItem.mMinNs, ResultItem.mMedianNs, ResultItem.mMedianLowNs, ResultItem.mMedianHighNs,
+			ResultItem.mP99Ns, ResultItem.mMeanNs, ResultItem.mStdDevNs, ResultItem.mMedianCycles, ResultItem.mbPassed ? 1 : 0);
+	}
+	return fclose(pFile) == 0;
+}
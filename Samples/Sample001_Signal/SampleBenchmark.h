@@ -0,0 +1,112 @@
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <chrono>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+	#include <x86intrin.h>
+#endif
+
+//==================================================================================================
+//! @brief		Benchmark settings, read from the command line
+//==================================================================================================
+struct zBenchmarkConfig
+{
+	static constexpr int		kCoreAuto		= -1;											//!< Pin to the last core this process may use
+	static constexpr int		kCoreNone		= -2;											//!< Don't pin
+
+	uint32_t					mWarmupCount	= 3;											//!< Untimed runs of each case, before sampling
+	uint32_t					mSampleCount	= 21;											//!< Timed runs of each case
+	int							mCore			= kCoreAuto;
+	bool						mbPause			= true;											//!< Wait for 'Enter' before exiting
+	bool						mbConcurrent	= true;											//!< Run the multi threaded sample too
+	std::string					mFilter;														//!< Only run cases whose name contains this
+	std::string					mJsonPath;
+	std::string					mCsvPath;
+
+	bool						Parse(int _ArgCount, char** _pArgs);							//!< False (after printing usage) on invalid arguments
+	static void					PrintUsage(const char* _zExecutable);
+};
+
+//==================================================================================================
+//! @Class		Timing harness of the performance sample
+//! @details	Each case runs a few untimed warmup passes, then a number of timed samples.
+//!				Results are per operation (one callback invocation), reported as median with
+//!				its 95% confidence interval (order statistics, no distribution assumed),
+//!				min and p99, in nanoseconds and in cycle counter ticks.
+//!				Benchmark thread is pinned to one core while the harness exists.
+//!				Cases return false when their result is wrong, which is reported and makes
+//!				'GetFailedCount' non zero (checks stay active in release builds).
+//! @Example	zBenchmark Bench(Config);
+//!				Bench.Run({"Signal", 10, 4, kLoopCount}, [&](){ ...; return Sum == kLoopCount; });
+//!				Bench.WriteReports();
+//==================================================================================================
+class zBenchmark
+{
+public:
+	//! Description of a measured case
+	struct Case
+	{
+		const char*				mzName;
+		uint32_t				mSlotCount;														//!< Listeners invoked per signal
+		uint32_t				mArgBytes;														//!< Size of signal parameters
+		uint64_t				mOpCount;														//!< Operations per sample, results are divided by it
+	};
+
+	//! Statistics of a case, per operation
+	struct Result
+	{
+		std::string				mName;
+		uint32_t				mSlotCount		= 0;
+		uint32_t				mArgBytes		= 0;
+		uint64_t				mOpCount		= 0;
+		uint32_t				mSampleCount	= 0;
+		double					mMinNs			= 0;
+		double					mMedianNs		= 0;
+		double					mMedianLowNs	= 0;											//!< 95% confidence interval of median
+		double					mMedianHighNs	= 0;
+		double					mP99Ns			= 0;
+		double					mMeanNs			= 0;
+		double					mStdDevNs		= 0;
+		double					mMedianCycles	= 0;
+		bool					mbPassed		= true;
+	};
+
+								zBenchmark(const zBenchmarkConfig& _Config);
+								~zBenchmark();													//!< Restore thread affinity
+								zBenchmark(const zBenchmark&)=delete;
+	zBenchmark&					operator=(const zBenchmark&)=delete;
+
+	template<typename TBody>
+	inline void					Run(const Case& _Case, TBody&& _Body);							//!< Time '_Body()' (returns true when result is valid)
+	template<typename TBody, typename TPrepare>
+	void						Run(const Case& _Case, TBody&& _Body, TPrepare&& _Prepare);		//!< Same, calling untimed '_Prepare()' before each run
+
+	bool						IsSelected(const char* _zName)const;
+	void						PrintHeader()const;
+	bool						WriteReports()const;											//!< Json/Csv files requested by config
+	inline uint32_t				GetFailedCount()const		{ return mFailedCount; }
+	inline int					GetPinnedCore()const		{ return mPinnedCore; }
+
+	static inline uint64_t		ReadCycles();													//!< Cycle counter ticks (0 when unsupported)
+	template<typename TValue>
+	static inline void			KeepAlive(TValue& _Value);										//!< Prevents compiler from optimizing away a value computation
+	static const char*			GetCycleCounterName();
+
+protected:
+	void						AddResult(const Case& _Case, std::vector<double>& _aSamplesNs, std::vector<double>& _aSamplesCycles, bool _bPassed);
+	bool						WriteJson(const char* _zPath)const;
+	bool						WriteCsv(const char* _zPath)const;
+
+	const zBenchmarkConfig&		mConfig;
+	std::vector<Result>			maResults;
+	std::vector<uint32_t>		maSavedCores;													//!< Affinity before pinning
+	int							mPinnedCore		= zBenchmarkConfig::kCoreNone;
+	uint32_t					mFailedCount	= 0;
+};
+
+#include "SampleBenchmark.inl"
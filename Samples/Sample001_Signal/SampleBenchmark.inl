@@ -0,0 +1,60 @@
+
+uint64_t zBenchmark::ReadCycles()
+{
+#if (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))) || defined(__x86_64__) || defined(__i386__)
+	return __rdtsc();
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+	uint64_t Ticks;
+	asm volatile("mrs %0, cntvct_el0" : "=r"(Ticks));
+	return Ticks;
+#else
+	return 0;
+#endif
+}
+
+template<typename TValue>
+void zBenchmark::KeepAlive(TValue& _Value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	asm volatile("" : : "r"(&_Value) : "memory");
+#else
+	static void* volatile spSink;
+	spSink = &_Value;
+#endif
+}
+
+template<typename TBody>
+void zBenchmark::Run(const Case& _Case, TBody&& _Body)
+{
+	Run(_Case, _Body, [](){});
+}
+
+template<typename TBody, typename TPrepare>
+void zBenchmark::Run(const Case& _Case, TBody&& _Body, TPrepare&& _Prepare)
+{
+	if( !IsSelected(_Case.mzName) )
+		return;
+
+	bool bPassed = true;
+	for( uint32_t idx(0); idx<mConfig.mWarmupCount; ++idx )
+	{
+		_Prepare();
+		bPassed &= _Body();
+	}
+
+	std::vector<double> aSamplesNs, aSamplesCycles;
+	aSamplesNs.reserve(mConfig.mSampleCount);
+	aSamplesCycles.reserve(mConfig.mSampleCount);
+	for( uint32_t idx(0); idx<mConfig.mSampleCount; ++idx )
+	{
+		_Prepare();
+		const auto		TimeStart	= std::chrono::steady_clock::now();
+		const uint64_t	CycleStart	= ReadCycles();
+		bPassed						&= _Body();
+		const uint64_t	CycleEnd	= ReadCycles();
+		const auto		TimeEnd		= std::chrono::steady_clock::now();
+		aSamplesNs.push_back(static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(TimeEnd - TimeStart).count()));
+		aSamplesCycles.push_back(static_cast<double>(CycleEnd - CycleStart));
+	}
+	AddResult(_Case, aSamplesNs, aSamplesCycles, bPassed);
+}
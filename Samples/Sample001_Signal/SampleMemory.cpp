@@ -0,0 +1,42 @@
+#include <cstdio>
+#include "SignalEmitter.h"
+#include "SignalPackedEmitter.h"
+#include "SignalCompactEmitter.h"
+#include <functional>
+
+const unsigned int kMemoryEmitterCount		= 1000000;		// Emitters in the memory report scenario (one per entity)
+const unsigned int kMemorySlotPerEmitter	= 4;			// Slots connected to each emitter, in the memory report scenario
+
+//! Baseline : listeners kept in a linked list, with a std::function each
+struct ListStdFunction : public eastl::intrusive_list_node
+{
+	std::function<void(int)> mCallback;
+};
+
+//==================================================================================================
+//! @brief	Print memory used by one emitter type, for the report scenario
+//! @param	_ConnectionExtra	Bytes allocated by emitter per connection, outside of the slot
+//==================================================================================================
+void PrintMemoryFootprint(const char* _zName, size_t _EmitterSize, size_t _SlotSize, size_t _ConnectionExtra)
+{
+	const size_t ConnectionSize	= _SlotSize + _ConnectionExtra;
+	const double TotalMB		= (double)(_EmitterSize*kMemoryEmitterCount + ConnectionSize*kMemoryEmitterCount*kMemorySlotPerEmitter) / (1024.0*1024.0);
+	printf("\n %-24s | %7zu | %7zu | %14zu | %10.01f", _zName, _EmitterSize, _SlotSize, ConnectionSize, TotalMB);
+}
+
+//==================================================================================================
+//! @brief	Memory cost of emitters and connections (not counting allocator overhead and vector slack)
+//==================================================================================================
+void SampleMemoryReport()
+{
+	printf("\n");
+	printf("\n============================================================");
+	printf("\n Memory footprint");
+	printf("\n (bytes, total for %u emitters with %u connections each)", kMemoryEmitterCount, kMemorySlotPerEmitter);
+	printf("\n============================================================");
+	printf("\n %-24s | %7s | %7s | %14s | %10s", "Type", "Emitter", "Slot", "Per Connection", "Total MB");
+	PrintMemoryFootprint("List std::function",	sizeof(eastl::intrusive_list<ListStdFunction>), sizeof(ListStdFunction), 0);
+	PrintMemoryFootprint("zEmitter",			sizeof(zEmitter<int>), sizeof(zEmitter<int>::Slot), 0);
+	PrintMemoryFootprint("zPackedEmitter",		sizeof(zPackedEmitter<int>), sizeof(zPackedEmitter<int>::Slot), sizeof(zPackedEmitter<int>::Slot::Callback::Invoker) + sizeof(const void*) + sizeof(void*));
+	PrintMemoryFootprint("zCompactEmitter",		sizeof(zCompactEmitter<int>), sizeof(zCompactEmitter<int>::Slot), 0);
+}
@@ -1,8 +1,24 @@
 #include <iostream>
 #include "SignalEmitter.h"
-#include <chrono>
-#include <assert.h>
+#include "SignalPackedEmitter.h"
+#include "SignalCompactEmitter.h"
+#include "SignalStaticEmitter.h"
+#include "SignalQueuedEmitter.h"
+#include "SignalPriorityEmitter.h"
+#include "SignalResultEmitter.h"
+#include "SignalSafeEmitter.h"
+#include "SignalConnectionScope.h"
+#include "SignalEventBus.h"
+#include "SignalKeyedEmitter.h"
+#include "SignalCoalescingEmitter.h"
+#include "SignalWeakEmitter.h"
+#include "SignalRecorder.h"
+#include "SampleBenchmark.h"
+#include <algorithm>
 #include <array>
+#include <cstdio>
+#include <functional>
+#include <memory>
 
 #if defined(_MSC_VER)
 	#define NoInline __declspec(noinline)
@@ -12,14 +28,88 @@
 	#define NoInline
 #endif
 
-const unsigned int kLoopCount = 1000000;	// Number of loop to do per test
-const unsigned int kIteration = 10;			// Number of time to re-do test, averaging result to improve reliability
+const unsigned int kLoopCount			= 1000000;					// Number of callback invocations per sample
+const unsigned int kSweepInvocations	= 1 << 20;					// Number of callback invocations per sample, in emitter sweeps
+const unsigned int kSweepSlotCounts[]	= {1, 10, 100, 1000, 10000, 100000};
+const unsigned int kKeyedSlotCount		= 1000;						// Listeners (one per key) in filtered/keyed signal tests
+const unsigned int kKeyedSignalCount	= 10000;					// Number of signals per sample, in filtered/keyed signal tests
+const unsigned int kFrameCount			= 10000;					// Number of frames per sample, in coalescing tests
+const unsigned int kSignalPerFrame		= 100;						// Number of signals sent each frame, in coalescing tests
+const char* const  kReplayLogPath		= "SampleSignalReplay.log";	// Temporary signal log, in recorder tests
 
 NoInline void FunctionSumCallback(int InValue, int& InSumResult)
 {
 	InSumResult += InValue;	
 }
 
+inline void InlineSumCallback(int InValue, int& InSumResult)
+{
+	InSumResult += InValue;
+}
+
+NoInline int FunctionReturnCallback(int InValue)
+{
+	return InValue;
+}
+
+struct SumListener
+{
+	NoInline void OnSignal(int InValue, int& InSumResult)
+	{
+		InSumResult += InValue;
+	}
+};
+
+struct SumEvent
+{
+	int		mValue;
+	int&	mSumResult;
+};
+
+NoInline void EventSumCallback(const SumEvent& InEvent)
+{
+	InEvent.mSumResult += InEvent.mValue;
+}
+
+#if ZEN_SIGNAL_COROUTINE
+//! Coroutine adding the values of '_Count' signals
+zSignalTask AwaitSumCoroutine(zEmitter<int>& InEmitter, unsigned int InCount, int& InSumResult)
+{
+	for( unsigned int i(0); i<InCount; ++i )
+		InSumResult += co_await InEmitter.Next();
+}
+#endif
+
+//! Listener accumulating received values in itself
+struct ValueListener
+{
+	NoInline void OnSignal(int InValue)
+	{
+		mSum += InValue;
+	}
+	int mSum = 0;
+};
+
+//! Listener only interested in signals about one entity
+struct EntityListener
+{
+	NoInline void OnSignal(int InEntityId, int& InSumResult)
+	{
+		if( InEntityId == mEntityId )
+			InSumResult += 1;
+	}
+	NoInline void OnKeyedSignal(const int& InEntityId, int& InSumResult)
+	{
+		InSumResult += InEntityId == mEntityId;
+	}
+	int mEntityId = 0;
+};
+
+struct Capture32B
+{
+	int mValues[8] = {1,0,0,0,0,0,0,0};	// Big enough to not fit in most std::function small buffer
+};
+
 struct ListFunctionPtr : public eastl:: intrusive_list_node
 {
 	void (*mpFonctionCallback)(int,int&) = FunctionSumCallback;
@@ -30,153 +120,663 @@ struct ListFunctor : public eastl::intrusive_list_node
 	std::function<void(int, int&)> mFunctorCallback = FunctionSumCallback;
 };
 
-inline __int64 GetElapsedTimeUs(const std::chrono::high_resolution_clock::time_point& InStartTime)
+//! Signal parameter of a given size, passed by value
+template<size_t TSize>
+struct Payload
+{
+	int mValues[TSize/sizeof(int)] = {1};
+};
+
+template<size_t TSize>
+NoInline void PayloadSumCallback(Payload<TSize> InPayload, int& InSumResult)
 {
-	return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - InStartTime).count();
+	InSumResult += InPayload.mValues[0];
 }
 
-void SamplePerformances()
+//==================================================================================================
+//! @brief	Signal cost of an emitter type, for each slot count of the sweep, with a parameter of 'TSize' bytes
+//! @note	Slots are allocated contiguously (best case for list based emitters)
+//==================================================================================================
+template<template<typename...> class TEmitter, size_t TSize>
+void SweepEmitter(zBenchmark& Bench, const char* zName)
+{
+	typedef TEmitter<Payload<TSize>, int&> Emitter;
+	if( !Bench.IsSelected(zName) )
+		return;
+
+	for( unsigned int SlotCount : kSweepSlotCounts )
+	{
+		Emitter												EmitterItem;
+		std::unique_ptr<typename Emitter::Slot[]>			ArraySlot(new typename Emitter::Slot[SlotCount]);
+		for( unsigned int i(0); i<SlotCount; ++i )
+			ArraySlot[i].template Connect<&PayloadSumCallback<TSize>>(EmitterItem);
+
+		const unsigned int		SignalCount = std::max(kSweepInvocations / SlotCount, 1u);
+		const Payload<TSize>	Value;
+		Bench.Run({zName, SlotCount, TSize, (uint64_t)SignalCount*SlotCount}, [&]()
+		{
+			int Sum = 0;
+			for( unsigned int i(0); i<SignalCount; ++i )
+				EmitterItem.Signal(Value, Sum);
+			return Sum == (int)(SignalCount*SlotCount);
+		});
+	}
+}
+
+//==================================================================================================
+//! @brief	Single thread benchmarks, returns false if a case produced a wrong result
+//==================================================================================================
+bool SamplePerformances(const zBenchmarkConfig& InConfig)
 {
 	printf("\n");
 	printf("\n============================================================");
 	printf("\n Performances evaluation");
-	printf("\n (%i Iterations, averaged over %i times)", kLoopCount, kIteration);
+	printf("\n (%i callbacks per sample, time per callback)", kLoopCount);
 	printf("\n============================================================");
-	
-	__int64 ElapsedDirect(0), ElapsedPointer(0), ElapsedFunctorFunction(0), ElapsedFunctorLambda(0);
-	__int64 ElapsedListPointer(0), ElapsedListFunctor(0), ElapsedEmitter(0), ElapsedEmitterLambda(0);
 
-	for(int idx(0); idx<kIteration; ++idx)
+	zBenchmark Bench(InConfig);
+	Bench.PrintHeader();
+
+	// Direct Function (made sure no inlining)
+	Bench.Run({"Direct Function", 1, sizeof(int), kLoopCount}, []()
+	{
+		int Sum = 0;
+		for( unsigned int i(0); i<kLoopCount; ++i )
+			FunctionSumCallback(1, Sum);
+		return Sum == kLoopCount;
+	});
+	// Function Pointer
 	{
-		// Direct Function (made sure no inlining)
+		void (* volatile pCallback)(int,int&) = FunctionSumCallback;
+		Bench.Run({"Function Pointer", 1, sizeof(int), kLoopCount}, [&]()
 		{
-			auto TimeStart		= std::chrono::high_resolution_clock::now();
-			int Sum				= 0;
-			for( int i(0); i<kLoopCount; ++i )
+			int Sum = 0;
+			for( unsigned int i(0); i<kLoopCount; ++i )
+				pCallback(1, Sum);
+			return Sum == kLoopCount;
+		});
+	}
+	// Functor with function call
+	{
+		std::function<void(int, int&)> FunctorCallback = FunctionSumCallback;
+		Bench.Run({"std::Functor (Function)", 1, sizeof(int), kLoopCount}, [&]()
+		{
+			int Sum = 0;
+			for( unsigned int i(0); i<kLoopCount; ++i )
+				FunctorCallback(1, Sum);
+			return Sum == kLoopCount;
+		});
+	}
+	// Functor with Lambda
+	{
+		std::function<void(int, int&)> FunctorCallback = [](int InValue,int& InSumResult){ InSumResult += InValue;};
+		Bench.Run({"std::Functor (Lambda)", 1, sizeof(int), kLoopCount}, [&]()
+		{
+			int Sum = 0;
+			for( unsigned int i(0); i<kLoopCount; ++i )
+				FunctorCallback(1, Sum);
+			return Sum == kLoopCount;
+		});
+	}
+	// zCallback with function call
+	{
+		zCallback<void(int, int&)> Callback = FunctionSumCallback;
+		Bench.Run({"zCallback (Function)", 1, sizeof(int), kLoopCount}, [&]()
+		{
+			int Sum = 0;
+			for( unsigned int i(0); i<kLoopCount; ++i )
+				Callback(1, Sum);
+			return Sum == kLoopCount;
+		});
+	}
+	// zCallback with Lambda
+	{
+		zCallback<void(int, int&)> Callback = [](int InValue,int& InSumResult){ InSumResult += InValue;};
+		Bench.Run({"zCallback (Lambda)", 1, sizeof(int), kLoopCount}, [&]()
+		{
+			int Sum = 0;
+			for( unsigned int i(0); i<kLoopCount; ++i )
+				Callback(1, Sum);
+			return Sum == kLoopCount;
+		});
+	}
+	// Functor assignment, with a capture too big for the std::function small buffer (heap allocation)
+	Bench.Run({"std::Functor Assign (32B)", 1, sizeof(int), kLoopCount}, []()
+	{
+		Capture32B Capture;
+		int Sum = 0;
+		for( unsigned int i(0); i<kLoopCount; ++i )
+		{
+			std::function<void(int, int&)> FunctorCallback = [Capture](int InValue,int& InSumResult){ InSumResult += InValue * Capture.mValues[0];};
+			zBenchmark::KeepAlive(FunctorCallback);
+			FunctorCallback(1, Sum);
+		}
+		return Sum == kLoopCount;
+	});
+	// zCallback assignment, with the same capture (stored inline)
+	Bench.Run({"zCallback Assign (32B)", 1, sizeof(int), kLoopCount}, []()
+	{
+		Capture32B Capture;
+		int Sum = 0;
+		for( unsigned int i(0); i<kLoopCount; ++i )
+		{
+			zCallback<void(int, int&)> Callback = [Capture](int InValue,int& InSumResult){ InSumResult += InValue * Capture.mValues[0];};
+			zBenchmark::KeepAlive(Callback);
+			Callback(1, Sum);
+		}
+		return Sum == kLoopCount;
+	});
+	// List of Function Pointer
+	{
+		eastl::intrusive_list<ListFunctionPtr>	ListCallback;
+		std::array<ListFunctionPtr, 10>			ArrayCallback;
+		for( auto& item : ArrayCallback)
+			ListCallback.push_back( item );
+
+		Bench.Run({"List Function Pointer", 10, sizeof(int), kLoopCount}, [&]()
+		{
+			int Sum = 0;
+			for( unsigned int i(0); i<kLoopCount; i+= (unsigned int)ArrayCallback.size())
 			{
-				FunctionSumCallback(1, Sum);
+				for( auto& item : ListCallback )
+					item.mpFonctionCallback(1,Sum);
 			}
-			ElapsedDirect		+= GetElapsedTimeUs(TimeStart);
-			assert(Sum == kLoopCount);		
-		}
-		// Function Pointer
+			return Sum == kLoopCount;
+		});
+	}
+	// List of Functor Function
+	{
+		eastl::intrusive_list<ListFunctor>	ListCallback;
+		std::array<ListFunctor, 10>			ArrayCallback;
+		for( auto& item : ArrayCallback)
+			ListCallback.push_back( item );
+
+		Bench.Run({"List std::Functor (function)", 10, sizeof(int), kLoopCount}, [&]()
 		{
-			void (*pCallback)(int,int&)	= FunctionSumCallback;
-			auto TimeStart	= std::chrono::high_resolution_clock::now();
-			int Sum			= 0;
-			for( int i(0); i<kLoopCount; ++i )
+			int Sum = 0;
+			for( unsigned int i(0); i<kLoopCount; i+= (unsigned int)ArrayCallback.size())
 			{
-				pCallback(1, Sum);
+				for( auto& item : ListCallback )
+					item.mFunctorCallback(1,Sum);
 			}
-			ElapsedPointer		+= GetElapsedTimeUs(TimeStart);
-			assert(Sum == kLoopCount);		
-		}
-		// Functor with function call
+			return Sum == kLoopCount;
+		});
+	}
+	// Signal/Slot Emitter with Function
+	{
+		zEmitter<int, int&>						Emitter;
+		std::array<decltype(Emitter)::Slot, 10>	ArraySlot;
+		for( auto& SlotItem : ArraySlot)
+			SlotItem.Connect(Emitter, FunctionSumCallback);
+
+		Bench.Run({"Signal (Function)", 10, sizeof(int), kLoopCount}, [&]()
 		{
-			std::function<void(int, int&)> FunctorCallback = FunctionSumCallback;
-			auto TimeStart	= std::chrono::high_resolution_clock::now();
-			int Sum			= 0;
-			for( int i(0); i<kLoopCount; ++i )
+			int Sum = 0;
+			for( unsigned int i(0); i<kLoopCount; i+= (unsigned int)ArraySlot.size())
+				Emitter.Signal(1, Sum);
+			return Sum == kLoopCount;
+		});
+	}
+	// Static Signal, handlers wired at compile time (direct calls)
+	{
+		typedef zStaticSignal<void(int, int&),	&FunctionSumCallback, &FunctionSumCallback, &FunctionSumCallback, &FunctionSumCallback, &FunctionSumCallback,
+												&FunctionSumCallback, &FunctionSumCallback, &FunctionSumCallback, &FunctionSumCallback, &FunctionSumCallback> StaticSignal;
+		Bench.Run({"Static Signal (Function)", StaticSignal::kHandlerCount, sizeof(int), kLoopCount}, [&]()
+		{
+			int Sum = 0;
+			for( unsigned int i(0); i<kLoopCount; i+= (unsigned int)StaticSignal::kHandlerCount)
+				StaticSignal::Signal(1, Sum);
+			return Sum == kLoopCount;
+		});
+	}
+	{
+		typedef zStaticSignal<void(int, int&),	&InlineSumCallback, &InlineSumCallback, &InlineSumCallback, &InlineSumCallback, &InlineSumCallback,
+												&InlineSumCallback, &InlineSumCallback, &InlineSumCallback, &InlineSumCallback, &InlineSumCallback> StaticSignal;
+		volatile int Value = 1;	// Prevents folding the whole loop at compile time
+		Bench.Run({"Static Signal (Inlined)", StaticSignal::kHandlerCount, sizeof(int), kLoopCount}, [&]()
+		{
+			int Sum = 0;
+			for( unsigned int i(0); i<kLoopCount; i+= (unsigned int)StaticSignal::kHandlerCount)
+				StaticSignal::Signal(Value, Sum);
+			return Sum == kLoopCount;
+		});
+	}
+	// Static Signal mixed with dynamic slots (5 of each)
+	{
+		zStaticEmitter<void(int, int&), &FunctionSumCallback, &FunctionSumCallback, &FunctionSumCallback, &FunctionSumCallback, &FunctionSumCallback> Emitter;
+		std::array<decltype(Emitter)::Slot, 5>	ArraySlot;
+		for( auto& SlotItem : ArraySlot)
+			SlotItem.Connect(Emitter, FunctionSumCallback);
+
+		Bench.Run({"Static Mixed Signal (Function)", 10, sizeof(int), kLoopCount}, [&]()
+		{
+			int Sum = 0;
+			for( unsigned int i(0); i<kLoopCount; i+= 10)
+				Emitter.Signal(1, Sum);
+			return Sum == kLoopCount;
+		});
+	}
+	// Packed Signal/Slot Emitter with Function
+	{
+		zPackedEmitter<int, int&>				Emitter;
+		std::array<decltype(Emitter)::Slot, 10>	ArraySlot;
+		for( auto& SlotItem : ArraySlot)
+			SlotItem.Connect(Emitter, FunctionSumCallback);
+
+		Bench.Run({"Packed Signal (Function)", 10, sizeof(int), kLoopCount}, [&]()
+		{
+			int Sum = 0;
+			for( unsigned int i(0); i<kLoopCount; i+= (unsigned int)ArraySlot.size())
+				Emitter.Signal(1, Sum);
+			return Sum == kLoopCount;
+		});
+	}
+	// Priority Signal/Slot Emitter with Function (slots connected in mixed priority order)
+	{
+		zPriorityEmitter<int, int&>				Emitter;
+		std::array<decltype(Emitter)::Slot, 10>	ArraySlot;
+		for( size_t i(0); i<ArraySlot.size(); ++i )
+			ArraySlot[i].Connect(Emitter, FunctionSumCallback, (i*5) % decltype(Emitter)::kPriorityCount);
+
+		Bench.Run({"Priority Signal (Function)", 10, sizeof(int), kLoopCount}, [&]()
+		{
+			int Sum = 0;
+			for( unsigned int i(0); i<kLoopCount; i+= (unsigned int)ArraySlot.size())
+				Emitter.Signal(1, Sum);
+			return Sum == kLoopCount;
+		});
+	}
+	// Result Signal/Slot Emitter with Function, summing returned values instead of an out-parameter
+	{
+		zResultEmitter<int(int), zCombinerSum<int>>	Emitter;
+		std::array<decltype(Emitter)::Slot, 10>		ArraySlot;
+		for( auto& SlotItem : ArraySlot)
+			SlotItem.Connect(Emitter, FunctionReturnCallback);
+
+		Bench.Run({"Result Signal (Sum)", 10, sizeof(int), kLoopCount}, [&]()
+		{
+			int Sum = 0;
+			for( unsigned int i(0); i<kLoopCount; i+= (unsigned int)ArraySlot.size())
+				Sum += Emitter.Signal(1);
+			return Sum == kLoopCount;
+		});
+	}
+	// Reentrancy safe Signal/Slot Emitter with Function (cost of the delivery record and generation test)
+	{
+		zSafeEmitter<int, int&>					Emitter;
+		std::array<decltype(Emitter)::Slot, 10>	ArraySlot;
+		for( auto& SlotItem : ArraySlot)
+			SlotItem.Connect(Emitter, FunctionSumCallback);
+
+		Bench.Run({"Safe Signal (Function)", 10, sizeof(int), kLoopCount}, [&]()
+		{
+			int Sum = 0;
+			for( unsigned int i(0); i<kLoopCount; i+= (unsigned int)ArraySlot.size())
+				Emitter.Signal(1, Sum);
+			return Sum == kLoopCount;
+		});
+	}
+	// Objects subscribing 32 times to 4 emitters, then destroyed : with slot members
+	{
+		std::array<zEmitter<int, int&>, 4>		ArrayEmitter;
+		Bench.Run({"Slots Connect/Teardown (32)", 32, sizeof(int), kLoopCount}, [&]()
+		{
+			for( unsigned int i(0); i<kLoopCount; i+= 32 )
 			{
-				FunctorCallback(1, Sum);
+				std::array<zEmitter<int, int&>::Slot, 32> ArraySlot;
+				for( size_t SlotIdx(0); SlotIdx<ArraySlot.size(); ++SlotIdx )
+					ArraySlot[SlotIdx].Connect<&FunctionSumCallback>(ArrayEmitter[SlotIdx % ArrayEmitter.size()]);
 			}
-			ElapsedFunctorFunction	+= GetElapsedTimeUs(TimeStart);
-			assert(Sum == kLoopCount);		
-		}
-		// Functor with Lambda
+			int Sum = 0;
+			for( auto& EmitterItem : ArrayEmitter )
+				EmitterItem.Signal(1, Sum);
+			return Sum == 0;
+		});
+	}
+	// Same, with a connection scope
+	{
+		std::array<zEmitter<int, int&>, 4>		ArrayEmitter;
+		Bench.Run({"Scope Connect/Teardown (32)", 32, sizeof(int), kLoopCount}, [&]()
 		{
-			std::function<void(int, int&)> FunctorCallback = [](int InValue,int& InSumResult){ InSumResult += InValue;};
-			auto TimeStart	= std::chrono::high_resolution_clock::now();
-			int Sum			= 0;
-			for( int i(0); i<kLoopCount; ++i )
+			for( unsigned int i(0); i<kLoopCount; i+= 32 )
 			{
-				FunctorCallback(1, Sum);
+				zConnectionScope Scope;
+				for( size_t SlotIdx(0); SlotIdx<32; ++SlotIdx )
+					Scope.Connect<&FunctionSumCallback>(ArrayEmitter[SlotIdx % ArrayEmitter.size()]);
 			}
-			ElapsedFunctorLambda += GetElapsedTimeUs(TimeStart);
-			assert(Sum == kLoopCount);		
-		}
+			int Sum = 0;
+			for( auto& EmitterItem : ArrayEmitter )
+				EmitterItem.Signal(1, Sum);
+			return Sum == 0;
+		});
+	}
+	// Signal/Slot Emitter with Lambda
+	{
+		zEmitter<int, int&>						Emitter;
+		std::array<decltype(Emitter)::Slot, 10>	ArraySlot;
+		for( auto& SlotItem : ArraySlot)
+			SlotItem.Connect( Emitter, [](int InValue,int& InSumResult){ InSumResult += InValue;} );
+
+		Bench.Run({"Signal (Lambda)", 10, sizeof(int), kLoopCount}, [&]()
+		{
+			int Sum = 0;
+			for( unsigned int i(0); i<kLoopCount; i+= (unsigned int)ArraySlot.size())
+				Emitter.Signal(1, Sum);
+			return Sum == kLoopCount;
+		});
+	}
+	// Packed Signal/Slot Emitter with Lambda
+	{
+		zPackedEmitter<int, int&>				Emitter;
+		std::array<decltype(Emitter)::Slot, 10>	ArraySlot;
+		for( auto& SlotItem : ArraySlot)
+			SlotItem.Connect( Emitter, [](int InValue,int& InSumResult){ InSumResult += InValue;} );
+
+		Bench.Run({"Packed Signal (Lambda)", 10, sizeof(int), kLoopCount}, [&]()
+		{
+			int Sum = 0;
+			for( unsigned int i(0); i<kLoopCount; i+= (unsigned int)ArraySlot.size())
+				Emitter.Signal(1, Sum);
+			return Sum == kLoopCount;
+		});
+	}
+	// Queued Signal/Slot Emitter with Function (time to post all events, then to deliver them in one flush)
+	{
+		zQueuedEmitter<int, int&>				Emitter;
+		std::array<decltype(Emitter)::Slot, 10>	ArraySlot;
+		for( auto& SlotItem : ArraySlot)
+			SlotItem.Connect(Emitter, FunctionSumCallback);
+		Emitter.Reserve(kLoopCount/ArraySlot.size());
+
+		auto PostAll = [&]()
+		{
+			for( unsigned int i(0); i<kLoopCount; i+= (unsigned int)ArraySlot.size())
+				Emitter.Post(1, 0);
+			return Emitter.GetPendingCount() == kLoopCount/ArraySlot.size();
+		};
+		auto FlushAll = [&]()
+		{
+			Emitter.Flush();
+			return Emitter.GetPendingCount() == 0;
+		};
+		Bench.Run({"Queued Signal (Post)", 10, sizeof(int), kLoopCount}, PostAll, FlushAll);
+		Bench.Run({"Queued Signal (Flush)", 10, sizeof(int), kLoopCount}, FlushAll, PostAll);
+		Emitter.Flush();
+	}
+	// Signal/Slot Emitter with Function known at compile time
+	{
+		zEmitter<int, int&>						Emitter;
+		std::array<decltype(Emitter)::Slot, 10>	ArraySlot;
+		for( auto& SlotItem : ArraySlot)
+			SlotItem.Connect<&FunctionSumCallback>(Emitter);
+
+		Bench.Run({"Signal (Bind Function)", 10, sizeof(int), kLoopCount}, [&]()
+		{
+			int Sum = 0;
+			for( unsigned int i(0); i<kLoopCount; i+= (unsigned int)ArraySlot.size())
+				Emitter.Signal(1, Sum);
+			return Sum == kLoopCount;
+		});
+	}
+	// Signal/Slot Emitter with Method known at compile time
+	{
+		zEmitter<int, int&>						Emitter;
+		std::array<decltype(Emitter)::Slot, 10>	ArraySlot;
+		std::array<SumListener, 10>				ArrayListener;
+		for( size_t i(0); i<ArraySlot.size(); ++i )
+			ArraySlot[i].Connect<&SumListener::OnSignal>(Emitter, &ArrayListener[i]);
+
+		Bench.Run({"Signal (Bind Method)", 10, sizeof(int), kLoopCount}, [&]()
+		{
+			int Sum = 0;
+			for( unsigned int i(0); i<kLoopCount; i+= (unsigned int)ArraySlot.size())
+				Emitter.Signal(1, Sum);
+			return Sum == kLoopCount;
+		});
+	}
+	// Compact Signal/Slot Emitter with Method known at compile time
+	{
+		zCompactEmitter<int, int&>				Emitter;
+		std::array<decltype(Emitter)::Slot, 10>	ArraySlot;
+		std::array<SumListener, 10>				ArrayListener;
+		for( size_t i(0); i<ArraySlot.size(); ++i )
+			ArraySlot[i].Connect<&SumListener::OnSignal>(Emitter, &ArrayListener[i]);
+
+		Bench.Run({"Compact Signal (Bind Method)", 10, sizeof(int), kLoopCount}, [&]()
+		{
+			int Sum = 0;
+			for( unsigned int i(0); i<kLoopCount; i+= (unsigned int)ArraySlot.size())
+				Emitter.Signal(1, Sum);
+			return Sum == kLoopCount;
+		});
+	}
 
+	// Emitter recording its signals to a memory mapped log, then log replayed at maximum speed
+	{
+		zSignalRecorder							Recorder;
+		zRecordedEmitter<int>					Emitter(1);
+		std::array<decltype(Emitter)::Slot, 10>	ArraySlot;
+		std::array<ValueListener, 10>			ArrayListener;
+		for( size_t i(0); i<ArraySlot.size(); ++i )
+			ArraySlot[i].Connect<&ValueListener::OnSignal>(Emitter, &ArrayListener[i]);
+
+		auto SignalAll = [&]()
+		{
+			for( auto& Listener : ArrayListener )
+				Listener.mSum = 0;
+			for( unsigned int i(0); i<kLoopCount; i+= (unsigned int)ArraySlot.size())
+				Emitter.Signal(1);
+			return ArrayListener[0].mSum == (int)(kLoopCount / ArraySlot.size());
+		};
+		Bench.Run({"Recorded Signal (Off)", 10, sizeof(int), kLoopCount}, SignalAll);
+		Bench.Run({"Recorded Signal (On)", 10, sizeof(int), kLoopCount}, SignalAll,
+		[&]()
+		{
+			Recorder.Open(kReplayLogPath);
+			Emitter.SetRecorder(&Recorder);
+		});
+		Emitter.SetRecorder(nullptr);
+		Recorder.Close();
 
-		// List of Function Pointer
+		if( Bench.IsSelected("Replayed Signal (Maximum)") )
 		{
-			eastl::intrusive_list<ListFunctionPtr>	ListCallback;
-			std::array<ListFunctionPtr, 10>			ArrayCallback;
-			for( auto& item : ArrayCallback)
-				ListCallback.push_back( item );
+			Recorder.Open(kReplayLogPath);
+			Emitter.SetRecorder(&Recorder);
+			SignalAll();
+			Emitter.SetRecorder(nullptr);
+			Recorder.Close();
 
-			auto TimeStart	= std::chrono::high_resolution_clock::now();
-			int Sum			= 0;
-			for( int i(0); i<kLoopCount; i+= (int)ArrayCallback.size())
+			zSignalReplayer						Replayer;
+			const bool							bReplayOpened = Replayer.Open(kReplayLogPath);
+			Replayer.Register(1, Emitter);
+			Bench.Run({"Replayed Signal (Maximum)", 10, sizeof(int), kLoopCount}, [&]()
 			{
-				auto it = ListCallback.begin();
-				while( it != ListCallback.end() )
-				{
-					it->mpFonctionCallback(1,Sum);
-					++it;
-				}
-			}
-			ElapsedListPointer	+= GetElapsedTimeUs(TimeStart);
-			assert(Sum == kLoopCount);		
+				for( auto& Listener : ArrayListener )
+					Listener.mSum = 0;
+				return bReplayOpened && Replayer.Replay() == kLoopCount / ArraySlot.size() && ArrayListener[0].mSum == (int)(kLoopCount / ArraySlot.size());
+			});
 		}
-		// List of Functor Function
+		std::remove(kReplayLogPath);
+	}
+	// Same Signal, sent through the event bus (type index lookup), compared to the emitter directly
+	{
+		zEventBus::Emitter<SumEvent>			Emitter;
+		std::array<decltype(Emitter)::Slot, 10>	ArraySlot;
+		for( auto& SlotItem : ArraySlot)
+			SlotItem.Connect<&EventSumCallback>(Emitter);
+
+		Bench.Run({"Event Signal (Emitter)", 10, sizeof(SumEvent), kLoopCount}, [&]()
+		{
+			int Sum = 0;
+			for( unsigned int i(0); i<kLoopCount; i+= (unsigned int)ArraySlot.size())
+				Emitter.Signal(SumEvent{1, Sum});
+			return Sum == kLoopCount;
+		});
+	}
+	{
+		zEventBus								Bus;
+		std::array<zEventBus::Slot<SumEvent>, 10> ArraySlot;
+		for( auto& SlotItem : ArraySlot)
+			SlotItem.Connect<&EventSumCallback>(Bus.Get<SumEvent>());
+
+		Bench.Run({"Event Signal (Bus)", 10, sizeof(SumEvent), kLoopCount}, [&]()
+		{
+			int Sum = 0;
+			for( unsigned int i(0); i<kLoopCount; i+= (unsigned int)ArraySlot.size())
+				Bus.Signal(SumEvent{1, Sum});
+			return Sum == kLoopCount;
+		});
+	}
+
+#if ZEN_SIGNAL_COROUTINE
+	// Coroutine resumed by each signal, awaiting the next one again (one slot, compare with 'Sweep Signal')
+	{
+		zEmitter<int> Emitter;
+		Bench.Run({"Coroutine Await (Signal)", 1, sizeof(int), kLoopCount}, [&]()
 		{
-			eastl::intrusive_list<ListFunctor>	ListCallback;
-			std::array<ListFunctor, 10>			ArrayCallback;
-			for( auto& item : ArrayCallback)
-				ListCallback.push_back( item );
+			int Sum = 0;
+			zSignalTask Task = AwaitSumCoroutine(Emitter, kLoopCount, Sum);
+			for( unsigned int i(0); i<kLoopCount; ++i )
+				Emitter.Signal(1);
+			return Sum == kLoopCount && Task.IsDone();
+		});
+	}
+#endif
+
+	// Emitter firing 100 times per frame, where listeners only need the last value (time per frame)
+	{
+		zEmitter<int>							Emitter;
+		std::array<decltype(Emitter)::Slot, 10>	ArraySlot;
+		std::array<ValueListener, 10>			ArrayListener;
+		for( size_t i(0); i<ArraySlot.size(); ++i )
+			ArraySlot[i].Connect<&ValueListener::OnSignal>(Emitter, &ArrayListener[i]);
 
-			auto TimeStart		= std::chrono::high_resolution_clock::now();
-			int Sum				= 0;
-			for( int i(0); i<kLoopCount; i+= (int)ArrayCallback.size())
+		Bench.Run({"Frame Signal x100 (Emitter)", 10, sizeof(int), kFrameCount}, [&]()
+		{
+			for( auto& Listener : ArrayListener )
+				Listener.mSum = 0;
+			for( unsigned int Frame(0); Frame<kFrameCount; ++Frame )
+				for( unsigned int i(0); i<kSignalPerFrame; ++i )
+					Emitter.Signal(1);
+			return ArrayListener[0].mSum == (int)(kFrameCount*kSignalPerFrame);
+		});
+	}
+	{
+		zCoalescingEmitter<int>					Emitter;
+		std::array<decltype(Emitter)::Slot, 10>	ArraySlot;
+		std::array<ValueListener, 10>			ArrayListener;
+		for( size_t i(0); i<ArraySlot.size(); ++i )
+			ArraySlot[i].Connect<&ValueListener::OnSignal>(Emitter, &ArrayListener[i]);
+
+		Bench.Run({"Frame Signal x100 (Coalescing)", 10, sizeof(int), kFrameCount}, [&]()
+		{
+			for( auto& Listener : ArrayListener )
+				Listener.mSum = 0;
+			for( unsigned int Frame(0); Frame<kFrameCount; ++Frame )
 			{
-				auto it = ListCallback.begin();
-				while( it != ListCallback.end() )
-				{
-					it->mFunctorCallback(1,Sum);
-					++it;
-				}
+				for( unsigned int i(0); i<kSignalPerFrame; ++i )
+					Emitter.Signal(1);
+				Emitter.Flush();
 			}
-			ElapsedListFunctor	+= GetElapsedTimeUs(TimeStart);
-			assert(Sum == kLoopCount);
-		
-		}
-		// Signal/Slot Emitter with Function
+			return ArrayListener[0].mSum == (int)kFrameCount;
+		});
+	}
+
+	// Listeners filtering the entity they want themselves, vs keyed slots only invoked for their entity (time per signal)
+	{
+		zEmitter<int, int&>											Emitter;
+		std::unique_ptr<decltype(Emitter)::Slot[]>					ArraySlot(new decltype(Emitter)::Slot[kKeyedSlotCount]);
+		std::unique_ptr<EntityListener[]>							ArrayListener(new EntityListener[kKeyedSlotCount]);
+		for( unsigned int i(0); i<kKeyedSlotCount; ++i )
 		{
-			zEmitter<int, int&>						Emitter;
-			std::array<decltype(Emitter)::Slot, 10>	ArraySlot;
-			for( auto& SlotItem : ArraySlot)
-				SlotItem.Connect(Emitter, FunctionSumCallback);
+			ArrayListener[i].mEntityId = (int)i;
+			ArraySlot[i].Connect<&EntityListener::OnSignal>(Emitter, &ArrayListener[i]);
+		}
 
-			auto TimeStart				= std::chrono::high_resolution_clock::now();
-			int Sum						= 0;
-			for( int i(0); i<kLoopCount; i+= (int)ArraySlot.size())
-				Emitter.Signal(1, Sum);
-			
-			ElapsedEmitter				+= GetElapsedTimeUs(TimeStart);
-			assert(Sum == kLoopCount);
+		Bench.Run({"Filtered Signal (1 of 1000)", kKeyedSlotCount, sizeof(int), kKeyedSignalCount}, [&]()
+		{
+			int Sum = 0;
+			for( unsigned int i(0); i<kKeyedSignalCount; ++i )
+				Emitter.Signal((int)(i % kKeyedSlotCount), Sum);
+			return Sum == (int)kKeyedSignalCount;
+		});
+	}
+	{
+		zKeyedEmitter<int, int&>									Emitter;
+		std::unique_ptr<decltype(Emitter)::Slot[]>					ArraySlot(new decltype(Emitter)::Slot[kKeyedSlotCount]);
+		std::unique_ptr<EntityListener[]>							ArrayListener(new EntityListener[kKeyedSlotCount]);
+		for( unsigned int i(0); i<kKeyedSlotCount; ++i )
+		{
+			ArrayListener[i].mEntityId = (int)i;
+			ArraySlot[i].Connect<&EntityListener::OnKeyedSignal>(Emitter, (int)i, &ArrayListener[i]);
 		}
-		// Signal/Slot Emitter with Lambda
+
+		Bench.Run({"Keyed Signal (1 of 1000)", kKeyedSlotCount, sizeof(int), kKeyedSignalCount}, [&]()
 		{
-			zEmitter<int, int&>						Emitter;
-			std::array<decltype(Emitter)::Slot, 10>	ArraySlot;
-			for( auto& SlotItem : ArraySlot)
-				SlotItem.Connect( Emitter, [](int InValue,int& InSumResult){ InSumResult += InValue;} );
+			int Sum = 0;
+			for( unsigned int i(0); i<kKeyedSignalCount; ++i )
+				Emitter.Signal((int)(i % kKeyedSlotCount), Sum);
+			return Sum == (int)kKeyedSignalCount;
+		});
+	}
 
-			auto TimeStart				= std::chrono::high_resolution_clock::now();
-			int Sum						= 0;
-			for( int i(0); i<kLoopCount; i+= (int)ArraySlot.size())
-				Emitter.Signal(1, Sum);
+	// Listeners owned by shared pointers, with slots disconnected by listener destructor vs weak owner tracking
+	{
+		struct SlotListener : public ValueListener
+		{
+			zEmitter<int>::Slot mSlot;
+		};
+		zEmitter<int>										Emitter;
+		std::array<eastl::shared_ptr<SlotListener>, 10>		ArrayListener;
+		for( auto& pListener : ArrayListener )
+		{
+			pListener = eastl::make_shared<SlotListener>();
+			pListener->mSlot.Connect<&ValueListener::OnSignal>(Emitter, static_cast<ValueListener*>(pListener.get()));
+		}
 
-			ElapsedEmitterLambda		+= GetElapsedTimeUs(TimeStart);
-			assert(Sum == kLoopCount);
+		Bench.Run({"Owned Signal (Emitter)", 10, sizeof(int), kLoopCount/10}, [&]()
+		{
+			ArrayListener[0]->mSum = 0;
+			for( unsigned int i(0); i<kLoopCount/10; ++i )
+				Emitter.Signal(1);
+			return ArrayListener[0]->mSum == (int)(kLoopCount/10);
+		});
+	}
+	for( bool bLockOwners : {false, true} )
+	{
+		zWeakEmitter<int>									Emitter(bLockOwners);
+		std::array<eastl::shared_ptr<ValueListener>, 10>	ArrayListener;
+		for( auto& pListener : ArrayListener )
+		{
+			pListener = eastl::make_shared<ValueListener>();
+			Emitter.Connect<&ValueListener::OnSignal>(pListener);
 		}
+
+		Bench.Run({bLockOwners ? "Owned Signal (Weak, Lock)" : "Owned Signal (Weak)", 10, sizeof(int), kLoopCount/10}, [&]()
+		{
+			ArrayListener[0]->mSum = 0;
+			for( unsigned int i(0); i<kLoopCount/10; ++i )
+				Emitter.Signal(1);
+			return ArrayListener[0]->mSum == (int)(kLoopCount/10);
+		});
 	}
-	printf("\n Direct Function              : Time %05.02fms", ElapsedDirect/kIteration/1000.f);
-	printf("\n Function Pointer             : Time %05.02fms", ElapsedPointer/kIteration/1000.f);
-	printf("\n std::Functor (Function)      : Time %05.02fms", ElapsedFunctorFunction/kIteration/1000.f);
-	printf("\n std::Functor (Lambda)        : Time %05.02fms", ElapsedFunctorLambda/kIteration/1000.f);
-	printf("\n List Function Pointer        : Time %05.02fms", ElapsedListPointer/kIteration/1000.f);
-	printf("\n List std::Functor (function) : Time %05.02fms", ElapsedListFunctor/kIteration/1000.f);
-	printf("\n Signal (Function)            : Time %05.02fms", ElapsedEmitter/kIteration/1000.f);
-	printf("\n Signal (Lambda)              : Time %05.02fms", ElapsedEmitterLambda/kIteration/1000.f);
-}
\ No newline at end of file
+
+	// Emitters cost per callback, depending on listener count and parameter size
+	SweepEmitter<zEmitter, 4>(Bench, "Sweep Signal");
+	SweepEmitter<zEmitter, 32>(Bench, "Sweep Signal");
+	SweepEmitter<zEmitter, 256>(Bench, "Sweep Signal");
+	SweepEmitter<zPackedEmitter, 4>(Bench, "Sweep Packed Signal");
+	SweepEmitter<zPackedEmitter, 32>(Bench, "Sweep Packed Signal");
+	SweepEmitter<zPackedEmitter, 256>(Bench, "Sweep Packed Signal");
+	SweepEmitter<zSafeEmitter, 4>(Bench, "Sweep Safe Signal");
+	SweepEmitter<zSafeEmitter, 32>(Bench, "Sweep Safe Signal");
+	SweepEmitter<zSafeEmitter, 256>(Bench, "Sweep Safe Signal");
+	SweepEmitter<zCompactEmitter, 4>(Bench, "Sweep Compact Signal");
+	SweepEmitter<zCompactEmitter, 32>(Bench, "Sweep Compact Signal");
+	SweepEmitter<zCompactEmitter, 256>(Bench, "Sweep Compact Signal");
+
+	const bool bReportsWritten = Bench.WriteReports();
+	if( Bench.GetFailedCount() != 0 )
+		printf("\n Error: %u case(s) produced a wrong result", Bench.GetFailedCount());
+	return Bench.GetFailedCount() == 0 && bReportsWritten;
+}
@@ -0,0 +1,235 @@
+#include <iostream>
+#include "SignalEmitter.h"
+#include "SignalConcurrentEmitter.h"
+#include "SignalAsyncEmitter.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+const unsigned int kSignalPerThread	= 200000;	// Number of signal sent by each thread, per test
+const unsigned int kSlotCount		= 10;		// Number of slots connected to the tested emitter
+const unsigned int kParallelSignalCount	= 100;	// Number of signal sent per parallel signal test
+
+void FunctionSumCallback(int InValue, int& InSumResult);
+
+//==================================================================================================
+//! @brief	Start '_ThreadCount' threads running '_Func(ThreadIndex)' at the same time
+//! @return	Elapsed time in microseconds, between start and last thread completion
+//==================================================================================================
+template<typename TFunc>
+long long RunThreads(unsigned int _ThreadCount, TFunc _Func)
+{
+	std::atomic<bool>			bStart(false);
+	std::vector<std::thread>	aThreads;
+	for( unsigned int idx(0); idx<_ThreadCount; ++idx )
+		aThreads.emplace_back([&bStart, &_Func, idx](){ while( !bStart.load() ) std::this_thread::yield(); _Func(idx); });
+
+	auto TimeStart = std::chrono::high_resolution_clock::now();
+	bStart.store(true);
+	for( auto& Thread : aThreads )
+		Thread.join();
+	return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - TimeStart).count();
+}
+
+//! Async slot target, each instance only ever invoked by the worker its slot is bound to
+struct AsyncCounter
+{
+	void		OnSignal(int InValue) { mSum += InValue; }
+	long long	mSum = 0;
+};
+
+//! Per entity update hook, independent from other entities (parallel signal target)
+struct EntityUpdater
+{
+	void		OnUpdate(float InDeltaTime)
+	{
+		for( int i(0); i<16; ++i )	// Some work per entity, to amortize the dispatch
+		{
+			mVelocity	+= -9.8f * InDeltaTime;
+			mPosition	+= mVelocity * InDeltaTime;
+		}
+		++mUpdateCount;
+	}
+	float		mPosition		= 0.f;
+	float		mVelocity		= 0.f;
+	int			mUpdateCount	= 0;
+};
+
+inline float GetSignalsPerSecond(unsigned int _ThreadCount, long long _ElapsedUs)
+{
+	return static_cast<float>(_ThreadCount) * kSignalPerThread / std::max(_ElapsedUs, 1LL);	// Signals per microsecond == Million per second
+}
+
+//==================================================================================================
+//! @brief	Multi threads benchmarks, returns false if a test produced a wrong result
+//==================================================================================================
+bool SamplePerformancesConcurrent()
+{
+	std::atomic<bool> bPassed(true);
+	const unsigned int MaxThreadCount = std::max(std::thread::hardware_concurrency(), 1u);
+	printf("\n");
+	printf("\n============================================================");
+	printf("\n Concurrent performances evaluation");
+	printf("\n (%i Signals per thread, %i Slots, Million Signals/second)", kSignalPerThread, kSlotCount);
+	printf("\n============================================================");
+	printf("\n Threads | Concurrent | zEmitter+Mutex | Concurrent+Connect/Disconnect");
+
+	for( unsigned int ThreadCount(1); ThreadCount<=MaxThreadCount; ThreadCount*=2 )
+	{
+		// Lock free emitter
+		long long ElapsedConcurrent(0);
+		{
+			zConcurrentEmitter<int, int&>						Emitter;
+			std::array<decltype(Emitter)::Slot, kSlotCount>		ArraySlot;
+			for( auto& SlotItem : ArraySlot)
+				SlotItem.Connect<&FunctionSumCallback>(Emitter);
+
+			ElapsedConcurrent = RunThreads(ThreadCount, [&Emitter, &bPassed](unsigned int)
+			{
+				int Sum = 0;
+				for( unsigned int i(0); i<kSignalPerThread; ++i )
+					Emitter.Signal(1, Sum);
+				if( Sum != (int)(kSignalPerThread*kSlotCount) )
+					bPassed.store(false);
+			});
+		}
+
+		// Regular emitter, protected by a mutex (ad-hoc solution this is replacing)
+		long long ElapsedMutex(0);
+		{
+			std::mutex											EmitterMutex;
+			zEmitter<int, int&>									Emitter;
+			std::array<decltype(Emitter)::Slot, kSlotCount>		ArraySlot;
+			for( auto& SlotItem : ArraySlot)
+				SlotItem.Connect<&FunctionSumCallback>(Emitter);
+
+			ElapsedMutex = RunThreads(ThreadCount, [&Emitter, &EmitterMutex, &bPassed](unsigned int)
+			{
+				int Sum = 0;
+				for( unsigned int i(0); i<kSignalPerThread; ++i )
+				{
+					std::lock_guard<std::mutex> Lock(EmitterMutex);
+					Emitter.Signal(1, Sum);
+				}
+				if( Sum != (int)(kSignalPerThread*kSlotCount) )
+					bPassed.store(false);
+			});
+		}
+
+		// Lock free emitter, with an extra thread continuously connecting/disconnecting a slot
+		long long ElapsedChurn(0);
+		{
+			zConcurrentEmitter<int, int&>						Emitter;
+			std::array<decltype(Emitter)::Slot, kSlotCount>		ArraySlot;
+			for( auto& SlotItem : ArraySlot)
+				SlotItem.Connect<&FunctionSumCallback>(Emitter);
+
+			std::atomic<bool> bDone(false);
+			std::thread ChurnThread([&Emitter, &bDone]()
+			{
+				while( !bDone.load() )
+				{
+					decltype(Emitter)::Slot TempSlot;
+					TempSlot.Connect<&FunctionSumCallback>(Emitter);
+				}	// Slot destructor disconnects, while other threads are signaling it
+			});
+
+			ElapsedChurn = RunThreads(ThreadCount, [&Emitter, &bPassed](unsigned int)
+			{
+				int Sum = 0;
+				for( unsigned int i(0); i<kSignalPerThread; ++i )
+					Emitter.Signal(1, Sum);
+				if( Sum < (int)(kSignalPerThread*kSlotCount) )
+					bPassed.store(false);
+			});
+			bDone.store(true);
+			ChurnThread.join();
+		}
+
+		printf("\n %7u | %10.02f | %14.02f | %10.02f", ThreadCount, GetSignalsPerSecond(ThreadCount, ElapsedConcurrent), GetSignalsPerSecond(ThreadCount, ElapsedMutex), GetSignalsPerSecond(ThreadCount, ElapsedChurn));
+	}
+
+	// Async emitter : producers only enqueue, slots are spread on a few worker threads
+	const unsigned int WorkerCount = std::max(MaxThreadCount/2, 1u);
+	zSignalWorkerPool Pool(WorkerCount);
+	printf("\n");
+	printf("\n Async emitter (%u workers, queue of 1024, Million Signals/second, until delivered)", WorkerCount);
+	printf("\n Threads | Block  | Latency(avg/max us) | Drop   | Dropped%%");
+	for( unsigned int ThreadCount(1); ThreadCount<=MaxThreadCount; ThreadCount*=2 )
+	{
+		zAsyncStats aStats[2];
+		long long	aElapsed[2];
+		for( int Policy(0); Policy<2; ++Policy )
+		{
+			zAsyncEmitter<int>									Emitter(Pool, 1024, Policy == 0 ? eSignalOverflow::Block : eSignalOverflow::Drop);
+			std::array<decltype(Emitter)::Slot, kSlotCount>		ArraySlot;
+			std::array<AsyncCounter, kSlotCount>				ArrayCounter;
+			for( unsigned int idx(0); idx<kSlotCount; ++idx )
+				ArraySlot[idx].Connect<&AsyncCounter::OnSignal>(Emitter, &ArrayCounter[idx], idx % WorkerCount);
+
+			auto TimeStart		= std::chrono::high_resolution_clock::now();
+			RunThreads(ThreadCount, [&Emitter](unsigned int)
+			{
+				for( unsigned int i(0); i<kSignalPerThread; ++i )
+					Emitter.Signal(1);
+			});
+			while( Emitter.GetStats().mQueueDepth != 0 )
+				std::this_thread::yield();
+			aElapsed[Policy]	= std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - TimeStart).count();
+			aStats[Policy]		= Emitter.GetStats();
+			Emitter.DisconnectAll();	// Waits for last message to be fully delivered
+
+			long long Sum = 0;
+			for( const auto& Counter : ArrayCounter )
+				Sum += Counter.mSum;
+			if( Policy == 0 && Sum != (long long)ThreadCount*kSignalPerThread*kSlotCount )
+				bPassed.store(false);
+		}
+		const double Posted = std::max(double(aStats[1].mPosted + aStats[1].mDropped), 1.0);
+		printf("\n %7u | %6.02f | %8.02f / %8.02f | %6.02f | %6.02f%%", ThreadCount,
+			GetSignalsPerSecond(ThreadCount, aElapsed[0]), aStats[0].GetAverageLatencyUs(), aStats[0].mMaxLatencyNs / 1000.0,
+			GetSignalsPerSecond(ThreadCount, aElapsed[1]), 100.0 * aStats[1].mDropped / Posted);
+	}
+
+	// Parallel fan-out : slots of one signal spread over the pool threads
+	zSignalParallelPool& ParallelPool = zSignalParallelPool::GetDefault();
+	printf("\n");
+	printf("\n Parallel signal (%u threads, %u slots per task, %u signals, microseconds per signal)", ParallelPool.GetWorkerCount() + 1, zConcurrentEmitter<float>::kParallelChunkSize, kParallelSignalCount);
+	printf("\n   Slots | Signal   | SignalParallel");
+	for( unsigned int SlotCount : {1000u, 10000u, 100000u} )
+	{
+		zConcurrentEmitter<float>								Emitter;
+		std::unique_ptr<decltype(Emitter)::Slot[]>				ArraySlot(new decltype(Emitter)::Slot[SlotCount]);
+		std::unique_ptr<EntityUpdater[]>						ArrayUpdater(new EntityUpdater[SlotCount]);
+		for( unsigned int idx(0); idx<SlotCount; ++idx )
+			ArraySlot[idx].Connect<&EntityUpdater::OnUpdate>(Emitter, &ArrayUpdater[idx]);
+
+		long long aElapsed[2];
+		for( int bParallel(0); bParallel<2; ++bParallel )
+		{
+			aElapsed[bParallel] = RunThreads(1, [&Emitter, bParallel](unsigned int)
+			{
+				for( unsigned int i(0); i<kParallelSignalCount; ++i )
+				{
+					if( bParallel )
+						Emitter.SignalParallel(0.016f);
+					else
+						Emitter.Signal(0.016f);
+				}
+			});
+		}
+		for( unsigned int idx(0); idx<SlotCount; ++idx )
+			if( ArrayUpdater[idx].mUpdateCount != (int)(2*kParallelSignalCount) )
+				bPassed.store(false);
+		printf("\n %7u | %8.02f | %8.02f", SlotCount, double(aElapsed[0]) / kParallelSignalCount, double(aElapsed[1]) / kParallelSignalCount);
+	}
+
+	if( !bPassed.load() )
+		printf("\n Error: A concurrent test produced a wrong result");
+	return bPassed.load();
+}
@@ -0,0 +1,296 @@
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+#include "SignalQueuedEmitter.h"
+#include "SignalConnectionScope.h"
+#include "SignalAsyncEmitter.h"
+#include "SignalWeakEmitter.h"
+#include "SignalRecorder.h"
+#if !defined(_WIN32)
+	#include <csignal>
+	#include <sys/resource.h>
+#endif
+
+//==================================================================================================
+//! @brief	Print the outcome of one regression check
+//==================================================================================================
+bool ReportRegression(const char* _zName, bool _bPassed)
+{
+	printf("\n %-50s | %s", _zName, _bPassed ? "Ok" : "FAILED");
+	return _bPassed;
+}
+
+//==================================================================================================
+//! @brief	Callback posting to its own emitter while being flushed, the ring buffer being full
+//==================================================================================================
+bool RegressionQueuedPostDuringFlush()
+{
+	const std::string					Expected("Event long enough to not fit the small string buffer");
+	zQueuedEmitter<const std::string&>	Emitter(nullptr, 4);
+	decltype(Emitter)::Slot				Slot;
+	size_t								ReceivedCount(0);
+	bool								bPassed(true);
+	Slot.Connect(Emitter, [&](const std::string& _Value)
+	{
+		Emitter.Post(Expected);		// Grows the pending events while '_Value' is still referenced
+		Emitter.Post(Expected);
+		bPassed &= _Value == Expected;
+		++ReceivedCount;
+	});
+	for( int i(0); i<4; ++i )
+		Emitter.Post(Expected);
+	Emitter.Flush();
+	return bPassed && ReceivedCount == 4 && Emitter.GetPendingCount() == 8;
+}
+
+//==================================================================================================
+//! @brief	Callback dropping pending events while being flushed
+//==================================================================================================
+bool RegressionQueuedClearDuringFlush()
+{
+	zQueuedEmitter<int>				Emitter;
+	decltype(Emitter)::Slot			Slot1, Slot2;
+	int								ReceivedCount(0);
+	Slot1.Connect(Emitter, [&](int _Value)
+	{
+		++ReceivedCount;
+		if( _Value == 1 )
+		{
+			Emitter.Post(10);
+			Emitter.ClearPending();	// Drops the remaining events of this flush and the one just posted
+		}
+	});
+	Slot2.Connect(Emitter, [&](int){ ++ReceivedCount; });
+	for( int i(0); i<4; ++i )
+		Emitter.Post(i);
+	Emitter.Flush();
+	const bool bPassed = ReceivedCount == 2 && Emitter.GetPendingCount() == 0;
+	Emitter.Post(5);
+	Emitter.Flush();
+	return bPassed && ReceivedCount == 4 && Emitter.GetPendingCount() == 0;
+}
+
+//==================================================================================================
+//! @brief	Owners destroyed by callbacks while flushing : the one receiving the batch, then the
+//!			next one to receive it
+//==================================================================================================
+bool RegressionQueuedSlotDestroyedDuringFlush()
+{
+	struct Listener
+	{
+		zQueuedEmitter<int>::Slot	mSlot;
+		int							mCount = 0;
+	};
+	zQueuedEmitter<int>					Emitter;
+	std::unique_ptr<Listener>			pFirst(new Listener), pSecond(new Listener), pThird(new Listener);
+	pFirst->mSlot.Connect(Emitter,	[&](int){ ++pFirst->mCount; pFirst.reset(); });
+	pSecond->mSlot.Connect(Emitter,	[&](int){ ++pSecond->mCount; pThird.reset(); });
+	pThird->mSlot.Connect(Emitter,	[&](int){ ++pThird->mCount; });
+	for( int i(0); i<4; ++i )
+		Emitter.Post(i);
+	Emitter.Flush();
+	return pFirst == nullptr && pThird == nullptr && pSecond->mCount == 4;
+}
+
+//==================================================================================================
+//! @brief	Queue callbacks destroying and unregistering the next queues of their dispatcher
+//==================================================================================================
+bool RegressionDispatcherQueueRemovedDuringFlush()
+{
+	zSignalDispatcher							Dispatcher;
+	zQueuedEmitter<int>							Emitter1(&Dispatcher);
+	std::unique_ptr<zQueuedEmitter<int>>		pEmitter2(new zQueuedEmitter<int>(&Dispatcher));
+	zQueuedEmitter<int>							Emitter3(&Dispatcher), Emitter4(&Dispatcher);
+	zQueuedEmitter<int>::Slot					Slot1, Slot3, Slot4;
+	int											ReceivedCount(0);
+	Slot1.Connect(Emitter1, [&](int){ ++ReceivedCount; pEmitter2.reset(); });
+	Slot3.Connect(Emitter3, [&](int){ ++ReceivedCount; Emitter4.Unregister(); });
+	Slot4.Connect(Emitter4, [&](int){ ++ReceivedCount; });
+	Emitter1.Post(1);
+	pEmitter2->Post(2);
+	Emitter3.Post(3);
+	Emitter4.Post(4);
+	Dispatcher.Flush();
+	return ReceivedCount == 2 && Emitter4.GetPendingCount() == 1;
+}
+
+//==================================================================================================
+//! @brief	Scope filled on a thread that exits, then destroyed on another one (its chunks
+//!			return to the destroying thread pool, the creating thread pool is gone)
+//==================================================================================================
+bool RegressionScopeDestroyedOnOtherThread()
+{
+	zEmitter<int>						Emitter;
+	std::unique_ptr<zConnectionScope>	pScope;
+	int									ReceivedCount(0);
+	std::thread([&]()
+	{
+		pScope.reset(new zConnectionScope);
+		for( int i(0); i<200; ++i )		// Enough slots to need several chunks
+			pScope->Connect(Emitter, [&](int){ ++ReceivedCount; });
+	}).join();
+	Emitter.Signal(1);
+	const bool bPassed = ReceivedCount == 200;
+	std::thread([&](){ pScope.reset(); }).join();
+	pScope.reset(new zConnectionScope);	// Reuse main thread pool, untouched by the other threads
+	pScope->Connect(Emitter, [&](int){ ++ReceivedCount; });
+	Emitter.Signal(1);
+	return bPassed && ReceivedCount == 201;
+}
+
+//==================================================================================================
+//! @brief	Two workers signaling each other through full 'Block' queues, from their callbacks
+//!			(each holds its worker mutex, so neither may wait for the other to make room)
+//==================================================================================================
+bool RegressionAsyncCrossWorkerBlock()
+{
+	zSignalWorkerPool			Pool(2);
+	zAsyncEmitter<int>			EmitterA(Pool, 1, eSignalOverflow::Block);
+	zAsyncEmitter<int>			EmitterB(Pool, 1, eSignalOverflow::Block);
+	decltype(EmitterA)::Slot	SlotA, SlotB;
+	std::atomic<int>			Budget(20000), SignalCountA(1), SignalCountB(1);
+	SlotA.Connect(EmitterA, [&](int)
+	{
+		for( int i(0); i<4 && Budget.fetch_sub(1) > 0; ++i, ++SignalCountB )
+			EmitterB.Signal(i);
+	}, 1);
+	SlotB.Connect(EmitterB, [&](int)
+	{
+		for( int i(0); i<4 && Budget.fetch_sub(1) > 0; ++i, ++SignalCountA )
+			EmitterA.Signal(i);
+	}, 0);
+	EmitterA.Signal(0);
+	EmitterB.Signal(0);
+
+	const auto Deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+	while( (Budget.load() > 0 || EmitterA.GetStats().mQueueDepth || EmitterB.GetStats().mQueueDepth) && std::chrono::steady_clock::now() < Deadline )
+		std::this_thread::yield();
+	const zAsyncStats StatsA = EmitterA.GetStats();
+	const zAsyncStats StatsB = EmitterB.GetStats();
+	return Budget.load() <= 0
+		&& StatsA.mPosted + StatsA.mDropped == uint64_t(SignalCountA.load())
+		&& StatsB.mPosted + StatsB.mDropped == uint64_t(SignalCountB.load());
+}
+
+//==================================================================================================
+//! @brief	Owner with 2 consecutive slots, disconnecting itself from its first callback
+//==================================================================================================
+bool RegressionWeakDisconnectDuringSignal()
+{
+	struct Listener
+	{
+		zWeakEmitter<int>*	mpEmitter	= nullptr;
+		int					mCount		= 0;
+		void				OnFirst(int)	{ ++mCount; mpEmitter->Disconnect(this); }
+		void				OnSecond(int)	{ ++mCount; }
+	};
+	zWeakEmitter<int>					Emitter;
+	eastl::shared_ptr<Listener>			pListener	= eastl::make_shared<Listener>();
+	eastl::shared_ptr<Listener>			pOther		= eastl::make_shared<Listener>();
+	pListener->mpEmitter = &Emitter;
+	Emitter.Connect<&Listener::OnFirst>(pListener);
+	Emitter.Connect<&Listener::OnSecond>(pListener);
+	Emitter.Connect<&Listener::OnSecond>(pOther);
+	Emitter.Signal(1);
+	const bool bPassed = pListener->mCount == 1 && pOther->mCount == 1 && Emitter.GetSlotCount() == 1;
+	Emitter.Signal(2);
+	return bPassed && pListener->mCount == 1 && pOther->mCount == 2;
+}
+
+//==================================================================================================
+//! @brief	Recorder log that can't grow anymore (file size limit, like a full disk) : records
+//!			are dropped, but the ones written are still replayed once closed
+//==================================================================================================
+bool RegressionRecorderGrowFailure()
+{
+#if defined(_WIN32)
+	return true;
+#else
+	const char* const		zLogPath = "SampleSignalRegression.log";
+	zSignalRecorder			Recorder;
+	zRecordedEmitter<int>	Emitter(1, &Recorder);
+	if( !Recorder.Open(zLogPath, 4096) )
+		return false;
+
+	struct rlimit PreviousLimit;
+	getrlimit(RLIMIT_FSIZE, &PreviousLimit);
+	struct rlimit Limit		= PreviousLimit;
+	Limit.rlim_cur			= 64*1024;
+	auto PreviousHandler	= std::signal(SIGXFSZ, SIG_IGN);	// Exceeding the limit fails with EFBIG instead
+	setrlimit(RLIMIT_FSIZE, &Limit);
+	for( int i(0); Recorder.GetDroppedCount() == 0 && i<1000000; ++i )
+		Emitter.Signal(i);
+	setrlimit(RLIMIT_FSIZE, &PreviousLimit);
+	std::signal(SIGXFSZ, PreviousHandler);
+	const uint64_t RecordCount = Recorder.GetRecordCount();
+	Recorder.Close();
+
+	zEmitter<int>			Replayed;
+	zEmitter<int>::Slot		Slot;
+	uint64_t				ReceivedCount(0);
+	bool					bOrdered(true);
+	Slot.Connect(Replayed, [&](int _Value){ bOrdered &= uint64_t(_Value) == ReceivedCount++; });
+	zSignalReplayer			Replayer;
+	const bool bOpened		= Replayer.Open(zLogPath);
+	Replayer.Register(1, Replayed);
+	const bool bPassed		= bOpened && Recorder.GetDroppedCount() > 0 && RecordCount > 0 && Replayer.Replay() == RecordCount && bOrdered;
+	Replayer.Close();
+	std::remove(zLogPath);
+	return bPassed;
+#endif
+}
+
+#if ZEN_SIGNAL_PROFILE
+//==================================================================================================
+//! @brief	More slots than a profiler thread table holds, connected and disconnected over time,
+//!			from short lived threads : no record dropped, results of disconnected slots kept
+//==================================================================================================
+bool RegressionProfilerSlotChurn()
+{
+	zEmitter<int>		Emitter;
+	int					ReceivedCount(0);
+	zSignalProfiler::Reset();
+	for( int ThreadIndex(0); ThreadIndex<8; ++ThreadIndex )
+	{
+		std::thread([&]()
+		{
+			for( uint32_t i(0); i<zSignalProfiler::kMaxSlots; ++i )
+			{
+				std::unique_ptr<zEmitter<int>::Slot> pSlot(new zEmitter<int>::Slot);
+				pSlot->Connect(Emitter, [&](int){ ++ReceivedCount; });
+				Emitter.Signal(1);
+			}
+		}).join();
+	}
+	zSignalProfiler::Stat TopStat;
+	const bool bHasResult = zSignalProfiler::GetTopSlots(&TopStat, 1) == 1 && TopStat.mCount > 0;
+	return ReceivedCount == 8 * int(zSignalProfiler::kMaxSlots) && zSignalProfiler::GetDroppedCount() == 0 && bHasResult;
+}
+#endif
+
+//==================================================================================================
+//! @brief	Edge cases of emitters (reentrancy, threads), returns false if one of them failed
+//==================================================================================================
+bool SampleRegressions()
+{
+	printf("\n");
+	printf("\n============================================================");
+	printf("\n Regression checks");
+	printf("\n============================================================");
+	bool bPassed = true;
+	bPassed &= ReportRegression("zQueuedEmitter Post during Flush, reference param",	RegressionQueuedPostDuringFlush());
+	bPassed &= ReportRegression("zQueuedEmitter ClearPending during Flush",				RegressionQueuedClearDuringFlush());
+	bPassed &= ReportRegression("zQueuedEmitter slot owners destroyed during Flush",		RegressionQueuedSlotDestroyedDuringFlush());
+	bPassed &= ReportRegression("zSignalDispatcher queues removed during Flush",		RegressionDispatcherQueueRemovedDuringFlush());
+	bPassed &= ReportRegression("zConnectionScope destroyed on another thread",			RegressionScopeDestroyedOnOtherThread());
+	bPassed &= ReportRegression("zAsyncEmitter Block between 2 workers",				RegressionAsyncCrossWorkerBlock());
+	bPassed &= ReportRegression("zWeakEmitter Disconnect(owner) from its callback",	RegressionWeakDisconnectDuringSignal());
+	bPassed &= ReportRegression("zSignalRecorder log replayed after failing to grow",	RegressionRecorderGrowFailure());
+#if ZEN_SIGNAL_PROFILE
+	bPassed &= ReportRegression("zSignalProfiler slot churn on short lived threads",	RegressionProfilerSlotChurn());
+#endif
+	return bPassed;
+}
@@ -1,5 +1,12 @@
 #include <iostream>
 #include "SignalEmitter.h"
+#include "SignalResultEmitter.h"
+#include "SignalConnectionScope.h"
+#include "SignalEventBus.h"
+#include "SignalKeyedEmitter.h"
+#include "SignalCoalescingEmitter.h"
+#include "SignalWeakEmitter.h"
+#include "SignalStaticEmitter.h"
 
 //==================================================================================================
 //! @class	ClassWithSlot
@@ -32,8 +39,9 @@ public:
 	inline void ConnectSlotSignalB(zEmitter<float,bool>& InEmitter)	
 	{		
 		// Here we connect the Slot to a method of this class. 
-		// std:bind will create a functor that can invoke this object 'SlotSignalB' method
-		mSlotSignalB.Connect(InEmitter, std::bind(&ClassWithSlot::SlotSignalB, this, std::placeholders::_1, std::placeholders::_2));
+		// Method is known at compile time, so the callback invokes this object 'SlotSignalB' directly
+		// (std::bind(&ClassWithSlot::SlotSignalB, this, ...) would also work, through a functor)
+		mSlotSignalB.Connect<&ClassWithSlot::SlotSignalB>(InEmitter, this);
 	}
 
 protected:
@@ -71,6 +79,37 @@ void SlotCallbackSignalB(float inValue, bool inDisconnect)
 }
 
 
+//! Event sent through the event bus, listeners don't need to know who sends it
+struct EventPlayerDamaged
+{
+	int		mPlayerId;
+	float	mDamage;
+};
+
+//! Systems always listening to the same events, wired at compile time (zStaticSignal)
+struct AudioSystem
+{
+	void OnLevelLoaded(int inLevel) { printf("\n %s : LevelLoaded triggered, Level=%i", "Audio   ", inLevel); }
+};
+AudioSystem gAudioSystem;
+
+void MetricsOnLevelLoaded(int inLevel)
+{
+	printf("\n %s : LevelLoaded triggered, Level=%i", "Metrics ", inLevel);
+}
+
+#if ZEN_SIGNAL_COROUTINE
+//! Multi steps sequence written as a coroutine, instead of a listener state machine
+zSignalTask SequenceLoadThenKey(zEmitter<>& inOnLoaded, zEmitter<int>& inOnKey)
+{
+	printf("\n %s : Waiting for load", "Sequence");
+	co_await inOnLoaded.Next();
+	printf("\n %s : Loaded, waiting for key", "Sequence");
+	int Key = co_await inOnKey.Next();
+	printf("\n %s : Key=%i received, done", "Sequence", Key);
+}
+#endif
+
 void SampleUseage()
 {
 	printf("\n");
@@ -124,4 +163,140 @@ void SampleUseage()
 	printf("\nNote: Only 1 slot should receive signal");
 	EmitterSignalB.Signal(2, false); 
 
+	//----------------------------------------------------------------------------------------------
+	// Query signals : slots return a value, merged by a combiner.
+	// 'StopOnTrue' skips remaining slots once one handled the request
+	//----------------------------------------------------------------------------------------------
+	zResultEmitter<bool(int), zCombinerStopOnTrue>	EmitterHandleKey;
+	decltype(EmitterHandleKey)::Slot				SlotHandleKeyMenu;
+	decltype(EmitterHandleKey)::Slot				SlotHandleKeyGame;
+	SlotHandleKeyMenu.Connect(EmitterHandleKey, [](int inKey)
+	{
+		printf("\n %s : HandleKey(%i) %s", "Menu    ", inKey, inKey == 27 ? "Handled" : "Ignored");
+		return inKey == 27;
+	});
+	SlotHandleKeyGame.Connect(EmitterHandleKey, [](int inKey)
+	{
+		printf("\n %s : HandleKey(%i) %s", "Game    ", inKey, "Handled");
+		return true;
+	});
+	printf("\n\n-------- HandleKey(27) --------");
+	printf("\nNote: Only 'Menu' should receive signal");
+	printf("\n Handled=%s", EmitterHandleKey.Signal(27) ? "True" : "False");
+	printf("\n\n-------- HandleKey(32) --------");
+	printf("\n Handled=%s", EmitterHandleKey.Signal(32) ? "True" : "False");
+
+	// 'Sum' combiner, used instead of the emitter default one
+	zResultEmitter<float(int)>				EmitterWeight;
+	decltype(EmitterWeight)::Slot			SlotWeight1, SlotWeight2;
+	SlotWeight1.Connect(EmitterWeight, [](int inItem){ return inItem * 0.5f; });
+	SlotWeight2.Connect(EmitterWeight, [](int inItem){ return inItem * 0.25f; });
+	zCombinerSum<float> WeightSum;
+	EmitterWeight.Combine(WeightSum, 4);
+	printf("\n\n-------- Weight(4) --------");
+	printf("\n Sum=%03.1f Last=%03.1f", WeightSum.GetResult(), EmitterWeight.Signal(4));
+
+	//----------------------------------------------------------------------------------------------
+	// Connection scope : slots of different emitter types owned by one object,
+	// all disconnected together when it is cleared or destroyed
+	//----------------------------------------------------------------------------------------------
+	{
+		zConnectionScope Scope;
+		Scope.Connect(EmitterSignalA, [](int inValue){ printf("\n %s : SignalA triggered, Value=%i", "Scope   ", inValue); });
+		Scope.Connect(EmitterSignalB, [](float inValue, bool){ printf("\n %s : SignalB triggered, Value=%03.1f", "Scope   ", inValue); });
+		printf("\n\n-------- SignalA(3) + SignalB(3, false) with Scope (%i slots) --------", (int)Scope.GetCount());
+		EmitterSignalA.Signal(3);
+		EmitterSignalB.Signal(3, false);
+	}
+	printf("\n\n-------- SignalA(4) after Scope destruction --------");
+	EmitterSignalA.Signal(4);
+
+	//----------------------------------------------------------------------------------------------
+	// Event bus : emitters found by event type, so sender and listeners only share the event struct
+	//----------------------------------------------------------------------------------------------
+	zEventBus::Slot<EventPlayerDamaged> SlotPlayerDamaged;
+	SlotPlayerDamaged.Connect(zEventBus::GetDefault().Get<EventPlayerDamaged>(), [](const EventPlayerDamaged& inEvent)
+	{
+		printf("\n %s : PlayerDamaged triggered, Player=%i Damage=%03.1f", "Bus     ", inEvent.mPlayerId, inEvent.mDamage);
+	});
+	printf("\n\n-------- EventPlayerDamaged{1, 12.5} --------");
+	zEventBus::GetDefault().Signal(EventPlayerDamaged{1, 12.5f});
+
+#if ZEN_SIGNAL_COROUTINE
+	//----------------------------------------------------------------------------------------------
+	// Coroutine awaiting signals : 'co_await Emitter.Next()' suspends until next Signal,
+	// with no allocation besides the coroutine frame
+	//----------------------------------------------------------------------------------------------
+	{
+		zEmitter<>		EmitterLoaded;
+		zEmitter<int>	EmitterKey;
+		printf("\n\n-------- Coroutine sequence --------");
+		zSignalTask		Sequence = SequenceLoadThenKey(EmitterLoaded, EmitterKey);
+		EmitterKey.Signal(1);		// Ignored, sequence waits for load first
+		EmitterLoaded.Signal();
+		EmitterKey.Signal(2);
+	}
+
+#endif
+	//----------------------------------------------------------------------------------------------
+	// Keyed signals : slots listen to one entity id, other entities slots are never invoked.
+	// Wildcard slots receive every key
+	//----------------------------------------------------------------------------------------------
+	zKeyedEmitter<int, float>				EmitterEntityMoved;
+	decltype(EmitterEntityMoved)::Slot		SlotEntity1, SlotEntity2, SlotEntityAll;
+	SlotEntity1.Connect(EmitterEntityMoved, 1, [](const int& inEntity, float inDistance){ printf("\n %s : EntityMoved triggered, Entity=%i Distance=%03.1f", "Entity1 ", inEntity, inDistance); });
+	SlotEntity2.Connect(EmitterEntityMoved, 2, [](const int& inEntity, float inDistance){ printf("\n %s : EntityMoved triggered, Entity=%i Distance=%03.1f", "Entity2 ", inEntity, inDistance); });
+	SlotEntityAll.ConnectAll(EmitterEntityMoved, [](const int& inEntity, float inDistance){ printf("\n %s : EntityMoved triggered, Entity=%i Distance=%03.1f", "Wildcard", inEntity, inDistance); });
+	printf("\n\n-------- EntityMoved(2, 5.0) --------");
+	printf("\nNote: Only 'Entity2' and 'Wildcard' should receive signal");
+	EmitterEntityMoved.Signal(2, 5.f);
+
+	//----------------------------------------------------------------------------------------------
+	// Coalescing signals : many signals per frame, slots invoked once on flush with last values.
+	// A merge callback can accumulate them instead (scroll deltas here)
+	//----------------------------------------------------------------------------------------------
+	zCoalescingEmitter<int, int>			EmitterResize;
+	decltype(EmitterResize)::Slot			SlotResize;
+	SlotResize.Connect(EmitterResize, [](int inWidth, int inHeight){ printf("\n %s : Resize triggered, Size=%ix%i", "Window  ", inWidth, inHeight); });
+	EmitterResize.Signal(800, 600);
+	EmitterResize.Signal(1024, 768);
+	EmitterResize.Signal(1280, 720);
+	printf("\n\n-------- Resize x3, then Flush --------");
+	printf("\nNote: Slot should receive signal once, with last size");
+	EmitterResize.Flush();
+
+	zCoalescingEmitter<float>				EmitterScroll([](std::tuple<float>& inPending, float inDelta){ std::get<0>(inPending) += inDelta; });
+	decltype(EmitterScroll)::Slot			SlotScroll;
+	SlotScroll.Connect(EmitterScroll, [](float inDelta){ printf("\n %s : Scroll triggered, Delta=%03.1f", "Window  ", inDelta); });
+	EmitterScroll.Signal(1.f);
+	EmitterScroll.Signal(2.5f);
+	printf("\n\n-------- Scroll(1.0) + Scroll(2.5), then Flush --------");
+	EmitterScroll.Flush();
+
+	//----------------------------------------------------------------------------------------------
+	// Weak slots : listener owned by a shared pointer, automatically disconnected once released
+	//----------------------------------------------------------------------------------------------
+	struct SaveListener
+	{
+		void OnSave(const char* inPath) { printf("\n %s : Save triggered, Path=%s", "Listener", inPath); }
+	};
+	zWeakEmitter<const char*>				EmitterSave;
+	eastl::shared_ptr<SaveListener>			pSaveListener = eastl::make_shared<SaveListener>();
+	EmitterSave.Connect<&SaveListener::OnSave>(pSaveListener);
+	printf("\n\n-------- Save(\"Slot1.sav\") --------");
+	EmitterSave.Signal("Slot1.sav");
+	pSaveListener.reset();
+	printf("\n\n-------- Save(\"Slot2.sav\"), after releasing listener --------");
+	printf("\nNote: Nothing should receive signal");
+	EmitterSave.Signal("Slot2.sav");
+
+	//----------------------------------------------------------------------------------------------
+	// Static signals : handlers known at compile time are direct calls, no connection needed.
+	// zStaticEmitter also accepts regular slots, invoked after the static handlers
+	//----------------------------------------------------------------------------------------------
+	zStaticEmitter<void(int), zStaticMethod<&AudioSystem::OnLevelLoaded, &gAudioSystem>, &MetricsOnLevelLoaded> EmitterLevelLoaded;
+	decltype(EmitterLevelLoaded)::Slot		SlotLevelLoaded;
+	SlotLevelLoaded.Connect(EmitterLevelLoaded, [](int inLevel){ printf("\n %s : LevelLoaded triggered, Level=%i", "Lambda  ", inLevel); });
+	printf("\n\n-------- LevelLoaded(3) --------");
+	EmitterLevelLoaded.Signal(3);
 }
\ No newline at end of file
@@ -0,0 +1,97 @@
+#include "SignalAsync.h"
+#include <chrono>
+
+namespace
+{
+	thread_local bool				tbIsWorkerThread = false;										//!< Set by 'Run', for the lifetime of worker threads
+}
+
+zSignalWorker::zSignalWorker()
+: mThread(&zSignalWorker::Run, this)
+{
+}
+
+zSignalWorker::~zSignalWorker()
+{
+	mbStop.store(true);
+	Wake();
+	mThread.join();
+}
+
+void zSignalWorker::Register(Channel& _Channel)
+{
+	std::lock_guard<std::recursive_mutex> Lock(mMutex);
+	if( !_Channel.mpNext )
+		mlstChannels.push_back(_Channel);
+}
+
+void zSignalWorker::Unregister(Channel& _Channel)
+{
+	std::lock_guard<std::recursive_mutex> Lock(mMutex);
+	if( _Channel.mpNext )
+	{
+		eastl::intrusive_list<Channel>::remove(_Channel);
+		_Channel.mpNext = _Channel.mpPrev = nullptr;
+	}
+}
+
+void zSignalWorker::Wake()
+{
+	{
+		std::lock_guard<std::mutex> Lock(mSleepMutex);
+		mbWakeRequested = true;
+	}
+	mSleepCondition.notify_one();
+}
+
+bool zSignalWorker::HasPending()
+{
+	std::lock_guard<std::recursive_mutex> Lock(mMutex);
+	for( const Channel& ChannelItem : mlstChannels )
+		if( ChannelItem.HasPending() )
+			return true;
+	return false;
+}
+
+bool zSignalWorker::IsAnyWorkerThread()
+{
+	return tbIsWorkerThread;
+}
+
+void zSignalWorker::Run()
+{
+	tbIsWorkerThread = true;
+	while( !mbStop.load(std::memory_order_relaxed) )
+	{
+		size_t Delivered = 0;
+		{
+			std::lock_guard<std::recursive_mutex> Lock(mMutex);
+			auto it = mlstChannels.begin();
+			while( it != mlstChannels.end() )
+			{
+				Channel& ChannelItem = *it++; //Increment before draining, so if a callback unregisters the channel, won't affect iteration
+				Delivered += ChannelItem.Drain(kMaxBatch);
+			}
+		}
+
+		if( Delivered == 0 )
+		{
+			// Flag must be visible before testing queues (producers push, then test flag), so no post can be missed
+			mbSleeping.store(true, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			if( !HasPending() )
+			{
+				std::unique_lock<std::mutex> Lock(mSleepMutex);
+				mSleepCondition.wait_for(Lock, std::chrono::milliseconds(10), [this]{ return mbWakeRequested || mbStop.load(); });
+				mbWakeRequested = false;
+			}
+			mbSleeping.store(false);
+		}
+	}
+}
+
+zSignalWorkerPool::zSignalWorkerPool(uint32_t _WorkerCount)
+: mWorkerCount(_WorkerCount ? _WorkerCount : (std::thread::hardware_concurrency() ? std::thread::hardware_concurrency() : 1))
+, maWorkers(new zSignalWorker[mWorkerCount])
+{
+}
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <stdint.h>
+#include <thread>
+#include <EASTL/intrusive_list.h>
+
+//==================================================================================================
+//! @brief		Delivery statistics of an async emitter (sum of all its worker queues)
+//==================================================================================================
+struct zAsyncStats
+{
+	uint64_t					mPosted			= 0;													//!< Messages accepted in a queue
+	uint64_t					mDropped		= 0;													//!< Messages rejected because a queue was full
+	uint64_t					mDelivered		= 0;													//!< Messages delivered to their slots
+	uint64_t					mQueueDepth		= 0;													//!< Messages currently waiting
+	uint64_t					mMaxQueueDepth	= 0;													//!< Highest depth seen by a worker
+	uint64_t					mTotalLatencyNs	= 0;													//!< Sum of time between 'Signal' and delivery
+	uint64_t					mMaxLatencyNs	= 0;
+
+	inline double				GetAverageLatencyUs()const	{ return mDelivered ? double(mTotalLatencyNs) / double(mDelivered) / 1000.0 : 0.0; }
+	inline zAsyncStats&			operator+=(const zAsyncStats& _Other);
+};
+
+//==================================================================================================
+//! @Class		Consumer thread of async emitters
+//! @details	Owns a list of channels (one per async emitter using this worker), and drains
+//!				them in a loop. Sleeps on a condition variable once they are all empty, producers
+//!				only pay for a wake up call when the worker is actually sleeping.
+//!				The worker mutex is held while delivering a batch, so a slot disconnected from
+//!				another thread is guaranteed not to be invoked anymore once 'Disconnect' returns.
+//!				It is recursive, so callbacks can connect/disconnect slots of the same worker.
+//==================================================================================================
+class zSignalWorker
+{
+public:
+	static constexpr size_t kMaxBatch = 64;															//!< Messages delivered per channel before the worker mutex is released
+
+	//----------------------------------------------------------------------------------------------
+	//! @Class	Interface of a async emitter queue, letting worker drain it without knowing its type
+	//----------------------------------------------------------------------------------------------
+	class Channel : public eastl::intrusive_list_node
+	{
+	public:
+								Channel()					{ mpNext = mpPrev = nullptr; }
+		virtual					~Channel()					{}
+		virtual size_t			Drain(size_t _MaxCount)=0;											//!< Deliver up to _MaxCount messages, returns number delivered
+		virtual bool			HasPending()const=0;
+	};
+
+								zSignalWorker();
+								~zSignalWorker();
+								zSignalWorker(const zSignalWorker&)=delete;
+	zSignalWorker&				operator=(const zSignalWorker&)=delete;
+
+	void						Register(Channel& _Channel);
+	void						Unregister(Channel& _Channel);										//!< Once it returns, the channel isn't being drained anymore
+	inline void					NotifyPosted();														//!< Called by producers after pushing a message
+	void						Wake();
+	inline std::recursive_mutex& GetMutex()					{ return mMutex; }
+	inline bool					IsWorkerThread()const		{ return std::this_thread::get_id() == mThread.get_id(); }
+	static bool					IsAnyWorkerThread();												//!< True on the thread of any worker, of any pool
+
+protected:
+	void						Run();
+	bool						HasPending();
+
+	std::recursive_mutex		mMutex;																//!< Guards channels list and their slots
+	eastl::intrusive_list<Channel> mlstChannels;
+	std::mutex					mSleepMutex;
+	std::condition_variable		mSleepCondition;
+	bool						mbWakeRequested = false;											//!< Guarded by sleep mutex
+	std::atomic<bool>			mbSleeping{false};
+	std::atomic<bool>			mbStop{false};
+	std::thread					mThread;															//!< Started last, once everything else is constructed
+};
+
+//==================================================================================================
+//! @Class		Fixed group of workers, shared by async emitters
+//! @details	Slots choose which worker invokes them (thread affinity), or let their emitter
+//!				use its default worker, assigned round-robin when the emitter is created.
+//==================================================================================================
+class zSignalWorkerPool
+{
+public:
+	explicit					zSignalWorkerPool(uint32_t _WorkerCount=0);						//!< 0 : one per hardware thread
+	inline uint32_t				GetWorkerCount()const		{ return mWorkerCount; }
+	inline zSignalWorker&		GetWorker(uint32_t _Index)	{ return maWorkers[_Index]; }
+	inline uint32_t				PickWorkerIndex()			{ return mNextWorker.fetch_add(1, std::memory_order_relaxed) % mWorkerCount; }
+
+protected:
+	uint32_t					mWorkerCount;
+	std::unique_ptr<zSignalWorker[]> maWorkers;
+	std::atomic<uint32_t>		mNextWorker{0};
+};
+
+void zSignalWorker::NotifyPosted()
+{
+	// Pairs with the fence in 'Run' : either worker sees the message, or we see it sleeping
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if( mbSleeping.load(std::memory_order_relaxed) )
+		Wake();
+}
+
+zAsyncStats& zAsyncStats::operator+=(const zAsyncStats& _Other)
+{
+	mPosted				+= _Other.mPosted;
+	mDropped			+= _Other.mDropped;
+	mDelivered			+= _Other.mDelivered;
+	mQueueDepth			+= _Other.mQueueDepth;
+	mMaxQueueDepth		= mMaxQueueDepth > _Other.mMaxQueueDepth ? mMaxQueueDepth : _Other.mMaxQueueDepth;
+	mTotalLatencyNs		+= _Other.mTotalLatencyNs;
+	mMaxLatencyNs		= mMaxLatencyNs > _Other.mMaxLatencyNs ? mMaxLatencyNs : _Other.mMaxLatencyNs;
+	return *this;
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <EASTL/intrusive_list.h>
+#include "SignalCallback.h"
+#include "SignalAsync.h"
+#include "SignalMpscQueue.h"
+
+//==================================================================================================
+//! @brief		What 'Signal' does when a worker queue is full
+//==================================================================================================
+enum class eSignalOverflow
+{
+	Block,																							//!< Backpressure : producer waits for the worker to make room. Worker threads never wait (they drop instead), since the worker they'd wait on could be waiting on them
+	Drop,																							//!< Message is discarded for that worker, and counted in stats
+};
+
+//==================================================================================================
+//! @Class		Emitter delivering its signals on worker threads
+//! @details	'Signal' copies the parameters in a bounded lock free queue and returns, without
+//!				taking any lock. Each worker of the pool has its own queue per emitter (channel),
+//!				and only the workers with connected slots receive the message.
+//!				Slots pick the worker invoking them when connecting (thread affinity), or use
+//!				the emitter default worker. Messages are delivered in order per worker.
+//!				When a queue is full, the overflow policy either blocks the producer until the
+//!				worker catches up, or drops the message. A worker thread (of any pool) never
+//!				blocks, it drops instead : it holds its worker mutex while delivering, so two
+//!				workers signaling each other, or a thread connecting a slot of a blocked worker,
+//!				could otherwise wait on each other forever.
+//!				Parameters are stored decayed, reference parameters receive the stored copy.
+//!				Pending messages are discarded when the emitter is destroyed. The pool must
+//!				outlive its emitters, and an emitter can't be destroyed by one of its own slots.
+//! @Example	zSignalWorkerPool Pool(2);
+//!				zAsyncEmitter<int> Emitter(Pool);
+//!				zAsyncEmitter<int>::Slot Slot;
+//!				Slot.Connect(Emitter, [](int _Value){ ... }, 1);	// Invoked by worker 1
+//!				Emitter.Signal(5);									// Returns right away
+//==================================================================================================
+template<typename... TParameters>
+class zAsyncEmitter
+{
+protected:
+	class Channel;
+public:
+	typedef zCallback<void(TParameters...)> Callback;
+	typedef std::tuple<typename std::decay<TParameters>::type...> Arguments;						//!< Copy of the parameters of a signal
+	static constexpr uint32_t kDefaultWorker = ~0u;
+
+	//==============================================================================================
+	//! @brief	Callback invoked by a worker, unlinked from its emitter when destroyed
+	//==============================================================================================
+	class Slot : public eastl::intrusive_list_node
+	{
+	public:
+								Slot()						{ mpNext = mpPrev = nullptr; }
+		virtual					~Slot()						{ Disconnect(); }
+								Slot(const Slot&)=delete;
+		Slot&					operator=(const Slot&)=delete;
+
+		void					Connect(zAsyncEmitter& _Emitter, const Callback& _Callback, uint32_t _WorkerIndex=kDefaultWorker);
+		template<auto TFunction>
+		inline void				Connect(zAsyncEmitter& _Emitter, uint32_t _WorkerIndex=kDefaultWorker)						{ Connect(_Emitter, Callback::template Bind<TFunction>(), _WorkerIndex); }
+		template<auto TMethod, typename TObject>
+		inline void				Connect(zAsyncEmitter& _Emitter, TObject* _pObject, uint32_t _WorkerIndex=kDefaultWorker)	{ Connect(_Emitter, Callback::template Bind<TMethod>(_pObject), _WorkerIndex); }
+		void					Disconnect();														//!< Once it returns, callback isn't running or invoked anymore (unless called from the callback)
+		inline bool				IsConnected()const			{ return mpChannel != nullptr; }
+
+	protected:
+		Callback				mCallback;
+		Channel*				mpChannel = nullptr;
+		friend class zAsyncEmitter;
+	};
+
+								zAsyncEmitter(zSignalWorkerPool& _Pool, size_t _QueueCapacity=1024, eSignalOverflow _Overflow=eSignalOverflow::Block);
+								~zAsyncEmitter();
+								zAsyncEmitter(const zAsyncEmitter&)=delete;
+	zAsyncEmitter&				operator=(const zAsyncEmitter&)=delete;
+
+	bool						Signal(TParameters... _Values);										//!< Queue signal for each worker with slots, false if a worker dropped it
+	void						DisconnectAll();
+	zAsyncStats					GetStats()const;
+	inline uint32_t				GetDefaultWorker()const		{ return mDefaultWorker; }
+
+protected:
+	struct Message
+	{
+		Arguments				mArguments;
+		uint64_t				mPostTimeNs = 0;
+	};
+
+	//----------------------------------------------------------------------------------------------
+	//! @brief	Queue and slots of this emitter, drained by one worker
+	//! @details	Queue is only allocated once a slot uses this worker, and then kept until the
+	//!				emitter is destroyed, so producers can read it without locking.
+	//!				Slots list and consumer stats are guarded by the worker mutex.
+	//----------------------------------------------------------------------------------------------
+	class Channel : public zSignalWorker::Channel
+	{
+	public:
+		virtual size_t			Drain(size_t _MaxCount)override;
+		virtual bool			HasPending()const override;
+		void					Remove(Slot& _Slot);
+		inline Slot*			GetNext(Slot& _Slot)		{ return &_Slot != &mlstSlots.back() ? static_cast<Slot*>(_Slot.mpNext) : nullptr; }
+
+		zSignalWorker*					mpWorker	= nullptr;
+		std::atomic<zMpscQueue<Message>*> mpQueue{nullptr};
+		std::atomic<uint32_t>			mSlotCount{0};
+		eastl::intrusive_list<Slot>		mlstSlots;
+		Slot*							mpNextSlot	= nullptr;											//!< Drain iteration cursor, moved when its slot is removed
+		std::atomic<uint64_t>			mDropped{0};
+		uint64_t						mDelivered		= 0;
+		uint64_t						mMaxQueueDepth	= 0;
+		uint64_t						mTotalLatencyNs	= 0;
+		uint64_t						mMaxLatencyNs	= 0;
+	};
+
+	static inline uint64_t		GetTimeNs();
+
+	zSignalWorkerPool&			mPool;
+	std::unique_ptr<Channel[]>	maChannels;															//!< One per pool worker
+	size_t						mQueueCapacity;
+	eSignalOverflow				mOverflow;
+	uint32_t					mDefaultWorker;
+};
+
+#include "SignalAsyncEmitter.inl"
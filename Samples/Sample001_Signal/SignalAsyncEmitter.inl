@@ -0,0 +1,174 @@
+
+#include <chrono>
+#include <thread>
+
+template<typename... TParameters>
+void zAsyncEmitter<TParameters...>::Slot::Connect(zAsyncEmitter& _Emitter, const Callback& _Callback, uint32_t _WorkerIndex)
+{
+	Disconnect();
+	const uint32_t WorkerIndex	= _WorkerIndex == kDefaultWorker ? _Emitter.mDefaultWorker : _WorkerIndex % _Emitter.mPool.GetWorkerCount();
+	Channel& ChannelItem		= _Emitter.maChannels[WorkerIndex];
+	std::lock_guard<std::recursive_mutex> Lock(ChannelItem.mpWorker->GetMutex());
+	if( !ChannelItem.mpQueue.load(std::memory_order_relaxed) )
+	{
+		ChannelItem.mpQueue.store(new zMpscQueue<Message>(_Emitter.mQueueCapacity), std::memory_order_release);
+		ChannelItem.mpWorker->Register(ChannelItem);
+	}
+	mCallback	= _Callback;
+	mpChannel	= &ChannelItem;
+	ChannelItem.mlstSlots.push_back(*this);
+	ChannelItem.mSlotCount.fetch_add(1, std::memory_order_release);
+}
+
+template<typename... TParameters>
+void zAsyncEmitter<TParameters...>::Slot::Disconnect()
+{
+	Channel* pChannel = mpChannel;
+	if( pChannel )
+	{
+		std::lock_guard<std::recursive_mutex> Lock(pChannel->mpWorker->GetMutex());	// Waits for the worker to finish its current batch
+		pChannel->Remove(*this);
+	}
+}
+
+template<typename... TParameters>
+void zAsyncEmitter<TParameters...>::Channel::Remove(Slot& _Slot)
+{
+	if( mpNextSlot == &_Slot )
+		mpNextSlot = GetNext(_Slot);
+	eastl::intrusive_list<Slot>::remove(_Slot);
+	_Slot.mpNext = _Slot.mpPrev = nullptr;
+	_Slot.mpChannel = nullptr;
+	mSlotCount.fetch_sub(1, std::memory_order_relaxed);
+}
+
+template<typename... TParameters>
+size_t zAsyncEmitter<TParameters...>::Channel::Drain(size_t _MaxCount)
+{
+	zMpscQueue<Message>* pQueue = mpQueue.load(std::memory_order_relaxed);
+	const uint64_t Depth		= pQueue->GetSize();
+	mMaxQueueDepth				= Depth > mMaxQueueDepth ? Depth : mMaxQueueDepth;
+
+	Message Msg;
+	size_t Count = 0;
+	while( Count < _MaxCount && pQueue->TryPop(Msg) )
+	{
+		const uint64_t LatencyNs	= GetTimeNs() - Msg.mPostTimeNs;
+		mTotalLatencyNs				+= LatencyNs;
+		mMaxLatencyNs				= LatencyNs > mMaxLatencyNs ? LatencyNs : mMaxLatencyNs;
+		++mDelivered;
+		++Count;
+
+		mpNextSlot = mlstSlots.empty() ? nullptr : &mlstSlots.front();
+		while( mpNextSlot )
+		{
+			Slot& SlotItem	= *mpNextSlot;
+			mpNextSlot		= GetNext(SlotItem); //Advance before invoking callback, 'Remove' moves the cursor if callback removes the next slot
+			std::apply(SlotItem.mCallback, Msg.mArguments);
+		}
+	}
+	return Count;
+}
+
+template<typename... TParameters>
+bool zAsyncEmitter<TParameters...>::Channel::HasPending()const
+{
+	const zMpscQueue<Message>* pQueue = mpQueue.load(std::memory_order_relaxed);
+	return pQueue && pQueue->GetSize() != 0;
+}
+
+template<typename... TParameters>
+uint64_t zAsyncEmitter<TParameters...>::GetTimeNs()
+{
+	return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+template<typename... TParameters>
+zAsyncEmitter<TParameters...>::zAsyncEmitter(zSignalWorkerPool& _Pool, size_t _QueueCapacity, eSignalOverflow _Overflow)
+: mPool(_Pool)
+, maChannels(new Channel[_Pool.GetWorkerCount()])
+, mQueueCapacity(_QueueCapacity)
+, mOverflow(_Overflow)
+, mDefaultWorker(_Pool.PickWorkerIndex())
+{
+	for( uint32_t i(0); i<mPool.GetWorkerCount(); ++i )
+		maChannels[i].mpWorker = &mPool.GetWorker(i);
+}
+
+template<typename... TParameters>
+zAsyncEmitter<TParameters...>::~zAsyncEmitter()
+{
+	DisconnectAll();
+	for( uint32_t i(0); i<mPool.GetWorkerCount(); ++i )
+	{
+		Channel& ChannelItem = maChannels[i];
+		ChannelItem.mpWorker->Unregister(ChannelItem);
+		delete ChannelItem.mpQueue.load(std::memory_order_relaxed);
+	}
+}
+
+template<typename... TParameters>
+bool zAsyncEmitter<TParameters...>::Signal(TParameters... _Values)
+{
+	bool bQueued			= true;
+	const uint64_t TimeNs	= GetTimeNs();
+	for( uint32_t i(0); i<mPool.GetWorkerCount(); ++i )
+	{
+		Channel& ChannelItem = maChannels[i];
+		if( ChannelItem.mSlotCount.load(std::memory_order_acquire) == 0 )
+			continue;
+
+		zMpscQueue<Message>* pQueue = ChannelItem.mpQueue.load(std::memory_order_acquire);
+		Message Msg{Arguments(_Values...), TimeNs};
+		bool bPushed = pQueue->TryPush(std::move(Msg));
+		while( !bPushed && mOverflow == eSignalOverflow::Block && !zSignalWorker::IsAnyWorkerThread() )
+		{
+			ChannelItem.mpWorker->Wake();
+			std::this_thread::yield();
+			bPushed = pQueue->TryPush(std::move(Msg));
+		}
+
+		if( bPushed )
+			ChannelItem.mpWorker->NotifyPosted();
+		else
+		{
+			ChannelItem.mDropped.fetch_add(1, std::memory_order_relaxed);
+			bQueued = false;
+		}
+	}
+	return bQueued;
+}
+
+template<typename... TParameters>
+void zAsyncEmitter<TParameters...>::DisconnectAll()
+{
+	for( uint32_t i(0); i<mPool.GetWorkerCount(); ++i )
+	{
+		Channel& ChannelItem = maChannels[i];
+		std::lock_guard<std::recursive_mutex> Lock(ChannelItem.mpWorker->GetMutex());
+		while( !ChannelItem.mlstSlots.empty() )
+			ChannelItem.Remove(ChannelItem.mlstSlots.front());
+	}
+}
+
+template<typename... TParameters>
+zAsyncStats zAsyncEmitter<TParameters...>::GetStats()const
+{
+	zAsyncStats Stats;
+	for( uint32_t i(0); i<mPool.GetWorkerCount(); ++i )
+	{
+		const Channel& ChannelItem			= maChannels[i];
+		const zMpscQueue<Message>* pQueue	= ChannelItem.mpQueue.load(std::memory_order_acquire);
+		zAsyncStats ChannelStats;
+		std::lock_guard<std::recursive_mutex> Lock(ChannelItem.mpWorker->GetMutex());
+		ChannelStats.mPosted				= pQueue ? pQueue->GetPushCount() : 0;
+		ChannelStats.mQueueDepth			= pQueue ? pQueue->GetSize() : 0;
+		ChannelStats.mDropped				= ChannelItem.mDropped.load(std::memory_order_relaxed);
+		ChannelStats.mDelivered				= ChannelItem.mDelivered;
+		ChannelStats.mMaxQueueDepth			= ChannelItem.mMaxQueueDepth;
+		ChannelStats.mTotalLatencyNs		= ChannelItem.mTotalLatencyNs;
+		ChannelStats.mMaxLatencyNs			= ChannelItem.mMaxLatencyNs;
+		Stats += ChannelStats;
+	}
+	return Stats;
+}
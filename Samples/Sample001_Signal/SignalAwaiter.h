@@ -0,0 +1,85 @@
+#pragma once
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include "SignalEmitter.h"
+
+//==================================================================================================
+//! @Class		Awaitable wait for the next signal of a zEmitter, returned by 'zEmitter::Next()'
+//! @details	It is a Slot living in the coroutine frame : suspending connects it to the emitter
+//!				(no heap allocation), and the next 'Signal' disconnects it and resumes the coroutine
+//!				with a copy of the parameters (nothing for no parameter, the value for one, a
+//!				tuple otherwise). The coroutine runs inside 'Signal', until it suspends again.
+//!				Awaiters are connected in front of the emitter slots, so awaiting again the same
+//!				emitter right after being resumed waits for the following signal.
+//!				Destroying a suspended coroutine disconnects its awaiter. Like other slots, a
+//!				resumed coroutine can't disconnect other slots of the emitter signaling it.
+//! @Example	zSignalTask Sequence(zEmitter<>& _OnLoaded, zEmitter<int>& _OnKey)
+//!				{
+//!					co_await _OnLoaded.Next();
+//!					int Key = co_await _OnKey.Next();
+//!				}
+//==================================================================================================
+template<typename... TParameters>
+class zSignalAwaiter : protected zEmitter<TParameters...>::Slot
+{
+public:
+	typedef std::tuple<typename std::decay<TParameters>::type...> Arguments;
+	typedef typename std::conditional<sizeof...(TParameters) == 0, void,
+			typename std::conditional<sizeof...(TParameters) == 1, typename std::tuple_element<0, std::tuple<typename std::decay<TParameters>::type..., void>>::type,
+			Arguments>::type>::type Result;															//!< Value returned by 'co_await'
+
+	explicit					zSignalAwaiter(zEmitter<TParameters...>& _Emitter) : mEmitter(_Emitter) {}
+								zSignalAwaiter(const zSignalAwaiter&)=delete;
+	zSignalAwaiter&				operator=(const zSignalAwaiter&)=delete;
+
+	inline bool					await_ready()const noexcept	{ return false; }
+	void						await_suspend(std::coroutine_handle<> _Handle);
+	Result						await_resume();
+
+protected:
+	typedef typename zEmitter<TParameters...>::Slot Slot;
+	void						Receive(TParameters... _Values);
+
+	zEmitter<TParameters...>&	mEmitter;
+	std::coroutine_handle<>		mHandle;
+	std::optional<Arguments>	mArguments;
+};
+
+//==================================================================================================
+//! @Class		Coroutine return type owning its frame, for sequences of awaited signals
+//! @details	Coroutine starts right away, and runs until its first 'co_await'. Destroying the
+//!				task destroys the coroutine if it didn't complete yet (waiting is cancelled).
+//!				The frame is the only allocation, done once when the coroutine starts.
+//==================================================================================================
+class zSignalTask
+{
+public:
+	struct promise_type
+	{
+		inline zSignalTask			get_return_object()			{ return zSignalTask(std::coroutine_handle<promise_type>::from_promise(*this)); }
+		inline std::suspend_never	initial_suspend()noexcept	{ return {}; }
+		inline std::suspend_always	final_suspend()noexcept		{ return {}; }			//!< Frame kept until task is destroyed, so 'IsDone' stays valid
+		inline void					return_void()				{}
+		inline void					unhandled_exception()		{ std::terminate(); }
+	};
+
+								zSignalTask()=default;
+								zSignalTask(zSignalTask&& _Move) : mHandle(_Move.mHandle) { _Move.mHandle = nullptr; }
+								~zSignalTask()				{ Reset(); }
+	inline zSignalTask&			operator=(zSignalTask&& _Move);
+								zSignalTask(const zSignalTask&)=delete;
+	zSignalTask&				operator=(const zSignalTask&)=delete;
+
+	inline bool					IsDone()const				{ return !mHandle || mHandle.done(); }
+	inline void					Reset();																//!< Destroy coroutine (cancel it when still waiting)
+
+protected:
+	explicit					zSignalTask(std::coroutine_handle<promise_type> _Handle) : mHandle(_Handle) {}
+	std::coroutine_handle<promise_type> mHandle;
+};
+
+#include "SignalAwaiter.inl"
@@ -0,0 +1,51 @@
+
+template<typename... TParameters>
+zSignalAwaiter<TParameters...> zEmitter<TParameters...>::Next()
+{
+	return zSignalAwaiter<TParameters...>(*this);
+}
+
+template<typename... TParameters>
+void zSignalAwaiter<TParameters...>::await_suspend(std::coroutine_handle<> _Handle)
+{
+	mHandle				= _Handle;
+	Slot::mCallback		= Slot::Callback::template Bind<&zSignalAwaiter::Receive>(this);
+	mEmitter.mlstSlots.push_front(*this);	//Front, so not reached again by the signal resuming us
+}
+
+template<typename... TParameters>
+typename zSignalAwaiter<TParameters...>::Result zSignalAwaiter<TParameters...>::await_resume()
+{
+	if constexpr( sizeof...(TParameters) == 1 )
+		return std::get<0>(std::move(*mArguments));
+	else if constexpr( sizeof...(TParameters) > 1 )
+		return std::move(*mArguments);
+}
+
+template<typename... TParameters>
+void zSignalAwaiter<TParameters...>::Receive(TParameters... _Values)
+{
+	mArguments.emplace(_Values...);
+	Slot::Disconnect();
+	mHandle.resume();	//Might complete the coroutine and free this awaiter, can't be accessed anymore
+}
+
+zSignalTask& zSignalTask::operator=(zSignalTask&& _Move)
+{
+	if( this != &_Move )
+	{
+		Reset();
+		mHandle			= _Move.mHandle;
+		_Move.mHandle	= nullptr;
+	}
+	return *this;
+}
+
+void zSignalTask::Reset()
+{
+	if( mHandle )
+	{
+		mHandle.destroy();
+		mHandle = nullptr;
+	}
+}
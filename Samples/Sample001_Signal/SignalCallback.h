@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+//! Bytes reserved inside each zCallback to store a functor/lambda captures (can be overridden project wide)
+#ifndef ZEN_CALLBACK_INLINE_SIZE
+	#define ZEN_CALLBACK_INLINE_SIZE (4*sizeof(void*))
+#endif
+
+template<typename TSignature, size_t TInlineSize=ZEN_CALLBACK_INLINE_SIZE>
+class zCallback;
+
+//==================================================================================================
+//! @Class		Type erased callback, stored without any heap allocation
+//! @details	Replacement for std::function, used by Slots. Functors are copied in an inline buffer
+//!				of 'TInlineSize' bytes, and trying to store a bigger one is a compile error.
+//!				Invoking is a single indirect call to a stub receiving the inline buffer, no manager
+//!				involved (manager is only used for copy/destroy, and only for non trivial functors).
+//!				Functions and Methods bound with 'Bind<>' are known at compile time, and the stub
+//!				calls them directly, letting the compiler inline them.
+//! @Example	zCallback<void(int)> Callback1 = [](int inValue){ ... };
+//!				auto Callback2 = zCallback<void(int)>::Bind<&Function>();
+//!				auto Callback3 = zCallback<void(int)>::Bind<&Class::Method>(pObject);
+//==================================================================================================
+template<typename TReturn, typename... TParameters, size_t TInlineSize>
+class zCallback<TReturn(TParameters...), TInlineSize>
+{
+public:
+	typedef TReturn (*Invoker)(const void* _pStorage, TParameters...);								//!< Stub signature, receiving the inline storage and parameters
+	static constexpr size_t kInlineSize = TInlineSize;												//!< Bytes available to store functor captures
+
+								zCallback();
+								zCallback(std::nullptr_t);
+								zCallback(const zCallback& _Copy);
+								zCallback(zCallback&& _Move);
+								template<typename TFunctor, typename=typename std::enable_if<!std::is_same<typename std::decay<TFunctor>::type, zCallback>::value>::type>
+								zCallback(TFunctor&& _Functor);										//!< Store a copy of any callable object (lambda, function pointer, functor)
+								~zCallback();
+
+	zCallback&					operator=(const zCallback& _Copy);
+	zCallback&					operator=(zCallback&& _Move);
+	inline TReturn				operator()(TParameters... _Values)const;							//!< Invoke the stored callback
+	inline explicit				operator bool()const;												//!< True if a callback has been assigned
+
+	template<auto TFunction>
+	static zCallback			Bind();																//!< Create a callback directly calling a free function
+	template<auto TMethod, typename TObject>
+	static zCallback			Bind(TObject* _pObject);											//!< Create a callback directly calling a method on an object
+
+	inline void					Reset();															//!< Release stored functor, and revert to empty callback
+	inline Invoker				GetInvoker()const;													//!< Stub called on invoke (useful to pack callbacks contiguously)
+	inline const void*			GetStorage()const;													//!< Storage to send to the invoker stub
+
+protected:
+	enum class eManagerOp { Copy, Move, Destroy };
+	typedef void (*Manager)(eManagerOp _Op, void* _pDst, void* _pSrc);
+
+	template<typename TFunctor>	void	Assign(TFunctor&& _Functor);
+	inline void							CopyFrom(const zCallback& _Copy);
+	inline void							MoveFrom(zCallback& _Move);
+
+	static TReturn						EmptyStub(const void* _pStorage, TParameters... _Values);
+	template<typename TFunctor>
+	static TReturn						FunctorStub(const void* _pStorage, TParameters... _Values);
+	template<auto TFunction>
+	static TReturn						FunctionStub(const void* _pStorage, TParameters... _Values);
+	template<auto TMethod, typename TObject>
+	static TReturn						MethodStub(const void* _pStorage, TParameters... _Values);
+	template<typename TFunctor>
+	static void							FunctorManager(eManagerOp _Op, void* _pDst, void* _pSrc);
+
+	Invoker								mpInvoke	= &EmptyStub;									//!< Stub invoking the stored callback
+	Manager								mpManager	= nullptr;										//!< Only set for functors that are not trivially copyable/destructible
+	alignas(void*) unsigned char		mStorage[TInlineSize] = {};									//!< Inline copy of the functor (or object pointer for methods)
+};
+
+#include "SignalCallback.inl"
@@ -0,0 +1,185 @@
+
+template<typename TReturn, typename... TParameters, size_t TInlineSize>
+zCallback<TReturn(TParameters...), TInlineSize>::zCallback()
+{
+}
+
+template<typename TReturn, typename... TParameters, size_t TInlineSize>
+zCallback<TReturn(TParameters...), TInlineSize>::zCallback(std::nullptr_t)
+{
+}
+
+template<typename TReturn, typename... TParameters, size_t TInlineSize>
+zCallback<TReturn(TParameters...), TInlineSize>::zCallback(const zCallback& _Copy)
+{
+	CopyFrom(_Copy);
+}
+
+template<typename TReturn, typename... TParameters, size_t TInlineSize>
+zCallback<TReturn(TParameters...), TInlineSize>::zCallback(zCallback&& _Move)
+{
+	MoveFrom(_Move);
+}
+
+template<typename TReturn, typename... TParameters, size_t TInlineSize>
+template<typename TFunctor, typename>
+zCallback<TReturn(TParameters...), TInlineSize>::zCallback(TFunctor&& _Functor)
+{
+	Assign(std::forward<TFunctor>(_Functor));
+}
+
+template<typename TReturn, typename... TParameters, size_t TInlineSize>
+zCallback<TReturn(TParameters...), TInlineSize>::~zCallback()
+{
+	Reset();
+}
+
+template<typename TReturn, typename... TParameters, size_t TInlineSize>
+zCallback<TReturn(TParameters...), TInlineSize>& zCallback<TReturn(TParameters...), TInlineSize>::operator=(const zCallback& _Copy)
+{
+	if( this != &_Copy )
+	{
+		Reset();
+		CopyFrom(_Copy);
+	}
+	return *this;
+}
+
+template<typename TReturn, typename... TParameters, size_t TInlineSize>
+zCallback<TReturn(TParameters...), TInlineSize>& zCallback<TReturn(TParameters...), TInlineSize>::operator=(zCallback&& _Move)
+{
+	if( this != &_Move )
+	{
+		Reset();
+		MoveFrom(_Move);
+	}
+	return *this;
+}
+
+template<typename TReturn, typename... TParameters, size_t TInlineSize>
+TReturn zCallback<TReturn(TParameters...), TInlineSize>::operator()(TParameters... _Values)const
+{
+	return mpInvoke(mStorage, std::forward<TParameters>(_Values)...);
+}
+
+template<typename TReturn, typename... TParameters, size_t TInlineSize>
+zCallback<TReturn(TParameters...), TInlineSize>::operator bool()const
+{
+	return mpInvoke != &EmptyStub;
+}
+
+template<typename TReturn, typename... TParameters, size_t TInlineSize>
+template<auto TFunction>
+zCallback<TReturn(TParameters...), TInlineSize> zCallback<TReturn(TParameters...), TInlineSize>::Bind()
+{
+	zCallback Callback;
+	Callback.mpInvoke = &FunctionStub<TFunction>;
+	return Callback;
+}
+
+template<typename TReturn, typename... TParameters, size_t TInlineSize>
+template<auto TMethod, typename TObject>
+zCallback<TReturn(TParameters...), TInlineSize> zCallback<TReturn(TParameters...), TInlineSize>::Bind(TObject* _pObject)
+{
+	static_assert(std::is_member_function_pointer<decltype(TMethod)>::value, "Bind(pObject) expects a method pointer");
+	zCallback Callback;
+	new(Callback.mStorage) TObject*(_pObject);
+	Callback.mpInvoke = &MethodStub<TMethod, TObject>;
+	return Callback;
+}
+
+template<typename TReturn, typename... TParameters, size_t TInlineSize>
+void zCallback<TReturn(TParameters...), TInlineSize>::Reset()
+{
+	if( mpManager )
+		mpManager(eManagerOp::Destroy, mStorage, nullptr);
+	mpInvoke	= &EmptyStub;
+	mpManager	= nullptr;
+}
+
+template<typename TReturn, typename... TParameters, size_t TInlineSize>
+typename zCallback<TReturn(TParameters...), TInlineSize>::Invoker zCallback<TReturn(TParameters...), TInlineSize>::GetInvoker()const
+{
+	return mpInvoke;
+}
+
+template<typename TReturn, typename... TParameters, size_t TInlineSize>
+const void* zCallback<TReturn(TParameters...), TInlineSize>::GetStorage()const
+{
+	return mStorage;
+}
+
+template<typename TReturn, typename... TParameters, size_t TInlineSize>
+template<typename TFunctor>
+void zCallback<TReturn(TParameters...), TInlineSize>::Assign(TFunctor&& _Functor)
+{
+	typedef typename std::decay<TFunctor>::type Functor;
+	static_assert(sizeof(Functor) <= TInlineSize,		"Functor captures are too big for this zCallback inline storage, increase 'ZEN_CALLBACK_INLINE_SIZE' or capture less");
+	static_assert(alignof(Functor) <= alignof(void*),	"Functor alignment requirement is too strict for zCallback inline storage");
+	new(mStorage) Functor(std::forward<TFunctor>(_Functor));
+	mpInvoke	= &FunctorStub<Functor>;
+	mpManager	= std::is_trivially_copyable<Functor>::value && std::is_trivially_destructible<Functor>::value ? nullptr : &FunctorManager<Functor>;
+}
+
+template<typename TReturn, typename... TParameters, size_t TInlineSize>
+void zCallback<TReturn(TParameters...), TInlineSize>::CopyFrom(const zCallback& _Copy)
+{
+	if( _Copy.mpManager )
+		_Copy.mpManager(eManagerOp::Copy, mStorage, const_cast<unsigned char*>(_Copy.mStorage));
+	else
+		memcpy(mStorage, _Copy.mStorage, TInlineSize);
+	mpInvoke	= _Copy.mpInvoke;
+	mpManager	= _Copy.mpManager;
+}
+
+template<typename TReturn, typename... TParameters, size_t TInlineSize>
+void zCallback<TReturn(TParameters...), TInlineSize>::MoveFrom(zCallback& _Move)
+{
+	if( _Move.mpManager )
+		_Move.mpManager(eManagerOp::Move, mStorage, _Move.mStorage);
+	else
+		memcpy(mStorage, _Move.mStorage, TInlineSize);
+	mpInvoke	= _Move.mpInvoke;
+	mpManager	= _Move.mpManager;
+}
+
+template<typename TReturn, typename... TParameters, size_t TInlineSize>
+TReturn zCallback<TReturn(TParameters...), TInlineSize>::EmptyStub(const void*, TParameters...)
+{
+	return TReturn();
+}
+
+template<typename TReturn, typename... TParameters, size_t TInlineSize>
+template<typename TFunctor>
+TReturn zCallback<TReturn(TParameters...), TInlineSize>::FunctorStub(const void* _pStorage, TParameters... _Values)
+{
+	// Functors are invoked non-const (like std::function), so lambda declared 'mutable' are supported
+	return (*const_cast<TFunctor*>(static_cast<const TFunctor*>(_pStorage)))(std::forward<TParameters>(_Values)...);
+}
+
+template<typename TReturn, typename... TParameters, size_t TInlineSize>
+template<auto TFunction>
+TReturn zCallback<TReturn(TParameters...), TInlineSize>::FunctionStub(const void*, TParameters... _Values)
+{
+	return TFunction(std::forward<TParameters>(_Values)...);
+}
+
+template<typename TReturn, typename... TParameters, size_t TInlineSize>
+template<auto TMethod, typename TObject>
+TReturn zCallback<TReturn(TParameters...), TInlineSize>::MethodStub(const void* _pStorage, TParameters... _Values)
+{
+	TObject* pObject = *static_cast<TObject* const*>(_pStorage);
+	return (pObject->*TMethod)(std::forward<TParameters>(_Values)...);
+}
+
+template<typename TReturn, typename... TParameters, size_t TInlineSize>
+template<typename TFunctor>
+void zCallback<TReturn(TParameters...), TInlineSize>::FunctorManager(eManagerOp _Op, void* _pDst, void* _pSrc)
+{
+	switch( _Op )
+	{
+	case eManagerOp::Copy:		new(_pDst) TFunctor(*static_cast<const TFunctor*>(_pSrc));		break;
+	case eManagerOp::Move:		new(_pDst) TFunctor(std::move(*static_cast<TFunctor*>(_pSrc)));	break;
+	case eManagerOp::Destroy:	static_cast<TFunctor*>(_pDst)->~TFunctor();						break;
+	}
+}
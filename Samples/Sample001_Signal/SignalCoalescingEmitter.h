@@ -0,0 +1,91 @@
+#pragma once
+
+#include <optional>
+#include <stdint.h>
+#include <tuple>
+#include <type_traits>
+#include <EASTL/vector.h>
+#if defined(_MSC_VER)
+	#include <intrin.h>
+#endif
+#include "SignalCallback.h"
+
+//==================================================================================================
+//! @Class		Emitter delivering at most once per flush, with the latest (or merged) parameters
+//! @details	For high frequency events where only the final state matters (transform changed,
+//!				resize, ...). 'Signal' only records the parameters : it replaces the pending ones,
+//!				or merges them with the optional merge callback (accumulate deltas, union of
+//!				rectangles, ...). 'Flush' then invokes every dirty slot once.
+//!				Each slot has a bit in a dirty bitset, set for all connected slots by the first
+//!				signal after a flush. Slots connected after that signal are not invoked with
+//!				it, and disconnected slots are cleared. Flush scans the bitset a word (64 slots)
+//!				at a time, slots are invoked in slot index order (not connection order).
+//!				Signals sent by callbacks during 'Flush' are delivered on the next flush.
+//!				Parameters are stored decayed, reference parameters receive the stored copy.
+//!				No multi threading support.
+//! @Example	zCoalescingEmitter<int, int> EmitterResize;
+//!				EmitterResize.Signal(800, 600); EmitterResize.Signal(1024, 768);
+//!				EmitterResize.Flush();		// Slots invoked once, with (1024, 768)
+//==================================================================================================
+template<typename... TParameters>
+class zCoalescingEmitter
+{
+public:
+	typedef zCallback<void(TParameters...)> Callback;
+	typedef std::tuple<typename std::decay<TParameters>::type...> Arguments;						//!< Copy of the pending parameters
+	typedef zCallback<void(Arguments& _Pending, TParameters... _Values)> MergeCallback;			//!< Merge a new signal into the pending parameters
+
+	//----------------------------------------------------------------------------------------------
+	//! @Class	Callback invoked once per flush, removed from emitter when destroyed
+	//----------------------------------------------------------------------------------------------
+	class Slot
+	{
+	public:
+								Slot()=default;
+								~Slot()						{ Disconnect(); }
+								Slot(const Slot&)=delete;
+		Slot&					operator=(const Slot&)=delete;
+
+		void					Connect(zCoalescingEmitter& _Emitter, const Callback& _Callback);
+		template<auto TFunction>
+		inline void				Connect(zCoalescingEmitter& _Emitter)						{ Connect(_Emitter, Callback::template Bind<TFunction>()); }
+		template<auto TMethod, typename TObject>
+		inline void				Connect(zCoalescingEmitter& _Emitter, TObject* _pObject)	{ Connect(_Emitter, Callback::template Bind<TMethod>(_pObject)); }
+		void					Disconnect();
+		inline bool				IsConnected()const			{ return mpEmitter != nullptr; }
+
+	protected:
+		Callback				mCallback;
+		zCoalescingEmitter*		mpEmitter	= nullptr;
+		uint32_t				mIndex		= 0;													//!< Entry in emitter slots array and dirty bitsets
+		friend class zCoalescingEmitter;
+	};
+
+								zCoalescingEmitter()=default;
+	explicit					zCoalescingEmitter(const MergeCallback& _Merge) : mMerge(_Merge) {}
+								~zCoalescingEmitter()		{ DisconnectAll(); }
+								zCoalescingEmitter(const zCoalescingEmitter&)=delete;
+	zCoalescingEmitter&			operator=(const zCoalescingEmitter&)=delete;
+
+	void						Signal(TParameters... _Values);										//!< Record parameters, delivered on next 'Flush'
+	uint32_t					Flush();															//!< Invoke dirty slots once, returns number of slots invoked
+	void						DisconnectAll();
+	inline bool					IsPending()const			{ return mPending.has_value(); }
+	inline uint32_t				GetPendingSignalCount()const { return mPendingSignalCount; }		//!< Signals coalesced since last flush
+
+protected:
+	static constexpr uint32_t	kBitsPerWord = 64;
+	static inline void			ClearBit(eastl::vector<uint64_t>& _aBits, uint32_t _Index);
+	static inline uint32_t		GetLowestBit(uint64_t _Bits);										//!< Index of lowest set bit (_Bits must not be 0)
+
+	eastl::vector<Slot*>		mapSlots;															//!< Indexed by slot index, nullptr when free
+	eastl::vector<uint32_t>		maFreeIndices;
+	eastl::vector<uint64_t>		maDirty;															//!< Slots to invoke on next flush
+	eastl::vector<uint64_t>		maFlushing;															//!< Slots still to invoke by flush in progress
+	std::optional<Arguments>	mPending;
+	MergeCallback				mMerge;
+	uint32_t					mPendingSignalCount	= 0;
+	bool						mbFlushing			= false;
+};
+
+#include "SignalCoalescingEmitter.inl"
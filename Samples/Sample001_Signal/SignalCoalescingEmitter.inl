@@ -0,0 +1,125 @@
+
+template<typename... TParameters>
+void zCoalescingEmitter<TParameters...>::Slot::Connect(zCoalescingEmitter& _Emitter, const Callback& _Callback)
+{
+	Disconnect();
+	mCallback	= _Callback;
+	mpEmitter	= &_Emitter;
+	if( !_Emitter.maFreeIndices.empty() )
+	{
+		mIndex = _Emitter.maFreeIndices.back();
+		_Emitter.maFreeIndices.pop_back();
+		_Emitter.mapSlots[mIndex] = this;
+	}
+	else
+	{
+		mIndex = static_cast<uint32_t>(_Emitter.mapSlots.size());
+		_Emitter.mapSlots.push_back(this);
+		if( _Emitter.maDirty.size() * kBitsPerWord < _Emitter.mapSlots.size() )
+			_Emitter.maDirty.push_back(0);
+	}
+}
+
+template<typename... TParameters>
+void zCoalescingEmitter<TParameters...>::Slot::Disconnect()
+{
+	if( mpEmitter == nullptr )
+		return;
+
+	ClearBit(mpEmitter->maDirty, mIndex);
+	ClearBit(mpEmitter->maFlushing, mIndex);
+	mpEmitter->mapSlots[mIndex] = nullptr;
+	mpEmitter->maFreeIndices.push_back(mIndex);
+	mpEmitter = nullptr;
+}
+
+template<typename... TParameters>
+void zCoalescingEmitter<TParameters...>::ClearBit(eastl::vector<uint64_t>& _aBits, uint32_t _Index)
+{
+	if( _Index / kBitsPerWord < _aBits.size() )
+		_aBits[_Index / kBitsPerWord] &= ~(uint64_t(1) << (_Index % kBitsPerWord));
+}
+
+template<typename... TParameters>
+uint32_t zCoalescingEmitter<TParameters...>::GetLowestBit(uint64_t _Bits)
+{
+#if defined(_MSC_VER) && defined(_M_X64)
+	unsigned long Index;
+	_BitScanForward64(&Index, _Bits);
+	return static_cast<uint32_t>(Index);
+#elif defined(__GNUC__) || defined(__clang__)
+	return static_cast<uint32_t>(__builtin_ctzll(_Bits));
+#else
+	uint32_t Index = 0;
+	while( (_Bits & 1) == 0 )
+	{
+		_Bits >>= 1;
+		++Index;
+	}
+	return Index;
+#endif
+}
+
+template<typename... TParameters>
+void zCoalescingEmitter<TParameters...>::Signal(TParameters... _Values)
+{
+	++mPendingSignalCount;
+	if( mPending.has_value() )
+	{
+		if( mMerge )
+			mMerge(*mPending, _Values...);
+		else
+			*mPending = Arguments(_Values...);
+		return;
+	}
+
+	// First signal since last flush : every connected slot is now waiting for it
+	mPending.emplace(_Values...);
+	const uint32_t SlotCount = static_cast<uint32_t>(mapSlots.size());
+	for( uint32_t Word(0); Word<maDirty.size(); ++Word )
+		maDirty[Word] = SlotCount >= (Word + 1) * kBitsPerWord ? ~uint64_t(0) : ((uint64_t(1) << (SlotCount % kBitsPerWord)) - 1);
+	for( uint32_t FreeIndex : maFreeIndices )
+		ClearBit(maDirty, FreeIndex);
+}
+
+template<typename... TParameters>
+uint32_t zCoalescingEmitter<TParameters...>::Flush()
+{
+	if( mbFlushing || !mPending.has_value() )
+		return 0;
+
+	// Move pending state out first, so callbacks can signal the next flush
+	Arguments Values(std::move(*mPending));
+	mPending.reset();
+	mPendingSignalCount	= 0;
+	mbFlushing			= true;
+	maFlushing.swap(maDirty);
+	maDirty.resize(maFlushing.size(), 0);
+
+	uint32_t InvokedCount = 0;
+	for( uint32_t Word(0); Word<maFlushing.size(); ++Word )
+	{
+		while( maFlushing[Word] != 0 )	//Re-read after each callback, that could disconnect slots
+		{
+			const uint32_t Bit = GetLowestBit(maFlushing[Word]);
+			maFlushing[Word] &= ~(uint64_t(1) << Bit);
+			const Slot* pSlot = mapSlots[Word * kBitsPerWord + Bit];
+			std::apply(pSlot->mCallback, Values);
+			++InvokedCount;
+		}
+	}
+	mbFlushing = false;
+	return InvokedCount;
+}
+
+template<typename... TParameters>
+void zCoalescingEmitter<TParameters...>::DisconnectAll()
+{
+	for( Slot* pSlot : mapSlots )
+	{
+		if( pSlot )
+			pSlot->Disconnect();
+	}
+	mPending.reset();
+	mPendingSignalCount = 0;
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <type_traits>
+#include <utility>
+#include "SignalProfiler.h"
+
+//==================================================================================================
+//! @Class Signal/Slots system, with the smallest memory footprint per emitter and per connection
+//! @details	For very large amount of emitters/slots (per entity events), where zEmitter cost
+//!				(2 pointers per emitter, 2 list pointers + 48 bytes callback per slot) adds up.
+//!				Emitter is a single pointer to its first slot, and each slot is 32 bytes :
+//!				a singly linked 'next', a pointer to the link pointing at it (O(1) disconnect),
+//!				and a 16 bytes callback (invoker stub + context pointer).
+//!				Callbacks are limited to what fits in a context pointer : functions and methods
+//!				known at compile time, or a function receiving a user context. Functors with
+//!				captures need a zEmitter.
+//!				New slots are added in front, so they are signaled in reverse connection order.
+//!				Callbacks can only disconnect their own slot while signaled (like zEmitter).
+//!				No multi threading support.
+//! @Example	zCompactEmitter<int> Emitter;
+//!				zCompactEmitter<int>::Slot Slot;
+//!				Slot.Connect<&Listener::OnSignal>(Emitter, &ListenerItem);
+//==================================================================================================
+template<typename... TParameters>
+class zCompactEmitter
+{
+public:
+	typedef void (*Invoker)(void* _pContext, TParameters...);										//!< Callback stub, receiving the slot context
+
+	//----------------------------------------------------------------------------------------------
+	//! @Class	Class connecting a Listener to a compact event Emitter
+	//! @detail Automatically removed from emitter when destroyed.
+	//----------------------------------------------------------------------------------------------
+	class Slot
+	{
+	public:
+		typedef zCompactEmitter<TParameters...>		Emitter;										//!< Useful to get emitter type that works with this slot type
+
+	public:
+								Slot()=default;
+								Slot(const Slot&)=delete;											//!< Emitter links slot by address, cannot be copied
+								~Slot();															//!< Remove this slot from emitter, when slot is destroyed
+		Slot&					operator=(const Slot&)=delete;
+		inline void				Connect(zCompactEmitter& _Emitter, Invoker _pInvoker, void* _pContext);	//!< Bind signal to a function receiving '_pContext'
+		template<auto TFunction>
+		inline void				Connect(zCompactEmitter& _Emitter);									//!< Bind signal to a function known at compile time (direct call)
+		template<auto TMethod, typename TObject>
+		inline void				Connect(zCompactEmitter& _Emitter, TObject* _pObject);				//!< Bind signal to an object method known at compile time (direct call)
+		inline void				Disconnect();														//!< Remove this Slot from Emitter Listeners
+		inline bool				IsConnected()const			{ return mppPrevNext != nullptr; }
+
+	protected:
+		template<auto TFunction>
+		static void				FunctionStub(void* _pContext, TParameters... _Values);
+		template<auto TMethod, typename TObject>
+		static void				MethodStub(void* _pContext, TParameters... _Values);
+
+		friend class zCompactEmitter;
+		Slot*					mpNext			= nullptr;											//!< Next slot of emitter
+		Slot**					mppPrevNext		= nullptr;											//!< Link pointing to this slot (emitter head or previous slot 'mpNext')
+		Invoker					mpInvoker		= nullptr;
+		void*					mpContext		= nullptr;
+	};
+
+	//----------------------------------------------------------------------------------------------
+	// Main content of the class
+	//----------------------------------------------------------------------------------------------
+public:
+								zCompactEmitter()=default;
+								zCompactEmitter(const zCompactEmitter&)=delete;						//!< Slots link to emitter head by address, cannot be copied
+								~zCompactEmitter()			{ DisconnectAll(); }
+	zCompactEmitter&			operator=(const zCompactEmitter&)=delete;
+	inline void					Signal(TParameters..._Values)const;									//!< Signal all slots connected to this emitter
+	inline void					DisconnectAll();													//!< Remove all slots connected to this emitter
+	inline bool					IsEmpty()const				{ return mpHead == nullptr; }
+
+protected:
+	Slot*						mpHead			= nullptr;											//!< First slot, only member of emitter
+};
+
+#include "SignalCompactEmitter.inl"
@@ -0,0 +1,83 @@
+
+template<typename... TParameters>
+zCompactEmitter<TParameters...>::Slot::~Slot()
+{
+	Disconnect();
+}
+
+template<typename... TParameters>
+void zCompactEmitter<TParameters...>::Slot::Disconnect()
+{
+	if( mppPrevNext != nullptr )
+	{
+		zenSignalProfileDisconnect(this);
+		*mppPrevNext = mpNext;
+		if( mpNext )
+			mpNext->mppPrevNext = mppPrevNext;
+		mpNext		= nullptr;
+		mppPrevNext	= nullptr;
+	}
+}
+
+template<typename... TParameters>
+void zCompactEmitter<TParameters...>::Slot::Connect(zCompactEmitter& _Emitter, Invoker _pInvoker, void* _pContext)
+{
+	Disconnect();
+	mpInvoker		= _pInvoker;
+	mpContext		= _pContext;
+	mpNext			= _Emitter.mpHead;
+	mppPrevNext		= &_Emitter.mpHead;
+	if( mpNext )
+		mpNext->mppPrevNext = &mpNext;
+	_Emitter.mpHead	= this;
+}
+
+template<typename... TParameters>
+template<auto TFunction>
+void zCompactEmitter<TParameters...>::Slot::Connect(zCompactEmitter& _Emitter)
+{
+	Connect(_Emitter, &FunctionStub<TFunction>, nullptr);
+}
+
+template<typename... TParameters>
+template<auto TMethod, typename TObject>
+void zCompactEmitter<TParameters...>::Slot::Connect(zCompactEmitter& _Emitter, TObject* _pObject)
+{
+	static_assert(std::is_member_function_pointer<decltype(TMethod)>::value, "Connect(Emitter, pObject) expects a method pointer");
+	Connect(_Emitter, &MethodStub<TMethod, TObject>, const_cast<void*>(static_cast<const void*>(_pObject)));
+}
+
+template<typename... TParameters>
+template<auto TFunction>
+void zCompactEmitter<TParameters...>::Slot::FunctionStub(void* /*_pContext*/, TParameters... _Values)
+{
+	TFunction(std::forward<TParameters>(_Values)...);
+}
+
+template<typename... TParameters>
+template<auto TMethod, typename TObject>
+void zCompactEmitter<TParameters...>::Slot::MethodStub(void* _pContext, TParameters... _Values)
+{
+	(static_cast<TObject*>(_pContext)->*TMethod)(std::forward<TParameters>(_Values)...);
+}
+
+template<typename... TParameters>
+void zCompactEmitter<TParameters...>::Signal(TParameters..._Values)const
+{
+	zenSignalProfileSignal(this);
+	const Slot* pSlot = mpHead;
+	while( pSlot )
+	{
+		const Slot& SlotItem	= *pSlot;
+		pSlot					= pSlot->mpNext; //Advance before invoking callback, so if callback removes slot, won't affect iteration
+		zenSignalProfileInvoke(&SlotItem, SlotItem.mpInvoker);
+		SlotItem.mpInvoker(SlotItem.mpContext, _Values...);
+	}
+}
+
+template<typename... TParameters>
+void zCompactEmitter<TParameters...>::DisconnectAll()
+{
+	while( mpHead )
+		mpHead->Disconnect();
+}
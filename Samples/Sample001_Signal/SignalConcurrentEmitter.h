@@ -0,0 +1,109 @@
+#pragma once
+
+#include <atomic>
+#include <EASTL/vector.h>
+#include "SignalCallback.h"
+#include "SignalEpoch.h"
+#include "SignalParallel.h"
+
+//==================================================================================================
+//! @Class Signal/Slots system, safe to use from multiple threads
+//! @details	Same usage as zEmitter, but 'Signal' can be called from any number of threads,
+//!				while others 'Connect'/'Disconnect'/destroy slots.
+//!				Signal never locks : it reads an immutable snapshot (array) of the connected
+//!				nodes, inside an epoch read section (see zSignalEpoch).
+//!				Connect/Disconnect are serialized by a writer mutex, publish a new snapshot, and
+//!				retire the old one. Memory is reclaimed once no reader can still reference it.
+//!				When 'Disconnect' (or ~Slot) returns, no other thread is invoking that slot
+//!				anymore and none will, so its owner can be freed. It is safe to call it from
+//!				inside a callback, including the one being disconnected.
+//!				Emitter itself must outlive threads signaling it.
+//!				'SignalParallel' invokes the snapshot slots from several threads at once, for
+//!				emitters whose callbacks are independent (no shared state, parameters only read).
+//!				It is the caller choice : all slots of the emitter must be safe to run in parallel.
+//! @Example	Look at 'SamplePerformanceConcurrent.cpp' for usage
+//==================================================================================================
+template<typename... TParameters>
+class zConcurrentEmitter
+{
+protected:
+	struct Node;
+public:
+	//----------------------------------------------------------------------------------------------
+	//! @Class	Class connecting a Listener to a concurrent event Emitter
+	//! @detail The callback lives in a node owned by the emitter snapshots, slot only references
+	//!			it. Automatically disconnected when destroyed.
+	//----------------------------------------------------------------------------------------------
+	class Slot
+	{
+	public:
+		typedef zCallback<void(TParameters...)>		Callback;										//!< Callback function signature (no heap allocation)
+		typedef zConcurrentEmitter<TParameters...>	Emitter;										//!< Useful to get emitter type that works with this slot type
+
+	public:
+								Slot();
+								Slot(const Slot&)=delete;
+								~Slot();															//!< Disconnect, and wait for other threads invoking this slot to be done
+		Slot&					operator=(const Slot&)=delete;
+		inline void				Connect(zConcurrentEmitter& _Emitter, const Callback& _Callback);	//!< Bind signal to a function to invoke when received
+		template<auto TFunction>
+		inline void				Connect(zConcurrentEmitter& _Emitter);								//!< Bind signal to a function known at compile time (direct call)
+		template<auto TMethod, typename TObject>
+		inline void				Connect(zConcurrentEmitter& _Emitter, TObject* _pObject);			//!< Bind signal to an object method known at compile time (direct call)
+		inline void				Disconnect();														//!< Remove this Slot from Emitter Listeners, thread safe
+	protected:
+		friend class zConcurrentEmitter;
+		inline Node*			DisconnectLocked();													//!< Unlink node, and return it (writer mutex must be held)
+		zConcurrentEmitter*		mpEmitter	= nullptr;												//!< Emitter this slot is connected to (guarded by writer mutex)
+		Node*					mpNode		= nullptr;												//!< Node in emitter snapshots (guarded by writer mutex)
+	};
+
+	//----------------------------------------------------------------------------------------------
+	// Main content of the class
+	//----------------------------------------------------------------------------------------------
+public:
+								zConcurrentEmitter()=default;
+								zConcurrentEmitter(const zConcurrentEmitter&)=delete;
+								~zConcurrentEmitter();
+	zConcurrentEmitter&			operator=(const zConcurrentEmitter&)=delete;
+	static constexpr uint32_t	kParallelMinSlotCount	= 512;										//!< Default slot count below which 'SignalParallel' stays on calling thread
+	static constexpr uint32_t	kParallelChunkSize		= 128;										//!< Default slots invoked per parallel task
+
+	inline void					Signal(TParameters..._Values)const;									//!< Signal all slots connected to this emitter (lock free)
+	inline void					SignalParallel(TParameters..._Values)const;							//!< Same, with slots spread over pool threads (see 'SetParallelSettings')
+	inline void					SetParallelSettings(zSignalParallelPool* _pPool, uint32_t _MinSlotCount=kParallelMinSlotCount, uint32_t _ChunkSize=kParallelChunkSize);	//!< nullptr pool : default pool
+	inline void					DisconnectAll();													//!< Remove all slots connected to this emitter
+
+protected:
+	//! Connected callback, shared by all snapshots referencing it
+	struct Node
+	{
+		typename Slot::Callback	mCallback;
+		std::atomic<bool>		mbConnected{true};													//!< Tested before invoking, since reader can be using an outdated snapshot
+		Slot*					mpSlot;																//!< Owner (guarded by writer mutex)
+	};
+
+	//! Immutable array of nodes, read by signals
+	struct Snapshot
+	{
+		size_t					mCount;
+		inline Node**			GetNodes()			{ return reinterpret_cast<Node**>(this + 1); }
+		inline Node* const*		GetNodes()const		{ return reinterpret_cast<Node* const*>(this + 1); }
+		static Snapshot*		Create(size_t _Count);
+		static void				Delete(void* _pSnapshot);
+	};
+
+	inline void					Publish(Snapshot* _pSnapshot);										//!< Replace current snapshot, and retire the old one (writer mutex must be held)
+	inline void					AddLocked(Node* _pNode);
+	inline void					RemoveLocked(Node* _pNode);
+	static void					DeleteNode(void* _pNode);
+
+	static inline void			InvokeNodes(zSignalEpoch::ReadScope& _ReadScope, Node* const* _ppNodes, size_t _Begin, size_t _End, TParameters&... _Values);
+
+	std::atomic<Snapshot*>		mpSnapshot{nullptr};												//!< Nodes signaled, replaced on each connect/disconnect
+	zSignalParallelPool*		mpParallelPool			= nullptr;									//!< Threads used by 'SignalParallel' (nullptr : default pool)
+	uint32_t					mParallelMinSlotCount	= kParallelMinSlotCount;
+	uint32_t					mParallelChunkSize		= kParallelChunkSize;
+};
+
+#include "SignalConcurrentEmitter.inl"
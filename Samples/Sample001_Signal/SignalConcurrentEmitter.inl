@@ -0,0 +1,214 @@
+
+template<typename... TParameters>
+zConcurrentEmitter<TParameters...>::Slot::Slot()
+{
+}
+
+template<typename... TParameters>
+zConcurrentEmitter<TParameters...>::Slot::~Slot()
+{
+	Disconnect();
+}
+
+template<typename... TParameters>
+void zConcurrentEmitter<TParameters...>::Slot::Connect(zConcurrentEmitter& _Emitter, const Callback& _Callback)
+{
+	const void* pPreviousNode = nullptr;
+	{
+		std::lock_guard<std::mutex> Lock(zSignalEpoch::GetWriterMutex());
+		pPreviousNode		= DisconnectLocked();
+		Node* pNode			= new Node;
+		pNode->mCallback	= _Callback;
+		pNode->mpSlot		= this;
+		mpNode				= pNode;
+		mpEmitter			= &_Emitter;
+		_Emitter.AddLocked(pNode);
+		zSignalEpoch::Collect();
+	}
+	if( pPreviousNode )
+		zSignalEpoch::Synchronize(&pPreviousNode, 1);
+}
+
+template<typename... TParameters>
+template<auto TFunction>
+void zConcurrentEmitter<TParameters...>::Slot::Connect(zConcurrentEmitter& _Emitter)
+{
+	Connect(_Emitter, Callback::template Bind<TFunction>());
+}
+
+template<typename... TParameters>
+template<auto TMethod, typename TObject>
+void zConcurrentEmitter<TParameters...>::Slot::Connect(zConcurrentEmitter& _Emitter, TObject* _pObject)
+{
+	Connect(_Emitter, Callback::template Bind<TMethod>(_pObject));
+}
+
+template<typename... TParameters>
+void zConcurrentEmitter<TParameters...>::Slot::Disconnect()
+{
+	const void* pNode = nullptr;
+	{
+		std::lock_guard<std::mutex> Lock(zSignalEpoch::GetWriterMutex());
+		pNode = DisconnectLocked();
+		zSignalEpoch::Collect();
+	}
+	// Waiting outside the lock, so callbacks running on other threads can still connect/disconnect
+	if( pNode )
+		zSignalEpoch::Synchronize(&pNode, 1);
+}
+
+template<typename... TParameters>
+typename zConcurrentEmitter<TParameters...>::Node* zConcurrentEmitter<TParameters...>::Slot::DisconnectLocked()
+{
+	Node* pNode = mpNode;
+	if( pNode )
+	{
+		pNode->mbConnected.store(false);
+		mpEmitter->RemoveLocked(pNode);
+		mpEmitter	= nullptr;
+		mpNode		= nullptr;
+	}
+	return pNode;
+}
+
+template<typename... TParameters>
+zConcurrentEmitter<TParameters...>::~zConcurrentEmitter()
+{
+	DisconnectAll();
+}
+
+template<typename... TParameters>
+void zConcurrentEmitter<TParameters...>::Signal(TParameters..._Values)const
+{
+	zSignalEpoch::ReadScope ReadScope;
+	const Snapshot* pSnapshot = mpSnapshot.load();
+	if( pSnapshot )
+		InvokeNodes(ReadScope, pSnapshot->GetNodes(), 0, pSnapshot->mCount, _Values...);
+}
+
+template<typename... TParameters>
+void zConcurrentEmitter<TParameters...>::SignalParallel(TParameters..._Values)const
+{
+	zSignalEpoch::ReadScope ReadScope;
+	const Snapshot* pSnapshot = mpSnapshot.load();
+	if( !pSnapshot )
+		return;
+
+	Node* const* ppNodes = pSnapshot->GetNodes();
+	if( pSnapshot->mCount < mParallelMinSlotCount )
+	{
+		InvokeNodes(ReadScope, ppNodes, 0, pSnapshot->mCount, _Values...);
+		return;
+	}
+
+	// Snapshot is kept alive by this thread read section, until every chunk is done
+	zSignalParallelPool& Pool = mpParallelPool ? *mpParallelPool : zSignalParallelPool::GetDefault();
+	Pool.ParallelFor(pSnapshot->mCount, mParallelChunkSize, [&](size_t _Begin, size_t _End)
+	{
+		zSignalEpoch::ReadScope ChunkReadScope;	// Workers publish the nodes they invoke in their own thread record
+		InvokeNodes(ChunkReadScope, ppNodes, _Begin, _End, _Values...);
+	});
+}
+
+template<typename... TParameters>
+void zConcurrentEmitter<TParameters...>::SetParallelSettings(zSignalParallelPool* _pPool, uint32_t _MinSlotCount, uint32_t _ChunkSize)
+{
+	mpParallelPool			= _pPool;
+	mParallelMinSlotCount	= _MinSlotCount;
+	mParallelChunkSize		= _ChunkSize > 0 ? _ChunkSize : 1;
+}
+
+template<typename... TParameters>
+void zConcurrentEmitter<TParameters...>::InvokeNodes(zSignalEpoch::ReadScope& _ReadScope, Node* const* _ppNodes, size_t _Begin, size_t _End, TParameters&... _Values)
+{
+	for( size_t i(_Begin); i<_End; ++i )
+	{
+		// Snapshot might be outdated, make sure node wasn't disconnected since
+		Node* pNode = _ppNodes[i];
+		if( pNode->mbConnected.load() )
+		{
+			zSignalEpoch::InvokeScope InvokeScope(_ReadScope, pNode);
+			pNode->mCallback(_Values...);
+		}
+	}
+}
+
+template<typename... TParameters>
+void zConcurrentEmitter<TParameters...>::DisconnectAll()
+{
+	eastl::vector<const void*> aNodes;
+	{
+		std::lock_guard<std::mutex> Lock(zSignalEpoch::GetWriterMutex());
+		if( Snapshot* pSnapshot = mpSnapshot.load() )
+		{
+			Node** ppNodes = pSnapshot->GetNodes();
+			for( size_t i(0); i<pSnapshot->mCount; ++i )
+			{
+				Node* pNode				= ppNodes[i];
+				pNode->mbConnected.store(false);
+				pNode->mpSlot->mpEmitter= nullptr;
+				pNode->mpSlot->mpNode	= nullptr;
+				aNodes.push_back(pNode);
+				zSignalEpoch::Retire(pNode, &DeleteNode);
+			}
+			Publish(nullptr);
+		}
+		zSignalEpoch::Collect();
+	}
+	if( !aNodes.empty() )
+		zSignalEpoch::Synchronize(aNodes.data(), aNodes.size());
+}
+
+template<typename... TParameters>
+void zConcurrentEmitter<TParameters...>::Publish(Snapshot* _pSnapshot)
+{
+	Snapshot* pPrevious = mpSnapshot.exchange(_pSnapshot);
+	if( pPrevious )
+		zSignalEpoch::Retire(pPrevious, &Snapshot::Delete);
+}
+
+template<typename... TParameters>
+void zConcurrentEmitter<TParameters...>::AddLocked(Node* _pNode)
+{
+	const Snapshot* pCurrent	= mpSnapshot.load();
+	const size_t CurrentCount	= pCurrent ? pCurrent->mCount : 0;
+	Snapshot* pSnapshot			= Snapshot::Create(CurrentCount + 1);
+	for( size_t i(0); i<CurrentCount; ++i )
+		pSnapshot->GetNodes()[i] = pCurrent->GetNodes()[i];
+	pSnapshot->GetNodes()[CurrentCount] = _pNode;
+	Publish(pSnapshot);
+}
+
+template<typename... TParameters>
+void zConcurrentEmitter<TParameters...>::RemoveLocked(Node* _pNode)
+{
+	const Snapshot* pCurrent	= mpSnapshot.load();
+	Snapshot* pSnapshot			= pCurrent->mCount > 1 ? Snapshot::Create(pCurrent->mCount - 1) : nullptr;
+	for( size_t i(0), Count(0); i<pCurrent->mCount; ++i )
+	{
+		if( pCurrent->GetNodes()[i] != _pNode )
+			pSnapshot->GetNodes()[Count++] = pCurrent->GetNodes()[i];
+	}
+	Publish(pSnapshot);
+	zSignalEpoch::Retire(_pNode, &DeleteNode);
+}
+
+template<typename... TParameters>
+void zConcurrentEmitter<TParameters...>::DeleteNode(void* _pNode)
+{
+	delete static_cast<Node*>(_pNode);
+}
+
+template<typename... TParameters>
+typename zConcurrentEmitter<TParameters...>::Snapshot* zConcurrentEmitter<TParameters...>::Snapshot::Create(size_t _Count)
+{
+	Snapshot* pSnapshot	= new(::operator new(sizeof(Snapshot) + _Count * sizeof(Node*))) Snapshot;
+	pSnapshot->mCount	= _Count;
+	return pSnapshot;
+}
+
+template<typename... TParameters>
+void zConcurrentEmitter<TParameters...>::Snapshot::Delete(void* _pSnapshot)
+{
+	::operator delete(_pSnapshot);
+}
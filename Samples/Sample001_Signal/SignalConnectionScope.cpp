@@ -0,0 +1,97 @@
+#include "SignalConnectionScope.h"
+
+zConnectionPool::~zConnectionPool()
+{
+	while( mpFreeChunks )
+	{
+		Chunk* pChunk	= mpFreeChunks;
+		mpFreeChunks	= pChunk->mpNext;
+		delete pChunk;
+	}
+}
+
+zConnectionPool::Chunk* zConnectionPool::Allocate()
+{
+	if( mpFreeChunks )
+	{
+		Chunk* pChunk	= mpFreeChunks;
+		mpFreeChunks	= pChunk->mpNext;
+		pChunk->mpNext	= nullptr;
+		pChunk->mUsed	= 0;
+		return pChunk;
+	}
+	return new Chunk;
+}
+
+void zConnectionPool::Release(Chunk* _pChunkList)
+{
+	if( !_pChunkList )
+		return;
+
+	Chunk* pLast = _pChunkList;
+	while( pLast->mpNext )
+		pLast = pLast->mpNext;
+	pLast->mpNext	= mpFreeChunks;
+	mpFreeChunks	= _pChunkList;
+}
+
+zConnectionPool& zConnectionPool::GetDefault()
+{
+	thread_local zConnectionPool tPool;
+	return tPool;
+}
+
+void* zConnectionScope::AllocateRun(Destroyer _pDestroy, size_t _SlotSize)
+{
+	// Runs start on a cache line, previous run can end anywhere
+	const size_t Padding = size_t(0 - reinterpret_cast<uintptr_t>(mpCursor)) & (alignof(Header) - 1);
+	if( size_t(mpCursorEnd - mpCursor) < Padding + sizeof(Header) + _SlotSize )
+	{
+		zConnectionPool::Chunk* pChunk = GetPool().Allocate();
+		if( mpLastChunk )
+		{
+			mpLastChunk->mUsed	= size_t(mpCursor - mpLastChunk->maData);
+			mpLastChunk->mpNext	= pChunk;
+		}
+		else
+			mpFirstChunk = pChunk;
+		mpLastChunk		= pChunk;
+		mpCursor		= pChunk->maData;
+		mpCursorEnd		= pChunk->maData + zConnectionPool::kChunkSize;
+	}
+	else
+		mpCursor		+= Padding;
+
+	mpRunHeader		= new(mpCursor) Header{_pDestroy, 1};
+	mpRunDestroy	= _pDestroy;
+	void* pSlot		= mpCursor + sizeof(Header);
+	mpCursor		+= sizeof(Header) + _SlotSize;
+	return pSlot;
+}
+
+void zConnectionScope::DisconnectAll()
+{
+	if( mpLastChunk )
+		mpLastChunk->mUsed = size_t(mpCursor - mpLastChunk->maData);
+
+	// Single pass over chunks memory, slots are destroyed (thus disconnected) in creation order
+	for( zConnectionPool::Chunk* pChunk = mpFirstChunk; pChunk; pChunk = pChunk->mpNext )
+	{
+		size_t Offset = 0;
+		while( Offset < pChunk->mUsed )
+		{
+			Header* pHeader = reinterpret_cast<Header*>(&pChunk->maData[Offset]);
+			Offset			+= sizeof(Header);
+			Offset			+= pHeader->mpDestroy(&pChunk->maData[Offset], pHeader->mCount);
+			Offset			= (Offset + alignof(Header) - 1) & ~(alignof(Header) - 1);	// Skip padding before next run
+		}
+	}
+	GetPool().Release(mpFirstChunk);
+	mpFirstChunk	= nullptr;
+	mpLastChunk		= nullptr;
+	mpCursor		= nullptr;
+	mpCursorEnd		= nullptr;
+	mpRunHeader		= nullptr;
+	mpRunDestroy	= nullptr;
+	mCount			= 0;
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <stdint.h>
+#include <utility>
+
+//==================================================================================================
+//! @Class		Pool of fixed size memory chunks, used by connection scopes
+//! @details	Chunks are only recycled through a free list, and freed with the pool.
+//!				Not thread safe, the default pool is per thread. Scopes using it take their
+//!				chunks from the pool of the thread connecting, and give them back to the pool
+//!				of the thread destroying them, so a scope can outlive the thread that created it.
+//==================================================================================================
+class zConnectionPool
+{
+public:
+	static constexpr size_t kAlignment	= 64;															//!< Runs of slots start on a cache line
+	static constexpr size_t kChunkSize	= 4096 - kAlignment;											//!< Bytes usable per chunk, for slots and their headers
+
+	struct alignas(kAlignment) Chunk
+	{
+		Chunk*					mpNext	= nullptr;
+		size_t					mUsed	= 0;														//!< Bytes used in 'maData'
+		alignas(kAlignment) unsigned char maData[kChunkSize];
+	};
+
+								zConnectionPool()=default;
+								~zConnectionPool();
+								zConnectionPool(const zConnectionPool&)=delete;
+	zConnectionPool&			operator=(const zConnectionPool&)=delete;
+
+	Chunk*						Allocate();
+	void						Release(Chunk* _pChunkList);										//!< Return a linked list of chunks
+	static zConnectionPool&		GetDefault();														//!< Pool of current thread
+
+protected:
+	Chunk*						mpFreeChunks = nullptr;
+};
+
+//==================================================================================================
+//! @Class		Group of connections for any emitter type, disconnected together
+//! @details	Slots are created inside the scope, packed one after another in chunks taken
+//!				from a pool. Consecutive slots of the same type form a run, preceded by a
+//!				small header holding the run destroy function and slot count.
+//!				Destroying the scope (or 'DisconnectAll') walks this contiguous memory once,
+//!				disconnecting every slot, then gives chunks back to the pool.
+//!				An object with many subscriptions only needs one scope member, instead of
+//!				one slot member per subscription.
+//!				Works with any emitter exposing a 'Slot' type with a 'Connect(Emitter&, ...)'.
+//!				A scope given its own pool always uses that one, which must outlive it and
+//!				only be used by one thread at a time.
+//! @Example	zConnectionScope Scope;
+//!				Scope.Connect(EmitterA, [](int _Value){ ... });
+//!				Scope.Connect<&Listener::OnB>(EmitterB, &Listener);
+//==================================================================================================
+class zConnectionScope
+{
+public:
+								zConnectionScope()=default;											//!< Use the default pool of the calling thread
+	explicit					zConnectionScope(zConnectionPool& _Pool) : mpPool(&_Pool) {}
+								~zConnectionScope()			{ DisconnectAll(); }
+								zConnectionScope(const zConnectionScope&)=delete;
+	zConnectionScope&			operator=(const zConnectionScope&)=delete;
+
+	template<typename TEmitter, typename... TArgs>
+	inline typename TEmitter::Slot&	Connect(TEmitter& _Emitter, TArgs&&... _Args);					//!< Create a slot in this scope and connect it
+	template<auto TCallback, typename TEmitter, typename... TArgs>
+	inline typename TEmitter::Slot&	Connect(TEmitter& _Emitter, TArgs&&... _Args);					//!< Same, with a function or method known at compile time
+	void						DisconnectAll();													//!< Disconnect and destroy all slots of this scope
+	inline size_t				GetCount()const				{ return mCount; }
+
+protected:
+	typedef size_t				(*Destroyer)(void* _pSlots, uint32_t _Count);						//!< Destroy a run of slots, returns its size in bytes
+
+	//! Placed before each run of slots of a same type, in chunk memory (padded so cache line sized slots don't straddle 2 lines)
+	struct alignas(zConnectionPool::kAlignment) Header
+	{
+		Destroyer				mpDestroy;
+		uint32_t				mCount;
+	};
+
+	template<typename TSlot>
+	static constexpr size_t		GetSlotSize()				{ return (sizeof(TSlot) + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1); }
+	template<typename TSlot>
+	static size_t				DestroySlots(void* _pSlots, uint32_t _Count);
+	template<typename TSlot>
+	inline TSlot&				Emplace();															//!< Construct a slot in chunk memory
+	void*						AllocateRun(Destroyer _pDestroy, size_t _SlotSize);					//!< Start a new run (and chunk if needed), returns memory of its first slot
+	inline zConnectionPool&		GetPool()const				{ return mpPool ? *mpPool : zConnectionPool::GetDefault(); }
+
+	zConnectionPool*			mpPool			= nullptr;											//!< Pool given at construction, nullptr for the default pool of the current thread
+	zConnectionPool::Chunk*		mpFirstChunk	= nullptr;
+	zConnectionPool::Chunk*		mpLastChunk		= nullptr;											//!< Chunk receiving new slots ('mUsed' only updated when leaving it)
+	unsigned char*				mpCursor		= nullptr;											//!< Next free byte in last chunk
+	unsigned char*				mpCursorEnd		= nullptr;
+	Header*						mpRunHeader		= nullptr;											//!< Run receiving new slots of its type
+	Destroyer					mpRunDestroy	= nullptr;											//!< Destroy function of that run, to test slot type without touching chunk
+	size_t						mCount			= 0;
+};
+
+#include "SignalConnectionScope.inl"
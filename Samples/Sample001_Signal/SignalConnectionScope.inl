@@ -0,0 +1,46 @@
+
+template<typename TSlot>
+size_t zConnectionScope::DestroySlots(void* _pSlots, uint32_t _Count)
+{
+	unsigned char* pSlot = static_cast<unsigned char*>(_pSlots);
+	for( uint32_t i(0); i<_Count; ++i, pSlot += GetSlotSize<TSlot>() )
+		reinterpret_cast<TSlot*>(pSlot)->~TSlot();
+	return _Count * GetSlotSize<TSlot>();
+}
+
+template<typename TSlot>
+TSlot& zConnectionScope::Emplace()
+{
+	static_assert(alignof(TSlot) <= alignof(std::max_align_t), "Over-aligned slots aren't supported");
+	static_assert(sizeof(Header) + GetSlotSize<TSlot>() <= zConnectionPool::kChunkSize, "Slot too big for a connection scope chunk");
+	constexpr size_t SlotSize = GetSlotSize<TSlot>();
+
+	// Extend current run when it's the same slot type and there's room left, start a new one otherwise
+	void* pMemory;
+	if( mpRunDestroy == &DestroySlots<TSlot> && size_t(mpCursorEnd - mpCursor) >= SlotSize )
+	{
+		pMemory					= mpCursor;
+		mpCursor				+= SlotSize;
+		mpRunHeader->mCount		+= 1;
+	}
+	else
+		pMemory = AllocateRun(&DestroySlots<TSlot>, SlotSize);
+	++mCount;
+	return *new(pMemory) TSlot();
+}
+
+template<typename TEmitter, typename... TArgs>
+typename TEmitter::Slot& zConnectionScope::Connect(TEmitter& _Emitter, TArgs&&... _Args)
+{
+	typename TEmitter::Slot& SlotItem = Emplace<typename TEmitter::Slot>();
+	SlotItem.Connect(_Emitter, std::forward<TArgs>(_Args)...);
+	return SlotItem;
+}
+
+template<auto TCallback, typename TEmitter, typename... TArgs>
+typename TEmitter::Slot& zConnectionScope::Connect(TEmitter& _Emitter, TArgs&&... _Args)
+{
+	typename TEmitter::Slot& SlotItem = Emplace<typename TEmitter::Slot>();
+	SlotItem.template Connect<TCallback>(_Emitter, std::forward<TArgs>(_Args)...);
+	return SlotItem;
+}
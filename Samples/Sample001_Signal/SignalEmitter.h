@@ -1,13 +1,33 @@
 #pragma once
 
-#include <functional>
 #include <EASTL/intrusive_list.h>
+#include "SignalCallback.h"
+#include "SignalProfiler.h"
+
+//! C++20 coroutines support ('co_await Emitter.Next()'), enabled when compiler provides them
+#ifndef ZEN_SIGNAL_COROUTINE
+	#if defined(__cpp_impl_coroutine) && defined(__has_include)
+		#if __has_include(<coroutine>)
+			#define ZEN_SIGNAL_COROUTINE 1
+		#endif
+	#endif
+	#ifndef ZEN_SIGNAL_COROUTINE
+		#define ZEN_SIGNAL_COROUTINE 0
+	#endif
+#endif
+
+#if ZEN_SIGNAL_COROUTINE
+template<typename... TParameters>
+class zSignalAwaiter;
+#endif
 
 //==================================================================================================
 //! @Class Signal/Slots systems for any type of callbacks
 //! @details	This can can be used to implement events/listeners system. 
 //!				It is simple to use and fast, but no multi threading support for this version. 
 //!				A derived class can extend support for more complex behaviors, such as async messages
+//!				Callbacks can only disconnect their own slot while signaled, see zSafeEmitter
+//!				for callbacks disconnecting other slots, signaling again or destroying the emitter.
 //! @Example	Look at 'SampleSignal.cpp' for usage
 //==================================================================================================
 template<typename... TParameters>
@@ -23,14 +43,19 @@ public:
 	class Slot : public eastl::intrusive_list_node
 	{	
 	public:									
-		typedef std::function<void(TParameters...)>	Callback;										//!< Callback function signature
+		typedef zCallback<void(TParameters...)>		Callback;										//!< Callback function signature (no heap allocation)
 		typedef zEmitter<TParameters...>			Emitter;										//!< Useful to get emitter type that works with this slot type
 
 	public:
 								Slot();
 								~Slot();															//!< Remove this slot from list kept in emitter, when slot is destroyed
-		inline void				Connect(zEmitter& _Emitter,const typename Callback& _Callback);		//!< Bind signal to a function to invoke when received
+		inline void				Connect(zEmitter& _Emitter,const Callback& _Callback);				//!< Bind signal to a function to invoke when received
+		template<auto TFunction>
+		inline void				Connect(zEmitter& _Emitter);										//!< Bind signal to a function known at compile time (direct call)
+		template<auto TMethod, typename TObject>
+		inline void				Connect(zEmitter& _Emitter, TObject* _pObject);						//!< Bind signal to an object method known at compile time (direct call)
 		inline void				Disconnect();														//!< Remove this Slot from Emitter Listeners
+		inline bool				IsConnected()const;
 		inline const Callback&	GetCallback()const;
 	protected:
 		Callback				mCallback;															//!< Functions emitter should call when signaling
@@ -42,12 +67,22 @@ public:
 public:	
 	inline void					Signal(TParameters..._Values)const;									//!< Signal all slots connected to this emitter
 	inline void					DisconnectAll();													//!< Remove all slots connected to this emitter
+#if ZEN_SIGNAL_COROUTINE
+	inline zSignalAwaiter<TParameters...> Next();													//!< 'co_await' it to suspend a coroutine until next signal
+#endif
 
 protected:
 	typedef eastl::intrusive_list<Slot> SlotList;
 	friend class Slot;																				//!< Allow access to mlstSlots when calling 'Connect'	
+#if ZEN_SIGNAL_COROUTINE
+	friend class zSignalAwaiter<TParameters...>;													//!< Awaiters connect themselves in front of slots
+#endif
 	SlotList					mlstSlots;															//!< Linked list of all slots waiting for Signals	
 };
 
 #include "SignalEmitter.inl"
 
+#if ZEN_SIGNAL_COROUTINE
+	#include "SignalAwaiter.h"
+#endif
+
@@ -15,6 +15,7 @@ void zEmitter<TParameters...>::Slot::Disconnect()
 {
 	if( mpNext != nullptr )
 	{
+		zenSignalProfileDisconnect(this);
 		zEmitter::SlotList::remove(*this);
 		mpNext = nullptr;
 		mpPrev = nullptr;
@@ -22,12 +23,32 @@ void zEmitter<TParameters...>::Slot::Disconnect()
 }
 
 template<typename... TParameters>
-void zEmitter<TParameters...>::Slot::Connect(zEmitter& _Emitter, const typename Callback& _Callback)
+void zEmitter<TParameters...>::Slot::Connect(zEmitter& _Emitter, const Callback& _Callback)
 {
 	mCallback = _Callback;
 	_Emitter.mlstSlots.push_back(*this);
 }
 
+template<typename... TParameters>
+template<auto TFunction>
+void zEmitter<TParameters...>::Slot::Connect(zEmitter& _Emitter)
+{
+	Connect(_Emitter, Callback::template Bind<TFunction>());
+}
+
+template<typename... TParameters>
+template<auto TMethod, typename TObject>
+void zEmitter<TParameters...>::Slot::Connect(zEmitter& _Emitter, TObject* _pObject)
+{
+	Connect(_Emitter, Callback::template Bind<TMethod>(_pObject));
+}
+
+template<typename... TParameters>
+bool zEmitter<TParameters...>::Slot::IsConnected()const
+{
+	return mpNext != nullptr;
+}
+
 template<typename... TParameters>
 const typename zEmitter<TParameters...>::Slot::Callback& zEmitter<TParameters...>::Slot::GetCallback()const
 {
@@ -37,10 +58,12 @@ const typename zEmitter<TParameters...>::Slot::Callback& zEmitter<TParameters...
 template<typename... TParameters>
 void zEmitter<TParameters...>::Signal(TParameters..._Values)const
 {
+	zenSignalProfileSignal(this);
 	auto it = mlstSlots.begin();
 	while( it != mlstSlots.end() )
 	{
 		const Slot& slot = *it++; //Increment before invoking callback, so if callback removes slot, won't affect iteration
+		zenSignalProfileInvoke(&slot, slot.GetCallback().GetInvoker());
 		slot.GetCallback()(_Values...);
 	}	
 }
@@ -48,5 +71,6 @@ void zEmitter<TParameters...>::Signal(TParameters..._Values)const
 template<typename... TParameters>
 void zEmitter<TParameters...>::DisconnectAll()
 {
-	mlstSlots.Empty();
+	while( !mlstSlots.empty() )
+		mlstSlots.front().Disconnect();
 }
@@ -0,0 +1,120 @@
+#include "SignalEpoch.h"
+#include <thread>
+#include <EASTL/vector.h>
+
+namespace
+{
+	typedef zSignalEpoch::ThreadRecord ThreadRecord;
+
+	struct RetiredItem
+	{
+		void*					mpMemory;
+		zSignalEpoch::Deleter	mpDeleter;
+		uint64_t				mEpoch;														//!< Global epoch when item was unlinked
+	};
+
+	std::atomic<ThreadRecord*>	gpRecords{nullptr};
+	eastl::vector<RetiredItem>	gaRetired;													//!< Guarded by writer mutex
+
+	ThreadRecord* AcquireRecord()
+	{
+		for( ThreadRecord* pRecord = gpRecords.load(); pRecord; pRecord = pRecord->mpNext )
+		{
+			bool bExpected = false;
+			if( !pRecord->mbInUse.load(std::memory_order_relaxed) && pRecord->mbInUse.compare_exchange_strong(bExpected, true) )
+				return pRecord;
+		}
+		ThreadRecord* pRecord	= new ThreadRecord;
+		pRecord->mpNext			= gpRecords.load();
+		while( !gpRecords.compare_exchange_weak(pRecord->mpNext, pRecord) ) {}
+		return pRecord;
+	}
+
+	//! Release thread record when thread exits, so it can be reused by a new thread
+	struct ThreadRecordOwner
+	{
+		ThreadRecord*	mpRecord = AcquireRecord();
+						~ThreadRecordOwner()	{ mpRecord->mbInUse.store(false); }
+	};
+
+	bool IsInvokingAny(const ThreadRecord& _Record, const void* const* _ppNodes, size_t _NodeCount)
+	{
+		const uint32_t Depth = _Record.mInvokingDepth.load(std::memory_order_acquire);
+		if( Depth > zSignalEpoch::kMaxInvokingDepth )
+			return true;
+		for( uint32_t i(0); i<Depth; ++i )
+		{
+			const void* pInvoking = _Record.maInvoking[i].load(std::memory_order_relaxed);
+			for( size_t j(0); j<_NodeCount; ++j )
+				if( pInvoking == _ppNodes[j] )
+					return true;
+		}
+		return false;
+	}
+}
+
+std::atomic<uint64_t> zSignalEpoch::sGlobalEpoch{1};
+
+zSignalEpoch::ThreadRecord& zSignalEpoch::GetThreadRecord()
+{
+	thread_local ThreadRecordOwner tOwner;
+	return *tOwner.mpRecord;
+}
+
+std::mutex& zSignalEpoch::GetWriterMutex()
+{
+	static std::mutex sMutex;
+	return sMutex;
+}
+
+void zSignalEpoch::Retire(void* _pMemory, Deleter _pDeleter)
+{
+	gaRetired.push_back(RetiredItem{_pMemory, _pDeleter, sGlobalEpoch.fetch_add(1)});
+}
+
+void zSignalEpoch::Collect()
+{
+	uint64_t MinActiveEpoch = UINT64_MAX;
+	for( ThreadRecord* pRecord = gpRecords.load(); pRecord; pRecord = pRecord->mpNext )
+	{
+		const uint64_t Epoch = pRecord->mActiveEpoch.load();
+		if( Epoch != 0 && Epoch < MinActiveEpoch )
+			MinActiveEpoch = Epoch;
+	}
+
+	// Items unlinked before the oldest active reader entered, can't be referenced anymore
+	size_t KeptCount = 0;
+	for( size_t i(0); i<gaRetired.size(); ++i )
+	{
+		if( gaRetired[i].mEpoch < MinActiveEpoch )
+			gaRetired[i].mpDeleter(gaRetired[i].mpMemory);
+		else
+			gaRetired[KeptCount++] = gaRetired[i];
+	}
+	gaRetired.resize(KeptCount);
+}
+
+void zSignalEpoch::Synchronize(const void* const* _ppNodes, size_t _NodeCount)
+{
+	// Readers entering after this increment, are guaranteed to see nodes as disconnected
+	ThreadRecord& Self				= GetThreadRecord();
+	const uint64_t TargetEpoch		= sGlobalEpoch.fetch_add(1) + 1;
+	Self.mbWaiting.store(true);
+	for( ThreadRecord* pRecord = gpRecords.load(); pRecord; pRecord = pRecord->mpNext )
+	{
+		if( pRecord == &Self )
+			continue;	// This thread can be invoking a node disconnecting itself, nothing to wait for
+
+		for(;;)
+		{
+			const uint64_t Epoch = pRecord->mActiveEpoch.load();
+			if( Epoch == 0 || Epoch >= TargetEpoch )
+				break;
+			// Blocked thread will test nodes status before invoking them once resumed, only the one it's inside matters
+			if( pRecord->mbWaiting.load() && !IsInvokingAny(*pRecord, _ppNodes, _NodeCount) )
+				break;
+			std::this_thread::yield();
+		}
+	}
+	Self.mbWaiting.store(false);
+}
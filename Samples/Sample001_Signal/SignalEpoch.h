@@ -0,0 +1,121 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <stdint.h>
+
+//==================================================================================================
+//! @Class		Epoch based reclamation, used by concurrent emitters
+//! @details	Readers (signaling threads) never lock. They publish the global epoch they entered
+//!				with in their own thread record, and the node they are currently invoking.
+//!				Writers (connect/disconnect) are serialized by a writer mutex, replace the data
+//!				readers see, and 'Retire' the old one. Retired memory is only freed once every
+//!				reader that could still reference it has left its read section.
+//!				'Synchronize' lets a writer wait until no other thread can still be invoking
+//!				a disconnected node, so a Slot owner can safely be destroyed after it returns.
+//!				Threads blocked in 'Synchronize' themselves are not waited on (unless they are
+//!				invoking that node), so callbacks disconnecting slots on several threads do not
+//!				wait on each others.
+//==================================================================================================
+class zSignalEpoch
+{
+public:
+	static constexpr uint32_t kMaxInvokingDepth = 8;												//!< Nested invocations tracked per thread (deeper ones are always waited on)
+
+	//----------------------------------------------------------------------------------------------
+	//! @brief	Per thread reader state, on its own cache line so readers don't share writes
+	//----------------------------------------------------------------------------------------------
+	struct alignas(64) ThreadRecord
+	{
+		std::atomic<uint64_t>		mActiveEpoch{0};												//!< Epoch this thread entered its read section with (0 when not reading)
+		std::atomic<bool>			mbWaiting{false};												//!< Thread is blocked in 'Synchronize' or a 'WaitScope'
+		std::atomic<uint32_t>		mInvokingDepth{0};												//!< Number of nodes being invoked (nested signals)
+		std::atomic<const void*>	maInvoking[kMaxInvokingDepth]{};								//!< Nodes being invoked, from outer to inner most
+		std::atomic<bool>			mbInUse{true};													//!< Record owned by a live thread
+		uint32_t					mReadDepth	= 0;												//!< Nested read sections (only accessed by owner thread)
+		ThreadRecord*				mpNext		= nullptr;											//!< Next record in global list (records are never freed, only reused)
+	};
+
+	//----------------------------------------------------------------------------------------------
+	//! @brief	RAII read section, protecting everything loaded inside it from being freed
+	//----------------------------------------------------------------------------------------------
+	class ReadScope
+	{
+	public:
+		inline					ReadScope();
+		inline					~ReadScope();
+								ReadScope(const ReadScope&)=delete;
+		ReadScope&				operator=(const ReadScope&)=delete;
+		inline void				PushInvoking(const void* _pNode);									//!< This thread starts invoking this node
+		inline void				PopInvoking();														//!< This thread is done invoking last pushed node
+	protected:
+		ThreadRecord&			mRecord;
+	};
+
+	//----------------------------------------------------------------------------------------------
+	//! @brief	RAII scope telling writers which node this thread is currently invoking
+	//----------------------------------------------------------------------------------------------
+	class InvokeScope
+	{
+	public:
+		inline					InvokeScope(ReadScope& _ReadScope, const void* _pNode) : mReadScope(_ReadScope) { mReadScope.PushInvoking(_pNode); }
+		inline					~InvokeScope()																	{ mReadScope.PopInvoking(); }
+								InvokeScope(const InvokeScope&)=delete;
+		InvokeScope&			operator=(const InvokeScope&)=delete;
+	protected:
+		ReadScope&				mReadScope;
+	};
+
+	//----------------------------------------------------------------------------------------------
+	//! @brief	RAII scope telling writers this thread is blocked inside its read section (waiting
+	//!			on other threads), and will test nodes state again before invoking them
+	//----------------------------------------------------------------------------------------------
+	class WaitScope
+	{
+	public:
+		inline					WaitScope() : mRecord(zSignalEpoch::GetThreadRecord()), mbWasWaiting(mRecord.mbWaiting.exchange(true)) {}
+		inline					~WaitScope()																	{ mRecord.mbWaiting.store(mbWasWaiting); }
+								WaitScope(const WaitScope&)=delete;
+		WaitScope&				operator=(const WaitScope&)=delete;
+	protected:
+		ThreadRecord&			mRecord;
+		bool					mbWasWaiting;
+	};
+
+	typedef void			(*Deleter)(void* _pMemory);
+
+	static ThreadRecord&	GetThreadRecord();														//!< Record of current thread
+	static std::mutex&		GetWriterMutex();														//!< Mutex serializing all writers
+	static void				Retire(void* _pMemory, Deleter _pDeleter);								//!< Free memory once no reader can reference it (writer mutex must be held)
+	static void				Collect();																//!< Free retired memory that readers can't reference anymore (writer mutex must be held)
+	static void				Synchronize(const void* const* _ppNodes, size_t _NodeCount);			//!< Wait until no other thread can be invoking these disconnected nodes (writer mutex must NOT be held)
+
+protected:
+	static std::atomic<uint64_t> sGlobalEpoch;														//!< Incremented each time something is unlinked
+};
+
+zSignalEpoch::ReadScope::ReadScope()
+: mRecord(zSignalEpoch::GetThreadRecord())
+{
+	if( mRecord.mReadDepth++ == 0 )
+		mRecord.mActiveEpoch.store(sGlobalEpoch.load(std::memory_order_acquire));	// seq_cst : must be visible before we load any shared pointer
+}
+
+zSignalEpoch::ReadScope::~ReadScope()
+{
+	if( --mRecord.mReadDepth == 0 )
+		mRecord.mActiveEpoch.store(0, std::memory_order_release);
+}
+
+void zSignalEpoch::ReadScope::PushInvoking(const void* _pNode)
+{
+	const uint32_t Depth = mRecord.mInvokingDepth.load(std::memory_order_relaxed);
+	if( Depth < kMaxInvokingDepth )
+		mRecord.maInvoking[Depth].store(_pNode, std::memory_order_relaxed);
+	mRecord.mInvokingDepth.store(Depth + 1, std::memory_order_release);
+}
+
+void zSignalEpoch::ReadScope::PopInvoking()
+{
+	mRecord.mInvokingDepth.store(mRecord.mInvokingDepth.load(std::memory_order_relaxed) - 1, std::memory_order_release);
+}
@@ -0,0 +1,23 @@
+#include "SignalEventBus.h"
+#include <atomic>
+
+zEventBus::~zEventBus()
+{
+	for( Entry& EntryItem : maEntries )
+	{
+		if( EntryItem.mpEmitter )
+			EntryItem.mpDestroy(EntryItem.mpEmitter);
+	}
+}
+
+uint32_t zEventBus::AllocateTypeIndex()
+{
+	static std::atomic<uint32_t> sTypeCount{0};
+	return sTypeCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+zEventBus& zEventBus::GetDefault()
+{
+	static zEventBus sBus;
+	return sBus;
+}
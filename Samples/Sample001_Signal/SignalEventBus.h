@@ -0,0 +1,60 @@
+#pragma once
+
+#include <stdint.h>
+#include <EASTL/vector.h>
+#include "SignalEmitter.h"
+
+//==================================================================================================
+//! @Class		Central emitters, one per event type
+//! @details	Senders signal an event struct, listeners connect to the event type, without
+//!				either side declaring or knowing an emitter.
+//!				Each event type gets a unique index the first time it is used (a counter, no
+//!				RTTI or hashing), and the bus keeps its emitters in a dense array at that index.
+//!				Signaling is an array lookup followed by a regular zEmitter::Signal, with the
+//!				event passed by const reference. Emitters are created on first connection,
+//!				signaling a type nobody listens to does nothing.
+//!				No multi threading support (like zEmitter), emitters are destroyed with the bus
+//!				after disconnecting their slots.
+//! @Example	struct EventKeyPressed { int mKey; };
+//!				zEventBus::Slot<EventKeyPressed> Slot;
+//!				Slot.Connect(Bus.Get<EventKeyPressed>(), [](const EventKeyPressed& _Event){ ... });
+//!				Bus.Signal(EventKeyPressed{27});
+//==================================================================================================
+class zEventBus
+{
+public:
+	template<typename TEvent> using Emitter	= zEmitter<const TEvent&>;
+	template<typename TEvent> using Slot	= typename Emitter<TEvent>::Slot;
+
+								zEventBus()=default;
+								~zEventBus();
+								zEventBus(const zEventBus&)=delete;
+	zEventBus&					operator=(const zEventBus&)=delete;
+
+	template<typename TEvent>
+	inline Emitter<TEvent>&		Get();																//!< Emitter of an event type (created if needed), to connect slots to
+	template<typename TEvent>
+	inline void					Signal(const TEvent& _Event)const;									//!< Invoke every slot listening to this event type
+	template<typename TEvent>
+	inline bool					HasEmitter()const;
+
+	template<typename TEvent>
+	static inline uint32_t		GetTypeIndex();														//!< Unique index of an event type, shared by all buses
+	static zEventBus&			GetDefault();														//!< Application wide bus
+
+protected:
+	//! Emitter of some event type, with the function deleting it
+	struct Entry
+	{
+		void*					mpEmitter	= nullptr;
+		void					(*mpDestroy)(void*) = nullptr;
+	};
+
+	static uint32_t				AllocateTypeIndex();
+	template<typename TEvent>
+	static void					DestroyEmitter(void* _pEmitter);
+
+	eastl::vector<Entry>		maEntries;															//!< Indexed by event type index
+};
+
+#include "SignalEventBus.inl"
@@ -0,0 +1,46 @@
+
+template<typename TEvent>
+uint32_t zEventBus::GetTypeIndex()
+{
+	static const uint32_t sIndex = AllocateTypeIndex();
+	return sIndex;
+}
+
+template<typename TEvent>
+void zEventBus::DestroyEmitter(void* _pEmitter)
+{
+	Emitter<TEvent>* pEmitter = static_cast<Emitter<TEvent>*>(_pEmitter);
+	pEmitter->DisconnectAll();
+	delete pEmitter;
+}
+
+template<typename TEvent>
+zEventBus::Emitter<TEvent>& zEventBus::Get()
+{
+	const uint32_t Index = GetTypeIndex<TEvent>();
+	if( Index >= maEntries.size() )
+		maEntries.resize(Index + 1);
+
+	Entry& EntryItem = maEntries[Index];
+	if( !EntryItem.mpEmitter )
+	{
+		EntryItem.mpEmitter	= new Emitter<TEvent>;
+		EntryItem.mpDestroy	= &DestroyEmitter<TEvent>;
+	}
+	return *static_cast<Emitter<TEvent>*>(EntryItem.mpEmitter);
+}
+
+template<typename TEvent>
+void zEventBus::Signal(const TEvent& _Event)const
+{
+	const uint32_t Index = GetTypeIndex<TEvent>();
+	if( Index < maEntries.size() && maEntries[Index].mpEmitter )
+		static_cast<const Emitter<TEvent>*>(maEntries[Index].mpEmitter)->Signal(_Event);
+}
+
+template<typename TEvent>
+bool zEventBus::HasEmitter()const
+{
+	const uint32_t Index = GetTypeIndex<TEvent>();
+	return Index < maEntries.size() && maEntries[Index].mpEmitter != nullptr;
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <EASTL/hash_map.h>
+#include <EASTL/intrusive_list.h>
+#include "SignalCallback.h"
+
+//==================================================================================================
+//! @Class		Emitter whose slots listen to one key (entity id, resource name, ...)
+//! @details	Same as zEmitter, but 'Signal(Key, ...)' only invokes the slots connected to that
+//!				key, then the wildcard slots (connected to every key). Slots of other keys are
+//!				never visited : one hash lookup finds the key list, so cost depends on matching
+//!				slots, not on the total slot count.
+//!				Key lists are kept in an eastl::hash_map and removed once their last slot
+//!				disconnects (after the signal, when it happens while signaling).
+//!				Callbacks can only disconnect their own slot while signaled (like zEmitter).
+//!				No multi threading support.
+//! @Example	zKeyedEmitter<uint32_t, float> EmitterDamage;
+//!				zKeyedEmitter<uint32_t, float>::Slot Slot;
+//!				Slot.Connect(EmitterDamage, PlayerId, [](uint32_t _Id, float _Damage){ ... });
+//!				EmitterDamage.Signal(PlayerId, 10.f);		// Only slots of 'PlayerId' (and wildcards)
+//==================================================================================================
+template<typename TKey, typename... TParameters>
+class zKeyedEmitter
+{
+public:
+	typedef zCallback<void(const TKey&, TParameters...)> Callback;								//!< Slots receive the signaled key first
+
+	//----------------------------------------------------------------------------------------------
+	//! @Class	Class connecting a Listener to one key (or all keys) of an Emitter
+	//----------------------------------------------------------------------------------------------
+	class Slot : public eastl::intrusive_list_node
+	{
+	public:
+								Slot()						{ mpNext = mpPrev = nullptr; }
+								~Slot()						{ Disconnect(); }
+								Slot(const Slot&)=delete;
+		Slot&					operator=(const Slot&)=delete;
+
+		void					Connect(zKeyedEmitter& _Emitter, const TKey& _Key, const Callback& _Callback);	//!< Invoked by signals of this key
+		void					ConnectAll(zKeyedEmitter& _Emitter, const Callback& _Callback);				//!< Invoked by signals of any key (wildcard)
+		template<auto TFunction>
+		inline void				Connect(zKeyedEmitter& _Emitter, const TKey& _Key)							{ Connect(_Emitter, _Key, Callback::template Bind<TFunction>()); }
+		template<auto TMethod, typename TObject>
+		inline void				Connect(zKeyedEmitter& _Emitter, const TKey& _Key, TObject* _pObject)		{ Connect(_Emitter, _Key, Callback::template Bind<TMethod>(_pObject)); }
+		void					Disconnect();
+		inline bool				IsConnected()const			{ return mpEmitter != nullptr; }
+		inline bool				IsWildcard()const			{ return IsConnected() && mpBucket == nullptr; }
+
+	protected:
+		Callback				mCallback;
+		TKey					mKey		= TKey();
+		zKeyedEmitter*			mpEmitter	= nullptr;
+		eastl::intrusive_list<Slot>* mpBucket = nullptr;											//!< List of the key this slot listens to (nullptr for wildcards)
+		friend class zKeyedEmitter;
+	};
+
+	//----------------------------------------------------------------------------------------------
+	// Main content of the class
+	//----------------------------------------------------------------------------------------------
+public:
+								zKeyedEmitter()=default;
+								~zKeyedEmitter()			{ DisconnectAll(); }
+								zKeyedEmitter(const zKeyedEmitter&)=delete;
+	zKeyedEmitter&				operator=(const zKeyedEmitter&)=delete;
+
+	void						Signal(const TKey& _Key, TParameters... _Values)const;				//!< Invoke slots of this key, then wildcard slots
+	void						DisconnectAll();
+	inline size_t				GetKeyCount()const			{ return mhmBuckets.size(); }			//!< Keys with at least one slot
+
+protected:
+	typedef eastl::intrusive_list<Slot>			SlotList;
+	typedef eastl::hash_map<TKey, SlotList>		BucketMap;
+
+	void						RemoveEmptyBuckets();
+	static inline void			SignalList(const SlotList& _lstSlots, const TKey& _Key, TParameters... _Values);
+
+	BucketMap					mhmBuckets;															//!< Slots per key (node based, lists never move)
+	SlotList					mlstWildcards;
+	mutable uint32_t			mSignalDepth		= 0;											//!< Key lists can't be removed while being iterated
+	bool						mbHasEmptyBuckets	= false;
+};
+
+#include "SignalKeyedEmitter.inl"
@@ -0,0 +1,98 @@
+
+template<typename TKey, typename... TParameters>
+void zKeyedEmitter<TKey, TParameters...>::Slot::Connect(zKeyedEmitter& _Emitter, const TKey& _Key, const Callback& _Callback)
+{
+	Disconnect();
+	mCallback	= _Callback;
+	mKey		= _Key;
+	mpEmitter	= &_Emitter;
+	mpBucket	= &_Emitter.mhmBuckets[_Key];
+	mpBucket->push_back(*this);
+}
+
+template<typename TKey, typename... TParameters>
+void zKeyedEmitter<TKey, TParameters...>::Slot::ConnectAll(zKeyedEmitter& _Emitter, const Callback& _Callback)
+{
+	Disconnect();
+	mCallback	= _Callback;
+	mpEmitter	= &_Emitter;
+	mpBucket	= nullptr;
+	_Emitter.mlstWildcards.push_back(*this);
+}
+
+template<typename TKey, typename... TParameters>
+void zKeyedEmitter<TKey, TParameters...>::Slot::Disconnect()
+{
+	if( mpEmitter == nullptr )
+		return;
+
+	SlotList::remove(*this);
+	mpNext = mpPrev = nullptr;
+	if( mpBucket && mpBucket->empty() )
+	{
+		if( mpEmitter->mSignalDepth == 0 )
+			mpEmitter->mhmBuckets.erase(mKey);
+		else
+			mpEmitter->mbHasEmptyBuckets = true;
+	}
+	mpEmitter	= nullptr;
+	mpBucket	= nullptr;
+}
+
+template<typename TKey, typename... TParameters>
+void zKeyedEmitter<TKey, TParameters...>::SignalList(const SlotList& _lstSlots, const TKey& _Key, TParameters... _Values)
+{
+	auto it = _lstSlots.begin();
+	while( it != _lstSlots.end() )
+	{
+		const Slot& slot = *it++; //Increment before invoking callback, so if callback removes slot, won't affect iteration
+		slot.mCallback(_Key, _Values...);
+	}
+}
+
+template<typename TKey, typename... TParameters>
+void zKeyedEmitter<TKey, TParameters...>::Signal(const TKey& _Key, TParameters... _Values)const
+{
+	++mSignalDepth;
+	auto itBucket = mhmBuckets.find(_Key);
+	if( itBucket != mhmBuckets.end() )
+		SignalList(itBucket->second, _Key, _Values...);
+	SignalList(mlstWildcards, _Key, _Values...);
+
+	if( --mSignalDepth == 0 && mbHasEmptyBuckets )
+		const_cast<zKeyedEmitter*>(this)->RemoveEmptyBuckets();
+}
+
+template<typename TKey, typename... TParameters>
+void zKeyedEmitter<TKey, TParameters...>::RemoveEmptyBuckets()
+{
+	mbHasEmptyBuckets = false;
+	auto it = mhmBuckets.begin();
+	while( it != mhmBuckets.end() )
+	{
+		if( it->second.empty() )
+			mhmBuckets.erase(it++);	//Other nodes iterators stay valid
+		else
+			++it;
+	}
+}
+
+template<typename TKey, typename... TParameters>
+void zKeyedEmitter<TKey, TParameters...>::DisconnectAll()
+{
+	++mSignalDepth;	// Buckets are all released at the end, instead of one by one
+	for( auto& Bucket : mhmBuckets )
+	{
+		while( !Bucket.second.empty() )
+			Bucket.second.front().Disconnect();
+	}
+	while( !mlstWildcards.empty() )
+		mlstWildcards.front().Disconnect();
+	if( --mSignalDepth == 0 )
+	{
+		mhmBuckets.clear();
+		mbHasEmptyBuckets = false;
+	}
+	else
+		mbHasEmptyBuckets = true;
+}
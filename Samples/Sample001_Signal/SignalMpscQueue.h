@@ -0,0 +1,98 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <stdint.h>
+#include <utility>
+
+//==================================================================================================
+//! @Class		Bounded lock free queue, with multiple producers and a single consumer
+//! @details	Array of cells tagged with a sequence number (Dmitry Vyukov bounded queue).
+//!				Producers reserve a cell with a CAS on the enqueue position, then publish it by
+//!				updating its sequence. Consumer only reads cells that have been published.
+//!				Capacity is rounded up to a power of 2. Items must be default constructible.
+//==================================================================================================
+template<typename TItem>
+class zMpscQueue
+{
+public:
+	explicit					zMpscQueue(size_t _Capacity);
+								zMpscQueue(const zMpscQueue&)=delete;
+	zMpscQueue&					operator=(const zMpscQueue&)=delete;
+
+	inline bool					TryPush(TItem&& _Item);												//!< Add item, fails when queue is full (any thread)
+	inline bool					TryPop(TItem& _Item);												//!< Remove oldest item, fails when queue is empty (consumer thread only)
+	inline size_t				GetSize()const;														//!< Approximate number of items in queue
+	inline size_t				GetCapacity()const		{ return mMask + 1; }
+	inline uint64_t				GetPushCount()const		{ return mEnqueuePos.load(std::memory_order_relaxed); }	//!< Total items ever pushed
+
+protected:
+	struct Cell
+	{
+		std::atomic<size_t>		mSequence;
+		TItem					mItem;
+	};
+
+	std::unique_ptr<Cell[]>		maCells;
+	size_t						mMask;
+	alignas(64) std::atomic<size_t>	mEnqueuePos{0};													//!< Shared by producers
+	alignas(64) std::atomic<size_t>	mDequeuePos{0};													//!< Only written by consumer
+};
+
+template<typename TItem>
+zMpscQueue<TItem>::zMpscQueue(size_t _Capacity)
+{
+	size_t Capacity = 2;
+	while( Capacity < _Capacity )
+		Capacity *= 2;
+	maCells.reset(new Cell[Capacity]);
+	mMask = Capacity - 1;
+	for( size_t i(0); i<Capacity; ++i )
+		maCells[i].mSequence.store(i, std::memory_order_relaxed);
+}
+
+template<typename TItem>
+bool zMpscQueue<TItem>::TryPush(TItem&& _Item)
+{
+	size_t Pos = mEnqueuePos.load(std::memory_order_relaxed);
+	for(;;)
+	{
+		Cell& CellItem		= maCells[Pos & mMask];
+		const size_t Seq	= CellItem.mSequence.load(std::memory_order_acquire);
+		const intptr_t Diff	= static_cast<intptr_t>(Seq) - static_cast<intptr_t>(Pos);
+		if( Diff == 0 )
+		{
+			if( mEnqueuePos.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed) )
+			{
+				CellItem.mItem = std::move(_Item);
+				CellItem.mSequence.store(Pos + 1, std::memory_order_release);
+				return true;
+			}
+		}
+		else if( Diff < 0 )
+			return false;	// Cell still used by an item not consumed yet : queue is full
+		else
+			Pos = mEnqueuePos.load(std::memory_order_relaxed);
+	}
+}
+
+template<typename TItem>
+bool zMpscQueue<TItem>::TryPop(TItem& _Item)
+{
+	const size_t Pos	= mDequeuePos.load(std::memory_order_relaxed);
+	Cell& CellItem		= maCells[Pos & mMask];
+	if( CellItem.mSequence.load(std::memory_order_acquire) != Pos + 1 )
+		return false;	// Not published yet
+	_Item = std::move(CellItem.mItem);
+	CellItem.mSequence.store(Pos + mMask + 1, std::memory_order_release);
+	mDequeuePos.store(Pos + 1, std::memory_order_relaxed);
+	return true;
+}
+
+template<typename TItem>
+size_t zMpscQueue<TItem>::GetSize()const
+{
+	const size_t DequeuePos = mDequeuePos.load(std::memory_order_relaxed);
+	const size_t EnqueuePos = mEnqueuePos.load(std::memory_order_relaxed);
+	return EnqueuePos > DequeuePos ? EnqueuePos - DequeuePos : 0;
+}
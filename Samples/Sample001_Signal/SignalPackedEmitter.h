@@ -0,0 +1,94 @@
+#pragma once
+
+#include <stdint.h>
+#include <EASTL/vector.h>
+#include "SignalCallback.h"
+
+#if defined(_MSC_VER)
+	#include <xmmintrin.h>
+	#define zenPrefetch(_pAddress)	_mm_prefetch(static_cast<const char*>(_pAddress), _MM_HINT_T0)
+#elif defined(__GNUC__) || defined(__clang__)
+	#define zenPrefetch(_pAddress)	__builtin_prefetch(_pAddress)
+#else
+	#define zenPrefetch(_pAddress)
+#endif
+
+//==================================================================================================
+//! @Class Signal/Slots system, with listeners packed contiguously in the emitter
+//! @details	Same usage as zEmitter, but instead of walking a linked list of Slots (located
+//!				wherever their owner objects are), the emitter keeps a dense array of
+//!				'invoker stub + callback storage' (SoA). Signal is a linear scan, with the
+//!				callback storage of upcoming listeners prefetched.
+//!				Slots are stable handles remembering their index in the arrays.
+//!				Disconnect is O(1), by moving the last entry in the freed spot (swap-remove).
+//!				Slots disconnected while signaling are only neutralized, and removed once
+//!				the signal is done, so a callback can safely disconnect any slot.
+//!				No multi threading support.
+//! @Example	Look at 'SamplePerformance.cpp' for usage
+//==================================================================================================
+template<typename... TParameters>
+class zPackedEmitter
+{
+public:
+	//----------------------------------------------------------------------------------------------
+	//! @Class	Class connecting a Listener to a packed event Emitter
+	//! @detail Keep the callback, and the position of its entry in the emitter arrays.
+	//!			Automatically removed from emitter when destroyed.
+	//----------------------------------------------------------------------------------------------
+	class Slot
+	{
+	public:
+		typedef zCallback<void(TParameters...)>		Callback;										//!< Callback function signature (no heap allocation)
+		typedef zPackedEmitter<TParameters...>		Emitter;										//!< Useful to get emitter type that works with this slot type
+
+	public:
+								Slot();
+								Slot(const Slot&)=delete;											//!< Emitter references slot by address, cannot be copied
+								~Slot();															//!< Remove this slot from emitter arrays, when slot is destroyed
+		Slot&					operator=(const Slot&)=delete;
+		inline void				Connect(zPackedEmitter& _Emitter, const Callback& _Callback);		//!< Bind signal to a function to invoke when received
+		template<auto TFunction>
+		inline void				Connect(zPackedEmitter& _Emitter);									//!< Bind signal to a function known at compile time (direct call)
+		template<auto TMethod, typename TObject>
+		inline void				Connect(zPackedEmitter& _Emitter, TObject* _pObject);				//!< Bind signal to an object method known at compile time (direct call)
+		inline void				Disconnect();														//!< Remove this Slot from Emitter Listeners
+		inline bool				IsConnected()const;
+		inline const Callback&	GetCallback()const;
+	protected:
+		friend class zPackedEmitter;
+		Callback				mCallback;															//!< Functions emitter should call when signaling
+		zPackedEmitter*			mpEmitter	= nullptr;												//!< Emitter this slot is connected to
+		uint32_t				mIndex		= 0;													//!< Position of this slot entry in emitter arrays
+	};
+
+	//----------------------------------------------------------------------------------------------
+	// Main content of the class
+	//----------------------------------------------------------------------------------------------
+public:
+								zPackedEmitter()=default;
+								zPackedEmitter(const zPackedEmitter&)=delete;						//!< Slots reference emitter by address, cannot be copied
+								~zPackedEmitter();
+	zPackedEmitter&				operator=(const zPackedEmitter&)=delete;
+	inline void					Signal(TParameters..._Values)const;									//!< Signal all slots connected to this emitter
+	inline void					DisconnectAll();													//!< Remove all slots connected to this emitter
+	inline void					Reserve(uint32_t _SlotCount);										//!< Preallocate arrays, to avoid allocation on 'Connect'
+	inline uint32_t				GetSlotCount()const;
+
+protected:
+	typedef typename Slot::Callback::Invoker Invoker;
+	static constexpr uint32_t	kPrefetchDistance = 4;												//!< How many entries ahead to prefetch callback storage
+
+	inline void					Add(Slot& _Slot);
+	inline void					Remove(Slot& _Slot);
+	inline void					RemovePending()const;
+	inline void					SwapRemove(uint32_t _Index)const;									//!< Move last entry in this spot, and shrink arrays
+	static void					DisconnectedStub(const void* _pStorage, TParameters..._Values);		//!< Invoker of slots disconnected during a signal
+
+	mutable eastl::vector<Invoker>		maInvokers;													//!< Callback stub of each listener (hot)
+	mutable eastl::vector<const void*>	maStorages;													//!< Callback storage of each listener (hot)
+	mutable eastl::vector<Slot*>		maSlots;													//!< Slot owning each entry, to update its index on swap-remove (cold)
+	mutable uint32_t					mSignalDepth	= 0;										//!< Number of 'Signal' currently in progress (nested signals)
+	mutable bool						mbPendingRemove	= false;									//!< Some slots were disconnected while signaling
+};
+
+#include "SignalPackedEmitter.inl"
@@ -0,0 +1,167 @@
+
+template<typename... TParameters>
+zPackedEmitter<TParameters...>::Slot::Slot()
+{
+}
+
+template<typename... TParameters>
+zPackedEmitter<TParameters...>::Slot::~Slot()
+{
+	Disconnect();
+}
+
+template<typename... TParameters>
+void zPackedEmitter<TParameters...>::Slot::Disconnect()
+{
+	if( mpEmitter != nullptr )
+		mpEmitter->Remove(*this);
+}
+
+template<typename... TParameters>
+void zPackedEmitter<TParameters...>::Slot::Connect(zPackedEmitter& _Emitter, const Callback& _Callback)
+{
+	Disconnect();
+	mCallback = _Callback;
+	_Emitter.Add(*this);
+}
+
+template<typename... TParameters>
+template<auto TFunction>
+void zPackedEmitter<TParameters...>::Slot::Connect(zPackedEmitter& _Emitter)
+{
+	Connect(_Emitter, Callback::template Bind<TFunction>());
+}
+
+template<typename... TParameters>
+template<auto TMethod, typename TObject>
+void zPackedEmitter<TParameters...>::Slot::Connect(zPackedEmitter& _Emitter, TObject* _pObject)
+{
+	Connect(_Emitter, Callback::template Bind<TMethod>(_pObject));
+}
+
+template<typename... TParameters>
+bool zPackedEmitter<TParameters...>::Slot::IsConnected()const
+{
+	return mpEmitter != nullptr;
+}
+
+template<typename... TParameters>
+const typename zPackedEmitter<TParameters...>::Slot::Callback& zPackedEmitter<TParameters...>::Slot::GetCallback()const
+{
+	return mCallback;
+}
+
+template<typename... TParameters>
+zPackedEmitter<TParameters...>::~zPackedEmitter()
+{
+	DisconnectAll();
+}
+
+template<typename... TParameters>
+void zPackedEmitter<TParameters...>::Signal(TParameters..._Values)const
+{
+	// Only signal slots present when starting, the ones connected by a callback will wait next signal.
+	// Arrays are accessed by index at each iteration, since a callback connecting a slot can resize them.
+	const uint32_t Count = static_cast<uint32_t>(maInvokers.size());
+	++mSignalDepth;
+	for( uint32_t i(0); i<Count; ++i )
+	{
+		if( i + kPrefetchDistance < Count )
+			zenPrefetch(maStorages[i + kPrefetchDistance]);
+		maInvokers[i](maStorages[i], _Values...);
+	}
+	if( --mSignalDepth == 0 && mbPendingRemove )
+		RemovePending();
+}
+
+template<typename... TParameters>
+void zPackedEmitter<TParameters...>::DisconnectAll()
+{
+	for( uint32_t i(0), Count(static_cast<uint32_t>(maSlots.size())); i<Count; ++i )
+	{
+		if( maSlots[i] )
+		{
+			maSlots[i]->mpEmitter	= nullptr;
+			maSlots[i]				= nullptr;
+			maInvokers[i]			= &DisconnectedStub;
+		}
+	}
+	mbPendingRemove = true;
+	if( mSignalDepth == 0 )
+		RemovePending();
+}
+
+template<typename... TParameters>
+void zPackedEmitter<TParameters...>::Reserve(uint32_t _SlotCount)
+{
+	maInvokers.reserve(_SlotCount);
+	maStorages.reserve(_SlotCount);
+	maSlots.reserve(_SlotCount);
+}
+
+template<typename... TParameters>
+uint32_t zPackedEmitter<TParameters...>::GetSlotCount()const
+{
+	return static_cast<uint32_t>(maSlots.size());
+}
+
+template<typename... TParameters>
+void zPackedEmitter<TParameters...>::Add(Slot& _Slot)
+{
+	_Slot.mpEmitter	= this;
+	_Slot.mIndex	= static_cast<uint32_t>(maSlots.size());
+	maInvokers.push_back(_Slot.mCallback.GetInvoker());
+	maStorages.push_back(_Slot.mCallback.GetStorage());
+	maSlots.push_back(&_Slot);
+}
+
+template<typename... TParameters>
+void zPackedEmitter<TParameters...>::Remove(Slot& _Slot)
+{
+	const uint32_t Index	= _Slot.mIndex;
+	_Slot.mpEmitter			= nullptr;
+
+	// Signal in progress is iterating the arrays, neutralize entry and remove it once done
+	if( mSignalDepth > 0 )
+	{
+		maInvokers[Index]	= &DisconnectedStub;
+		maSlots[Index]		= nullptr;
+		mbPendingRemove		= true;
+		return;
+	}
+
+	SwapRemove(Index);
+}
+
+template<typename... TParameters>
+void zPackedEmitter<TParameters...>::RemovePending()const
+{
+	// Walking backward, so entries moved in a freed spot have already been tested
+	for( uint32_t Index = static_cast<uint32_t>(maSlots.size()); Index-- > 0; )
+	{
+		if( maSlots[Index] == nullptr )
+			SwapRemove(Index);
+	}
+	mbPendingRemove = false;
+}
+
+template<typename... TParameters>
+void zPackedEmitter<TParameters...>::SwapRemove(uint32_t _Index)const
+{
+	const uint32_t LastIndex = static_cast<uint32_t>(maSlots.size()) - 1;
+	if( _Index != LastIndex )
+	{
+		maInvokers[_Index]		= maInvokers[LastIndex];
+		maStorages[_Index]		= maStorages[LastIndex];
+		maSlots[_Index]			= maSlots[LastIndex];
+		maSlots[_Index]->mIndex	= _Index;
+	}
+	maInvokers.pop_back();
+	maStorages.pop_back();
+	maSlots.pop_back();
+}
+
+template<typename... TParameters>
+void zPackedEmitter<TParameters...>::DisconnectedStub(const void*, TParameters...)
+{
+}
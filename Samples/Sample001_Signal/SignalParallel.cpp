@@ -0,0 +1,155 @@
+#include "SignalParallel.h"
+#include "SignalEpoch.h"
+
+namespace
+{
+	inline uint64_t MakeRange(uint32_t _Begin, uint32_t _End)
+	{
+		return (uint64_t(_End) << 32) | _Begin;
+	}
+}
+
+zSignalParallelPool::zSignalParallelPool(uint32_t _WorkerCount)
+: mWorkerCount(_WorkerCount)
+{
+	if( mWorkerCount == 0 )
+	{
+		const uint32_t HardwareCount = std::thread::hardware_concurrency();
+		mWorkerCount = HardwareCount > 1 ? HardwareCount - 1 : 0;
+	}
+	maShares.reset(new Share[mWorkerCount + 1]);
+	maThreads.reserve(mWorkerCount);
+	for( uint32_t idx(0); idx<mWorkerCount; ++idx )
+		maThreads.emplace_back(&zSignalParallelPool::Run, this, idx + 1);
+}
+
+zSignalParallelPool::~zSignalParallelPool()
+{
+	{
+		std::lock_guard<std::mutex> Lock(mMutex);
+		mbStop = true;
+	}
+	mWakeCondition.notify_all();
+	for( auto& Thread : maThreads )
+		Thread.join();
+}
+
+bool zSignalParallelPool::IsWorkerThread()const
+{
+	const std::thread::id ThreadId = std::this_thread::get_id();
+	for( const auto& Thread : maThreads )
+		if( Thread.get_id() == ThreadId )
+			return true;
+	return false;
+}
+
+zSignalParallelPool& zSignalParallelPool::GetDefault()
+{
+	static zSignalParallelPool sPool;
+	return sPool;
+}
+
+void zSignalParallelPool::Dispatch(Job& _Job, uint32_t _ChunkCount)
+{
+	// Even split of chunks, workers joining late will steal from others
+	const uint32_t ParticipantCount = mWorkerCount + 1;
+	for( uint32_t idx(0); idx<ParticipantCount; ++idx )
+	{
+		const uint32_t Begin	= static_cast<uint32_t>(uint64_t(_ChunkCount) * idx / ParticipantCount);
+		const uint32_t End		= static_cast<uint32_t>(uint64_t(_ChunkCount) * (idx + 1) / ParticipantCount);
+		maShares[idx].mRange.store(MakeRange(Begin, End), std::memory_order_relaxed);
+	}
+	{
+		std::lock_guard<std::mutex> Lock(mMutex);
+		mpJob = &_Job;
+		++mJobSerial;
+	}
+	mWakeCondition.notify_all();
+
+	Execute(_Job, 0);
+
+	// Writers disconnecting a slot invoked by a worker must not wait on this thread read section
+	zSignalEpoch::WaitScope WaitScope;
+	while( _Job.mRemaining.load(std::memory_order_acquire) != 0 )
+		std::this_thread::yield();
+
+	std::unique_lock<std::mutex> Lock(mMutex);
+	mpJob = nullptr;
+	mDoneCondition.wait(Lock, [this]{ return mActiveWorkers == 0; });
+}
+
+void zSignalParallelPool::Execute(Job& _Job, uint32_t _Participant)
+{
+	uint32_t Chunk;
+	while( ClaimChunk(_Participant, Chunk) )
+	{
+		const size_t Begin	= size_t(Chunk) * _Job.mChunkSize;
+		const size_t End	= Begin + _Job.mChunkSize < _Job.mCount ? Begin + _Job.mChunkSize : _Job.mCount;
+		_Job.mpFunc(_Job.mpContext, Begin, End);
+		_Job.mRemaining.fetch_sub(1, std::memory_order_acq_rel);
+	}
+}
+
+bool zSignalParallelPool::ClaimChunk(uint32_t _Participant, uint32_t& _ChunkOut)
+{
+	// Own share first, from its front
+	std::atomic<uint64_t>& OwnRange = maShares[_Participant].mRange;
+	uint64_t Range = OwnRange.load(std::memory_order_relaxed);
+	for(;;)
+	{
+		const uint32_t Begin = static_cast<uint32_t>(Range), End = static_cast<uint32_t>(Range >> 32);
+		if( Begin >= End )
+			break;
+		if( OwnRange.compare_exchange_weak(Range, MakeRange(Begin + 1, End), std::memory_order_acq_rel, std::memory_order_relaxed) )
+		{
+			_ChunkOut = Begin;
+			return true;
+		}
+	}
+
+	// Then steal from the back of other shares
+	const uint32_t ParticipantCount = mWorkerCount + 1;
+	for( uint32_t Offset(1); Offset<ParticipantCount; ++Offset )
+	{
+		std::atomic<uint64_t>& VictimRange = maShares[(_Participant + Offset) % ParticipantCount].mRange;
+		Range = VictimRange.load(std::memory_order_relaxed);
+		for(;;)
+		{
+			const uint32_t Begin = static_cast<uint32_t>(Range), End = static_cast<uint32_t>(Range >> 32);
+			if( Begin >= End )
+				break;
+			if( VictimRange.compare_exchange_weak(Range, MakeRange(Begin, End - 1), std::memory_order_acq_rel, std::memory_order_relaxed) )
+			{
+				_ChunkOut = End - 1;
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+void zSignalParallelPool::Run(uint32_t _Participant)
+{
+	uint64_t LastSerial = 0;
+	for(;;)
+	{
+		Job* pJob = nullptr;
+		{
+			std::unique_lock<std::mutex> Lock(mMutex);
+			mWakeCondition.wait(Lock, [&]{ return mbStop || (mpJob && mJobSerial != LastSerial); });
+			if( mbStop )
+				return;
+			LastSerial	= mJobSerial;
+			pJob		= mpJob;
+			++mActiveWorkers;
+		}
+
+		Execute(*pJob, _Participant);
+
+		{
+			std::lock_guard<std::mutex> Lock(mMutex);
+			if( --mActiveWorkers == 0 )
+				mDoneCondition.notify_all();
+		}
+	}
+}
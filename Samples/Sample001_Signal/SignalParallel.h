@@ -0,0 +1,74 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <stdint.h>
+#include <thread>
+#include <vector>
+
+//==================================================================================================
+//! @Class		Work stealing thread pool, splitting a range of items in chunks
+//! @details	Used by 'zConcurrentEmitter::SignalParallel' to invoke independent slots on
+//!				several threads. Calling thread takes part in the work, and only returns once
+//!				every chunk has been processed.
+//!				Each participant (caller + workers) starts with a contiguous share of the chunks,
+//!				taken from its front. Once done, it steals chunks from the back of other shares,
+//!				so uneven callback costs still keep every thread busy.
+//!				Pool runs one job at a time : a 'ParallelFor' issued while it is busy (other
+//!				thread, or nested from a callback) runs serially on its calling thread instead.
+//==================================================================================================
+class zSignalParallelPool
+{
+public:
+	explicit					zSignalParallelPool(uint32_t _WorkerCount=0);						//!< 0 : one per hardware thread, minus the calling one
+								~zSignalParallelPool();
+								zSignalParallelPool(const zSignalParallelPool&)=delete;
+	zSignalParallelPool&		operator=(const zSignalParallelPool&)=delete;
+
+	template<typename TFunc>
+	void						ParallelFor(size_t _Count, size_t _ChunkSize, const TFunc& _Func);	//!< Invoke '_Func(Begin, End)' on chunks of [0, _Count[
+	inline uint32_t				GetWorkerCount()const		{ return mWorkerCount; }
+	bool						IsWorkerThread()const;
+	static zSignalParallelPool&	GetDefault();
+
+protected:
+	typedef void (*JobFunc)(const void* _pContext, size_t _Begin, size_t _End);
+
+	//! Chunks not processed yet of a participant (begin in low 32bits, end in high 32bits)
+	struct alignas(64) Share
+	{
+		std::atomic<uint64_t>	mRange{0};
+	};
+
+	struct Job
+	{
+		JobFunc					mpFunc;
+		const void*				mpContext;
+		size_t					mCount;
+		size_t					mChunkSize;
+		std::atomic<uint32_t>	mRemaining;															//!< Chunks not fully processed yet
+	};
+
+	template<typename TFunc>
+	static void					InvokeStub(const void* _pContext, size_t _Begin, size_t _End);
+	void						Dispatch(Job& _Job, uint32_t _ChunkCount);						//!< Run job on all participants, and wait for its completion (dispatch mutex must be held)
+	void						Execute(Job& _Job, uint32_t _Participant);
+	bool						ClaimChunk(uint32_t _Participant, uint32_t& _ChunkOut);
+	void						Run(uint32_t _Participant);
+
+	uint32_t					mWorkerCount;
+	std::unique_ptr<Share[]>	maShares;															//!< One per participant, caller is index 0
+	std::mutex					mDispatchMutex;														//!< Held while a job is running
+	std::mutex					mMutex;																//!< Guards job publication and worker count
+	std::condition_variable		mWakeCondition;
+	std::condition_variable		mDoneCondition;
+	Job*						mpJob			= nullptr;											//!< Current job (guarded by mMutex)
+	uint64_t					mJobSerial		= 0;												//!< Incremented for each job, so workers only join it once (guarded by mMutex)
+	uint32_t					mActiveWorkers	= 0;												//!< Workers inside current job (guarded by mMutex)
+	bool						mbStop			= false;											//!< Guarded by mMutex
+	std::vector<std::thread>	maThreads;
+};
+
+#include "SignalParallel.inl"
@@ -0,0 +1,28 @@
+
+template<typename TFunc>
+void zSignalParallelPool::InvokeStub(const void* _pContext, size_t _Begin, size_t _End)
+{
+	(*static_cast<const TFunc*>(_pContext))(_Begin, _End);
+}
+
+template<typename TFunc>
+void zSignalParallelPool::ParallelFor(size_t _Count, size_t _ChunkSize, const TFunc& _Func)
+{
+	const size_t ChunkSize	= _ChunkSize > 0 ? _ChunkSize : 1;
+	const size_t ChunkCount	= (_Count + ChunkSize - 1) / ChunkSize;
+	if( ChunkCount < 2 || ChunkCount > UINT32_MAX || mWorkerCount == 0 || IsWorkerThread() || !mDispatchMutex.try_lock() )
+	{
+		if( _Count > 0 )
+			_Func(size_t(0), _Count);
+		return;
+	}
+
+	std::lock_guard<std::mutex> Lock(mDispatchMutex, std::adopt_lock);
+	Job JobItem;
+	JobItem.mpFunc		= &InvokeStub<TFunc>;
+	JobItem.mpContext	= &_Func;
+	JobItem.mCount		= _Count;
+	JobItem.mChunkSize	= ChunkSize;
+	JobItem.mRemaining.store(static_cast<uint32_t>(ChunkCount), std::memory_order_relaxed);
+	Dispatch(JobItem, static_cast<uint32_t>(ChunkCount));
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "SignalEmitter.h"
+
+#ifndef ZEN_SIGNAL_PRIORITY_COUNT
+	#define ZEN_SIGNAL_PRIORITY_COUNT 8															//!< Number of priority buckets of zPriorityEmitter
+#endif
+
+//==================================================================================================
+//! @Class		Emitter invoking its slots by priority, then connection order
+//! @details	Ordering is done when connecting : a slot is inserted after the last slot of its
+//!				priority bucket (tail pointer kept per bucket), which is O(1) per bucket.
+//!				'Signal' is the regular zEmitter linear walk, no sorting or test per call.
+//!				Lower priority values are invoked first.
+//!				Only priority slots can connect to it, zEmitter is a protected base.
+//! @Example	zPriorityEmitter<int> Emitter;
+//!				SlotUI.Connect(Emitter, OnUI, 6);
+//!				SlotInput.Connect(Emitter, OnInput, 0);	// Invoked before SlotUI
+//==================================================================================================
+template<typename... TParameters>
+class zPriorityEmitter : protected zEmitter<TParameters...>
+{
+protected:
+	typedef zEmitter<TParameters...>	Base;
+	typedef typename Base::Slot			BaseSlot;
+public:
+	static constexpr uint32_t kPriorityCount	= ZEN_SIGNAL_PRIORITY_COUNT;
+	static constexpr uint32_t kPriorityFirst	= 0;
+	static constexpr uint32_t kPriorityDefault	= kPriorityCount / 2;
+	static constexpr uint32_t kPriorityLast		= kPriorityCount - 1;
+
+	//----------------------------------------------------------------------------------------------
+	//! @Class	Slot remembering its priority, keeping emitter bucket tails valid when removed
+	//----------------------------------------------------------------------------------------------
+	class Slot : protected BaseSlot
+	{
+	public:
+		typedef typename BaseSlot::Callback Callback;
+		typedef zPriorityEmitter<TParameters...> Emitter;
+
+								~Slot()						{ Disconnect(); }
+		void					Connect(zPriorityEmitter& _Emitter, const Callback& _Callback, uint32_t _Priority=kPriorityDefault);
+		template<auto TFunction>
+		inline void				Connect(zPriorityEmitter& _Emitter, uint32_t _Priority=kPriorityDefault)						{ Connect(_Emitter, Callback::template Bind<TFunction>(), _Priority); }
+		template<auto TMethod, typename TObject>
+		inline void				Connect(zPriorityEmitter& _Emitter, TObject* _pObject, uint32_t _Priority=kPriorityDefault)	{ Connect(_Emitter, Callback::template Bind<TMethod>(_pObject), _Priority); }
+		void					Disconnect();
+		inline uint32_t			GetPriority()const			{ return mPriority; }
+		using BaseSlot::IsConnected;
+		using BaseSlot::GetCallback;
+
+	protected:
+		zPriorityEmitter*		mpEmitter	= nullptr;
+		uint32_t				mPriority	= 0;
+		friend class zPriorityEmitter;
+	};
+
+								zPriorityEmitter()=default;
+								~zPriorityEmitter()			{ DisconnectAll(); }
+	using Base::Signal;
+	void						DisconnectAll();
+
+protected:
+	Slot*						maTails[kPriorityCount] = {};										//!< Last slot of each priority bucket (nullptr when empty)
+	friend class Slot;
+};
+
+#include "SignalPriorityEmitter.inl"
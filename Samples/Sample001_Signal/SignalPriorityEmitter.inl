@@ -0,0 +1,38 @@
+
+template<typename... TParameters>
+void zPriorityEmitter<TParameters...>::Slot::Connect(zPriorityEmitter& _Emitter, const Callback& _Callback, uint32_t _Priority)
+{
+	Disconnect();
+	this->mCallback	= _Callback;
+	mpEmitter		= &_Emitter;
+	mPriority		= _Priority < kPriorityCount ? _Priority : kPriorityLast;
+
+	// Insert after last slot of the same priority, or of the closest earlier one
+	BaseSlot* pInsertAfter = nullptr;
+	for( uint32_t Priority(mPriority+1); Priority-- > 0 && !pInsertAfter; )
+		pInsertAfter = _Emitter.maTails[Priority];
+	_Emitter.mlstSlots.insert(pInsertAfter ? ++typename Base::SlotList::iterator(pInsertAfter) : _Emitter.mlstSlots.begin(), *this);
+	_Emitter.maTails[mPriority] = this;
+}
+
+template<typename... TParameters>
+void zPriorityEmitter<TParameters...>::Slot::Disconnect()
+{
+	if( mpEmitter )
+	{
+		if( mpEmitter->maTails[mPriority] == this )
+		{
+			Slot* pPrev = &mpEmitter->mlstSlots.front() != this ? static_cast<Slot*>(static_cast<BaseSlot*>(this->mpPrev)) : nullptr;
+			mpEmitter->maTails[mPriority] = pPrev && pPrev->mPriority == mPriority ? pPrev : nullptr;
+		}
+		BaseSlot::Disconnect();
+		mpEmitter = nullptr;
+	}
+}
+
+template<typename... TParameters>
+void zPriorityEmitter<TParameters...>::DisconnectAll()
+{
+	while( !Base::mlstSlots.empty() )
+		static_cast<Slot&>(Base::mlstSlots.front()).Disconnect();
+}
@@ -0,0 +1,297 @@
+#include "SignalProfiler.h"
+
+#if ZEN_SIGNAL_PROFILE
+
+#include <algorithm>
+#include <mutex>
+#include <EASTL/hash_map.h>
+#include <EASTL/vector.h>
+
+namespace
+{
+	typedef zSignalProfiler::Stat Stat;
+
+	//! Table entry, only written by owner thread (relaxed atomics let other threads read it),
+	//! except for its key, replaced by 'kRemovedKey' by the thread disconnecting the slot
+	struct Entry
+	{
+		std::atomic<const void*>	mpKey{nullptr};
+		std::atomic<const void*>	mpInvoker{nullptr};
+		std::atomic<uint64_t>		mCount{0};
+		std::atomic<uint64_t>		mTotalCycles{0};
+		std::atomic<uint64_t>		mMaxCycles{0};
+	};
+
+	struct alignas(64) ThreadBuffer
+	{
+		Entry						maSlots[zSignalProfiler::kMaxSlots];
+		Entry						maEmitters[zSignalProfiler::kMaxEmitters];
+		std::atomic<uint64_t>		mDropped{0};
+		std::atomic<bool>			mbInUse{true};
+		ThreadBuffer*				mpNext = nullptr;										//!< Buffers are never freed (only reused), so results survive their thread
+	};
+
+	const char						gRemovedTag = 0;
+	const void* const				kRemovedKey = &gRemovedTag;								//!< Key of entries freed by a disconnection, reusable by owner
+	std::atomic<ThreadBuffer*>		gpBuffers{nullptr};
+
+	ThreadBuffer* AcquireBuffer()
+	{
+		for( ThreadBuffer* pBuffer = gpBuffers.load(); pBuffer; pBuffer = pBuffer->mpNext )
+		{
+			bool bExpected = false;
+			if( !pBuffer->mbInUse.load(std::memory_order_relaxed) && pBuffer->mbInUse.compare_exchange_strong(bExpected, true) )
+				return pBuffer;
+		}
+		ThreadBuffer* pBuffer	= new ThreadBuffer;
+		pBuffer->mpNext			= gpBuffers.load();
+		while( !gpBuffers.compare_exchange_weak(pBuffer->mpNext, pBuffer) ) {}
+		return pBuffer;
+	}
+
+	//! Release thread buffer when thread exits, so it can be reused by a new thread
+	struct ThreadBufferOwner
+	{
+		ThreadBuffer*	mpBuffer = AcquireBuffer();
+						~ThreadBufferOwner()	{ mpBuffer->mbInUse.store(false); }
+	};
+
+	ThreadBuffer& GetThreadBuffer()
+	{
+		thread_local ThreadBufferOwner tOwner;
+		return *tOwner.mpBuffer;
+	}
+
+	//! Find the entry of a key, or add it (in first removed or empty entry), in a table only this thread adds to
+	Entry* FindEntry(Entry* _pTable, uint32_t _TableSize, const void* _pKey)
+	{
+		const uint32_t Mask	= _TableSize - 1;
+		uint32_t Index		= static_cast<uint32_t>((reinterpret_cast<uintptr_t>(_pKey) >> 4) * 2654435761u) & Mask;
+		Entry* pFree		= nullptr;
+		for( uint32_t Probe(0); Probe<_TableSize; ++Probe, Index = (Index + 1) & Mask )
+		{
+			const void* pKey = _pTable[Index].mpKey.load(std::memory_order_relaxed);
+			if( pKey == _pKey )
+				return &_pTable[Index];
+			if( pKey == kRemovedKey || pKey == nullptr )
+			{
+				pFree = pFree ? pFree : &_pTable[Index];
+				if( pKey == nullptr )
+					break;
+			}
+		}
+		if( pFree )
+		{
+			pFree->mCount.store(0, std::memory_order_relaxed);
+			pFree->mTotalCycles.store(0, std::memory_order_relaxed);
+			pFree->mMaxCycles.store(0, std::memory_order_relaxed);
+			pFree->mpKey.store(_pKey, std::memory_order_release);
+		}
+		return pFree;
+	}
+
+	//! Results of disconnected slots, merged by slot address
+	std::mutex& GetRemovedMutex()
+	{
+		static std::mutex sMutex;
+		return sMutex;
+	}
+
+	eastl::hash_map<const void*, Stat>& GetRemovedStats()
+	{
+		static eastl::hash_map<const void*, Stat> shmStats;
+		return shmStats;
+	}
+
+	void MergeEntry(Stat& _Stat, const Entry& _Entry)
+	{
+		_Stat.mpInvoker		= _Entry.mpInvoker.load(std::memory_order_relaxed);
+		_Stat.mCount		+= _Entry.mCount.load(std::memory_order_relaxed);
+		_Stat.mTotalCycles	+= _Entry.mTotalCycles.load(std::memory_order_relaxed);
+		_Stat.mMaxCycles	= std::max(_Stat.mMaxCycles, _Entry.mMaxCycles.load(std::memory_order_relaxed));
+	}
+
+	inline void Increment(std::atomic<uint64_t>& _Value, uint64_t _Add)
+	{
+		_Value.store(_Value.load(std::memory_order_relaxed) + _Add, std::memory_order_relaxed);
+	}
+
+	std::mutex& GetNamesMutex()
+	{
+		static std::mutex sMutex;
+		return sMutex;
+	}
+
+	eastl::vector<eastl::pair<const void*, const char*>>& GetNames()
+	{
+		static eastl::vector<eastl::pair<const void*, const char*>> sNames;
+		return sNames;
+	}
+
+	const char* FindName(const void* _pObject)
+	{
+		std::lock_guard<std::mutex> Lock(GetNamesMutex());
+		for( const auto& Name : GetNames() )
+			if( Name.first == _pObject )
+				return Name.second;
+		return nullptr;
+	}
+}
+
+void zSignalProfiler::RecordSignal(const void* _pEmitter)
+{
+	ThreadBuffer& Buffer = GetThreadBuffer();
+	if( Entry* pEntry = FindEntry(Buffer.maEmitters, kMaxEmitters, _pEmitter) )
+		Increment(pEntry->mCount, 1);
+	else
+		Increment(Buffer.mDropped, 1);
+}
+
+void zSignalProfiler::RecordInvoke(const void* _pSlot, const void* _pInvoker, uint64_t _Cycles)
+{
+	ThreadBuffer& Buffer = GetThreadBuffer();
+	if( Entry* pEntry = FindEntry(Buffer.maSlots, kMaxSlots, _pSlot) )
+	{
+		pEntry->mpInvoker.store(_pInvoker, std::memory_order_relaxed);
+		Increment(pEntry->mCount, 1);
+		Increment(pEntry->mTotalCycles, _Cycles);
+		if( _Cycles > pEntry->mMaxCycles.load(std::memory_order_relaxed) )
+			pEntry->mMaxCycles.store(_Cycles, std::memory_order_relaxed);
+	}
+	else
+		Increment(Buffer.mDropped, 1);
+}
+
+void zSignalProfiler::RecordDisconnect(const void* _pSlot)
+{
+	// Slot isn't invoked anymore (or concurrently), only its key is contended, by owner reusing removed entries
+	const uint32_t Mask	= kMaxSlots - 1;
+	const uint32_t Hash	= static_cast<uint32_t>((reinterpret_cast<uintptr_t>(_pSlot) >> 4) * 2654435761u) & Mask;
+	std::lock_guard<std::mutex> Lock(GetRemovedMutex());
+	for( ThreadBuffer* pBuffer = gpBuffers.load(); pBuffer; pBuffer = pBuffer->mpNext )
+	{
+		uint32_t Index = Hash;
+		for( uint32_t Probe(0); Probe<kMaxSlots; ++Probe, Index = (Index + 1) & Mask )
+		{
+			Entry& EntryItem	= pBuffer->maSlots[Index];
+			const void* pKey	= EntryItem.mpKey.load(std::memory_order_acquire);
+			if( pKey == nullptr )
+				break;
+			if( pKey == _pSlot )
+			{
+				Stat& StatItem	= GetRemovedStats()[_pSlot];
+				StatItem.mpObject = _pSlot;
+				MergeEntry(StatItem, EntryItem);
+				EntryItem.mpKey.compare_exchange_strong(pKey, kRemovedKey);
+				break;
+			}
+		}
+	}
+}
+
+void zSignalProfiler::SetName(const void* _pObject, const char* _zName)
+{
+	std::lock_guard<std::mutex> Lock(GetNamesMutex());
+	for( auto& Name : GetNames() )
+	{
+		if( Name.first == _pObject )
+		{
+			Name.second = _zName;
+			return;
+		}
+	}
+	GetNames().push_back(eastl::make_pair(_pObject, _zName));
+}
+
+size_t zSignalProfiler::GetTopSlots(Stat* _pStats, size_t _MaxCount)
+{
+	// Merge per thread entries of a same slot, with results of disconnected ones
+	eastl::hash_map<const void*, Stat> hmStats;
+	{
+		std::lock_guard<std::mutex> Lock(GetRemovedMutex());
+		hmStats.insert(GetRemovedStats().begin(), GetRemovedStats().end());
+	}
+	for( ThreadBuffer* pBuffer = gpBuffers.load(); pBuffer; pBuffer = pBuffer->mpNext )
+	{
+		for( const Entry& EntryItem : pBuffer->maSlots )
+		{
+			const void* pKey = EntryItem.mpKey.load(std::memory_order_acquire);
+			if( !pKey || pKey == kRemovedKey )
+				continue;
+			Stat& StatItem		= hmStats[pKey];
+			StatItem.mpObject	= pKey;
+			MergeEntry(StatItem, EntryItem);
+		}
+	}
+
+	eastl::vector<Stat> aStats(hmStats.size());
+	size_t StatIndex = 0;
+	for( const auto& StatPair : hmStats )
+		aStats[StatIndex++] = StatPair.second;
+	const size_t Count = std::min(_MaxCount, aStats.size());
+	std::partial_sort(aStats.begin(), aStats.begin() + Count, aStats.end(), [](const Stat& _A, const Stat& _B){ return _A.mTotalCycles > _B.mTotalCycles; });
+	for( size_t i(0); i<Count; ++i )
+	{
+		_pStats[i]			= aStats[i];
+		_pStats[i].mzName	= FindName(aStats[i].mpObject);
+	}
+	return Count;
+}
+
+zSignalProfiler::Stat zSignalProfiler::GetEmitterStat(const void* _pEmitter)
+{
+	Stat Result;
+	Result.mpObject	= _pEmitter;
+	Result.mzName	= FindName(_pEmitter);
+	for( ThreadBuffer* pBuffer = gpBuffers.load(); pBuffer; pBuffer = pBuffer->mpNext )
+		for( const Entry& EntryItem : pBuffer->maEmitters )
+			if( EntryItem.mpKey.load(std::memory_order_acquire) == _pEmitter )
+				Result.mCount += EntryItem.mCount.load(std::memory_order_relaxed);
+	return Result;
+}
+
+uint64_t zSignalProfiler::GetDroppedCount()
+{
+	uint64_t Dropped = 0;
+	for( ThreadBuffer* pBuffer = gpBuffers.load(); pBuffer; pBuffer = pBuffer->mpNext )
+		Dropped += pBuffer->mDropped.load(std::memory_order_relaxed);
+	return Dropped;
+}
+
+void zSignalProfiler::DumpTopSlots(size_t _MaxCount, FILE* _pFile)
+{
+	eastl::vector<Stat> aStats(_MaxCount);
+	const size_t Count = GetTopSlots(aStats.data(), _MaxCount);
+	fprintf(_pFile, "\n Slowest slots (cycles)");
+	fprintf(_pFile, "\n %-24s | %-18s | %-18s | %10s | %14s | %10s | %10s", "Name", "Slot", "Invoker", "Count", "Total", "Average", "Max");
+	for( size_t i(0); i<Count; ++i )
+	{
+		const Stat& StatItem = aStats[i];
+		fprintf(_pFile, "\n %-24s | %18p | %18p | %10llu | %14llu | %10.01f | %10llu", StatItem.mzName ? StatItem.mzName : "-", StatItem.mpObject, StatItem.mpInvoker,
+			(unsigned long long)StatItem.mCount, (unsigned long long)StatItem.mTotalCycles, StatItem.mCount ? double(StatItem.mTotalCycles) / double(StatItem.mCount) : 0.0, (unsigned long long)StatItem.mMaxCycles);
+	}
+	if( const uint64_t Dropped = GetDroppedCount() )
+		fprintf(_pFile, "\n (%llu records dropped, thread tables full)", (unsigned long long)Dropped);
+}
+
+void zSignalProfiler::Reset()
+{
+	{
+		std::lock_guard<std::mutex> Lock(GetRemovedMutex());
+		GetRemovedStats().clear();
+	}
+	for( ThreadBuffer* pBuffer = gpBuffers.load(); pBuffer; pBuffer = pBuffer->mpNext )
+	{
+		for( Entry& EntryItem : pBuffer->maSlots )
+		{
+			EntryItem.mCount.store(0, std::memory_order_relaxed);
+			EntryItem.mTotalCycles.store(0, std::memory_order_relaxed);
+			EntryItem.mMaxCycles.store(0, std::memory_order_relaxed);
+		}
+		for( Entry& EntryItem : pBuffer->maEmitters )
+			EntryItem.mCount.store(0, std::memory_order_relaxed);
+		pBuffer->mDropped.store(0, std::memory_order_relaxed);
+	}
+}
+
+#endif
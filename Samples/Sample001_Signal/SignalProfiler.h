@@ -0,0 +1,101 @@
+#pragma once
+
+//==================================================================================================
+// Signal profiling, enabled by building with ZEN_SIGNAL_PROFILE=1 (hooks compile to nothing otherwise)
+//==================================================================================================
+#ifndef ZEN_SIGNAL_PROFILE
+	#define ZEN_SIGNAL_PROFILE 0
+#endif
+
+#if ZEN_SIGNAL_PROFILE
+
+#include <atomic>
+#include <cstdio>
+#include <stdint.h>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+	#include <x86intrin.h>
+#else
+	#include <chrono>
+#endif
+
+#define zenSignalProfileConcat2(_A, _B)				_A##_B
+#define zenSignalProfileConcat(_A, _B)				zenSignalProfileConcat2(_A, _B)
+#define zenSignalProfileSignal(_pEmitter)			zSignalProfiler::RecordSignal(_pEmitter)
+#define zenSignalProfileInvoke(_pSlot, _pInvoker)	zSignalProfiler::InvokeScope zenSignalProfileConcat(ProfileScope, __LINE__)(_pSlot, reinterpret_cast<const void*>(_pInvoker))
+#define zenSignalProfileDisconnect(_pSlot)			zSignalProfiler::RecordDisconnect(_pSlot)
+
+//==================================================================================================
+//! @Class		Per emitter signal counters, and per slot invocation counters and timings
+//! @details	Each thread records in its own buffer (small open addressing tables keyed by
+//!				emitter/slot address), without locks or atomic read-modify-write : only the
+//!				owner thread writes, other threads only read when gathering results.
+//!				Time is measured in cycles (rdtsc on x86, steady clock nanoseconds elsewhere).
+//!				Slots are identified by address, invoker address (callback stub, useful
+//!				with a symbolizer) and an optional name given with 'SetName'.
+//!				Disconnecting a slot moves its counters out of the thread tables, into a shared
+//!				list of results (guarded by a mutex), so tables only hold connected slots.
+//!				Buffers of exited threads are reused by new ones, keeping their results.
+//! @Example	Build with ZEN_SIGNAL_PROFILE=1, run, then zSignalProfiler::DumpTopSlots(10);
+//==================================================================================================
+class zSignalProfiler
+{
+public:
+	static constexpr uint32_t kMaxSlots		= 2048;													//!< Slots tracked per thread (power of 2), others only count as dropped
+	static constexpr uint32_t kMaxEmitters	= 512;													//!< Emitters tracked per thread (power of 2)
+
+	//! Aggregated result for one slot (or emitter)
+	struct Stat
+	{
+		const void*				mpObject		= nullptr;											//!< Slot or Emitter address
+		const void*				mpInvoker		= nullptr;											//!< Callback stub invoked by slot
+		const char*				mzName			= nullptr;
+		uint64_t				mCount			= 0;												//!< Invocations (slot) or Signals (emitter)
+		uint64_t				mTotalCycles	= 0;
+		uint64_t				mMaxCycles		= 0;
+	};
+
+	//! RAII timing of one slot invocation
+	class InvokeScope
+	{
+	public:
+		inline					InvokeScope(const void* _pSlot, const void* _pInvoker) : mpSlot(_pSlot), mpInvoker(_pInvoker), mStartCycles(ReadCycles()) {}
+		inline					~InvokeScope()				{ RecordInvoke(mpSlot, mpInvoker, ReadCycles() - mStartCycles); }
+								InvokeScope(const InvokeScope&)=delete;
+		InvokeScope&			operator=(const InvokeScope&)=delete;
+	protected:
+		const void*				mpSlot;
+		const void*				mpInvoker;
+		uint64_t				mStartCycles;
+	};
+
+	static inline uint64_t		ReadCycles();
+	static void					RecordSignal(const void* _pEmitter);
+	static void					RecordInvoke(const void* _pSlot, const void* _pInvoker, uint64_t _Cycles);
+	static void					RecordDisconnect(const void* _pSlot);								//!< Free table entries of a slot, its results are kept
+	static void					SetName(const void* _pObject, const char* _zName);					//!< Name a slot or emitter in reports (string must stay valid)
+	static size_t				GetTopSlots(Stat* _pStats, size_t _MaxCount);						//!< Slowest slots (total cycles, all threads), returns count written
+	static Stat					GetEmitterStat(const void* _pEmitter);								//!< Signal count of an emitter (all threads)
+	static uint64_t				GetDroppedCount();													//!< Records lost because a thread table was full
+	static void					DumpTopSlots(size_t _MaxCount, FILE* _pFile=stdout);
+	static void					Reset();															//!< Clear counters (approximate if signals are in flight)
+};
+
+uint64_t zSignalProfiler::ReadCycles()
+{
+#if (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))) || defined(__x86_64__) || defined(__i386__)
+	return __rdtsc();
+#else
+	return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+#else
+
+#define zenSignalProfileSignal(_pEmitter)
+#define zenSignalProfileInvoke(_pSlot, _pInvoker)
+#define zenSignalProfileDisconnect(_pSlot)
+
+#endif
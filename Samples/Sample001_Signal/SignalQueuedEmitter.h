@@ -0,0 +1,124 @@
+#pragma once
+
+#include <tuple>
+#include <type_traits>
+#include <EASTL/intrusive_list.h>
+#include <EASTL/bonus/ring_buffer.h>
+#include "SignalEmitter.h"
+
+//==================================================================================================
+//! @Class		Flush a group of queued emitters at a chosen point of the frame
+//! @details	Queued emitters registered with a dispatcher are flushed together when calling
+//!				'Flush', in registration order. A default global instance is available.
+//!				Queued emitters can be unregistered or destroyed by callbacks while flushing.
+//==================================================================================================
+class zSignalDispatcher
+{
+public:
+	//----------------------------------------------------------------------------------------------
+	//! @Class	Interface of queued emitters, letting dispatcher flush them without knowing their type
+	//----------------------------------------------------------------------------------------------
+	class Queue : public eastl::intrusive_list_node
+	{
+	public:
+								Queue()						{ mpNext = mpPrev = nullptr; }
+		virtual					~Queue()					{ Unregister(); }
+		virtual void			Flush()=0;															//!< Deliver all pending events
+		inline void				Unregister();
+	protected:
+		zSignalDispatcher*		mpDispatcher = nullptr;												//!< Dispatcher this queue is registered with
+		friend class zSignalDispatcher;
+	};
+
+	inline void					Register(Queue& _Queue);
+	inline void					Flush();															//!< Flush every registered queued emitter
+	static zSignalDispatcher&	GetDefault()				{ static zSignalDispatcher sDispatcher; return sDispatcher; }
+
+protected:
+	//! State of a 'Flush' in progress, lives on its stack
+	struct Cursor
+	{
+		eastl::intrusive_list_node* mpNextNode;														//!< Next queue to flush (list anchor when done)
+		Cursor*					mpOuter;															//!< Flush in progress when this one started (nested flush)
+	};
+	typedef eastl::intrusive_list<eastl::intrusive_list_node> QueueList;							//!< Stored as list nodes, queues are polymorphic (node not at their address)
+	QueueList					mlstQueues;
+	Cursor*						mpCursor = nullptr;													//!< Inner most flush in progress
+};
+
+//==================================================================================================
+//! @Class		Emitter with an opt-in queued delivery mode
+//! @details	'Signal' still invokes every slot right away (see zEmitter).
+//!				'Post' only copies/moves the arguments in a ring buffer, that keeps its storage
+//!				between flushes, so there's no allocation once it reached its peak size.
+//!				'Flush' (or the dispatcher it is registered with) later delivers all pending
+//!				events, listener-major : each slot receives the whole batch before the next slot,
+//!				keeping the callback code and data hot in cache across events.
+//!				Events posted while flushing are kept for the next flush : 'Flush' swaps the
+//!				pending events with a second ring buffer before delivering them, so 'Post' never
+//!				moves an event a callback is receiving. 'ClearPending' from a callback also drops
+//!				the remainder of the batch being flushed, once that callback returns.
+//!				Slots know their emitter : a callback can disconnect or destroy any slot while
+//!				flushing (its own included, when its owner dies), remaining events are skipped.
+//!				zEmitter is a protected base, so only zQueuedEmitter::Slot can connect to it.
+//!				Posted arguments are stored decayed, reference parameters receive the stored copy.
+//! @Example	zQueuedEmitter<int> Emitter(&zSignalDispatcher::GetDefault());
+//!				Emitter.Post(1); Emitter.Post(2);	// Cheap, no callback invoked
+//!				zSignalDispatcher::GetDefault().Flush();
+//==================================================================================================
+template<typename... TParameters>
+class zQueuedEmitter : protected zEmitter<TParameters...>, public zSignalDispatcher::Queue
+{
+protected:
+	typedef zEmitter<TParameters...> Base;
+public:
+	typedef std::tuple<typename std::decay<TParameters>::type...> Event;							//!< Copy of the parameters of a posted signal
+
+	//----------------------------------------------------------------------------------------------
+	//! @Class	Slot aware of its emitter, to update the flush in progress when removed
+	//----------------------------------------------------------------------------------------------
+	class Slot : public Base::Slot
+	{
+	public:
+		typedef typename Base::Slot::Callback		Callback;
+		typedef zQueuedEmitter<TParameters...>		Emitter;
+
+								Slot()=default;
+								~Slot()						{ Disconnect(); }
+								Slot(const Slot&)=delete;
+		Slot&					operator=(const Slot&)=delete;
+		inline void				Connect(zQueuedEmitter& _Emitter, const Callback& _Callback);
+		template<auto TFunction>
+		inline void				Connect(zQueuedEmitter& _Emitter)						{ Connect(_Emitter, Callback::template Bind<TFunction>()); }
+		template<auto TMethod, typename TObject>
+		inline void				Connect(zQueuedEmitter& _Emitter, TObject* _pObject)	{ Connect(_Emitter, Callback::template Bind<TMethod>(_pObject)); }
+		inline void				Disconnect();
+
+	protected:
+		zQueuedEmitter*			mpEmitter = nullptr;
+		friend class zQueuedEmitter;
+	};
+
+								zQueuedEmitter(zSignalDispatcher* _pDispatcher=nullptr, size_t _Capacity=16);
+								~zQueuedEmitter()			{ DisconnectAll(); }
+	using						Base::Signal;														//!< Invoke every slot right away
+	inline void					DisconnectAll();
+	template<typename... TArgs>
+	inline void					Post(TArgs&&... _Values);											//!< Queue a signal, delivered on next flush
+	virtual void				Flush()override;													//!< Deliver all pending events, listener-major
+	inline void					ClearPending();														//!< Drop all pending events
+	inline size_t				GetPendingCount()const;
+	inline void					Reserve(size_t _Capacity);											//!< Preallocate queue, to avoid allocation on 'Post'
+
+protected:
+	inline void					Remove(Slot& _Slot);
+
+	eastl::ring_buffer<Event>	mEvents;															//!< Pending events, oldest first
+	eastl::ring_buffer<Event>	mFlushEvents;														//!< Events being delivered by 'Flush' (empty otherwise, keeps its storage)
+	const Slot*					mpFlushSlot = nullptr;												//!< Slot receiving the batch (nullptr once removed)
+	eastl::intrusive_list_node*	mpFlushNext = nullptr;												//!< Next slot to receive the batch (moved when removed)
+	bool						mbFlushing = false;													//!< Ignore nested flush requests from callbacks
+	bool						mbFlushCleared = false;												//!< 'ClearPending' called while flushing, stop delivering the batch
+};
+
+#include "SignalQueuedEmitter.inl"
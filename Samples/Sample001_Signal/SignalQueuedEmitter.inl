@@ -0,0 +1,134 @@
+
+void zSignalDispatcher::Queue::Unregister()
+{
+	if( mpNext )
+	{
+		for( Cursor* pCursor = mpDispatcher->mpCursor; pCursor; pCursor = pCursor->mpOuter )
+		{
+			if( pCursor->mpNextNode == this )
+				pCursor->mpNextNode = mpNext;
+		}
+		QueueList::remove(*this);
+		mpNext = mpPrev = nullptr;
+		mpDispatcher = nullptr;
+	}
+}
+
+void zSignalDispatcher::Register(Queue& _Queue)
+{
+	_Queue.Unregister();
+	_Queue.mpDispatcher = this;
+	mlstQueues.push_back(_Queue);
+}
+
+void zSignalDispatcher::Flush()
+{
+	const eastl::intrusive_list_node* pEnd = mlstQueues.end().mpNode;
+	Cursor Current{mlstQueues.begin().mpNode, mpCursor};
+	mpCursor = &Current;
+	while( Current.mpNextNode != pEnd )
+	{
+		Queue& QueueItem	= *static_cast<Queue*>(Current.mpNextNode);
+		Current.mpNextNode	= Current.mpNextNode->mpNext;	// Advance before flushing, 'Unregister' moves it if a callback removes the next queue
+		QueueItem.Flush();
+	}
+	mpCursor = Current.mpOuter;
+}
+
+template<typename... TParameters>
+void zQueuedEmitter<TParameters...>::Slot::Connect(zQueuedEmitter& _Emitter, const Callback& _Callback)
+{
+	Disconnect();
+	mpEmitter = &_Emitter;
+	Base::Slot::Connect(_Emitter, _Callback);
+}
+
+template<typename... TParameters>
+void zQueuedEmitter<TParameters...>::Slot::Disconnect()
+{
+	if( mpEmitter )
+		mpEmitter->Remove(*this);
+}
+
+template<typename... TParameters>
+void zQueuedEmitter<TParameters...>::Remove(Slot& _Slot)
+{
+	if( mpFlushSlot == &_Slot )
+		mpFlushSlot = nullptr;
+	if( mpFlushNext == &_Slot )
+		mpFlushNext = _Slot.mpNext;
+	_Slot.Base::Slot::Disconnect();
+	_Slot.mpEmitter = nullptr;
+}
+
+template<typename... TParameters>
+void zQueuedEmitter<TParameters...>::DisconnectAll()
+{
+	while( !Base::mlstSlots.empty() )
+		Remove(static_cast<Slot&>(Base::mlstSlots.front()));
+}
+
+template<typename... TParameters>
+zQueuedEmitter<TParameters...>::zQueuedEmitter(zSignalDispatcher* _pDispatcher, size_t _Capacity)
+: mEvents(_Capacity)
+, mFlushEvents(_Capacity)
+{
+	if( _pDispatcher )
+		_pDispatcher->Register(*this);
+}
+
+template<typename... TParameters>
+template<typename... TArgs>
+void zQueuedEmitter<TParameters...>::Post(TArgs&&... _Values)
+{
+	// Ring buffer overwrites oldest entry when full, grow it instead (only until it reaches peak usage)
+	if( mEvents.full() )
+		mEvents.reserve(mEvents.capacity() ? mEvents.capacity() * 2 : 16);
+	mEvents.push_back(Event(std::forward<TArgs>(_Values)...));
+}
+
+template<typename... TParameters>
+void zQueuedEmitter<TParameters...>::Flush()
+{
+	if( mbFlushing )
+		return;
+
+	mbFlushing			= true;
+	mbFlushCleared		= false;
+	mEvents.swap(mFlushEvents);				// Events posted by callbacks will wait next flush, in the other buffer
+	const size_t Count	= mFlushEvents.size();
+	const eastl::intrusive_list_node* pEnd = Base::mlstSlots.end().mpNode;
+	mpFlushNext			= Base::mlstSlots.begin().mpNode;
+	while( mpFlushNext != pEnd && !mbFlushCleared )
+	{
+		mpFlushSlot			= static_cast<const Slot*>(mpFlushNext);
+		mpFlushNext			= mpFlushNext->mpNext;	// Advance before invoking callback, 'Remove' moves it if callback removes the next slot
+		for( size_t idx(0); idx<Count && mpFlushSlot && !mbFlushCleared; ++idx )	// Slot is only accessed while still connected
+			std::apply(mpFlushSlot->GetCallback(), mFlushEvents[idx]);
+	}
+	mpFlushSlot			= nullptr;
+	mpFlushNext			= nullptr;
+	mFlushEvents.clear();
+	mbFlushing			= false;
+}
+
+template<typename... TParameters>
+void zQueuedEmitter<TParameters...>::ClearPending()
+{
+	mEvents.clear();
+	mbFlushCleared = mbFlushing;	// Batch being flushed is still referenced by the current callback, dropped when it returns
+}
+
+template<typename... TParameters>
+size_t zQueuedEmitter<TParameters...>::GetPendingCount()const
+{
+	return mEvents.size();
+}
+
+template<typename... TParameters>
+void zQueuedEmitter<TParameters...>::Reserve(size_t _Capacity)
+{
+	mEvents.reserve(_Capacity);
+	if( !mbFlushing )
+		mFlushEvents.reserve(_Capacity);	// Both buffers swap roles on each flush (not while a callback is receiving one of its events)
+}
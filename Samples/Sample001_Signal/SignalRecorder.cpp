@@ -0,0 +1,301 @@
+#include "SignalRecorder.h"
+#include <thread>
+
+#if defined(_WIN32)
+	#define WIN32_LEAN_AND_MEAN
+	#define NOMINMAX
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+static constexpr uint64_t kPageBytes = 4096;	// Smallest page size of supported platforms, touching more often than needed is harmless
+
+//==================================================================================================
+// zSignalLogFile
+//==================================================================================================
+void zSignalLogFile::Prefault(uint64_t _Offset, uint64_t _Bytes)
+{
+	const uint64_t End = _Offset + _Bytes < mSize ? _Offset + _Bytes : mSize;
+	for( uint64_t Offset(_Offset); Offset < End; Offset += kPageBytes )
+		reinterpret_cast<volatile uint8_t*>(mpData)[Offset] = 0;	// Unwritten part of the file, already zero
+}
+
+#if defined(_WIN32)
+
+bool zSignalLogFile::OpenWrite(const char* _zPath)
+{
+	Close();
+	HANDLE hFile = CreateFileA(_zPath, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if( hFile == INVALID_HANDLE_VALUE )
+		return false;
+	mhFile = hFile;
+	return true;
+}
+
+bool zSignalLogFile::OpenRead(const char* _zPath)
+{
+	Close();
+	HANDLE hFile = CreateFileA(_zPath, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if( hFile == INVALID_HANDLE_VALUE )
+		return false;
+	mhFile = hFile;
+
+	LARGE_INTEGER FileSize;
+	if( !GetFileSizeEx(hFile, &FileSize) || FileSize.QuadPart == 0 )
+		return Close(), false;
+	mhMapping	= CreateFileMappingA(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	mpData		= mhMapping ? static_cast<uint8_t*>(MapViewOfFile(mhMapping, FILE_MAP_READ, 0, 0, 0)) : nullptr;
+	mSize		= static_cast<uint64_t>(FileSize.QuadPart);
+	if( !mpData )
+		return Close(), false;
+	return true;
+}
+
+bool zSignalLogFile::Grow(uint64_t _Bytes)
+{
+	if( !mhFile || _Bytes <= mSize )
+		return mhFile && _Bytes == mSize;
+
+	// Mapping a bigger size extends the file, previous view is only released once the new one exists
+	HANDLE hMapping	= CreateFileMappingA(mhFile, nullptr, PAGE_READWRITE, static_cast<DWORD>(_Bytes >> 32), static_cast<DWORD>(_Bytes), nullptr);
+	uint8_t* pData	= hMapping ? static_cast<uint8_t*>(MapViewOfFile(hMapping, FILE_MAP_WRITE, 0, 0, static_cast<SIZE_T>(_Bytes))) : nullptr;
+	if( !pData )
+	{
+		if( hMapping )
+			CloseHandle(hMapping);
+		return false;
+	}
+	Unmap();
+	mhMapping	= hMapping;
+	mpData		= pData;
+	mSize		= _Bytes;
+	return true;
+}
+
+bool zSignalLogFile::Trim(uint64_t _Bytes)
+{
+	Unmap();
+	LARGE_INTEGER FileSize;
+	FileSize.QuadPart = static_cast<LONGLONG>(_Bytes);
+	return mhFile && SetFilePointerEx(mhFile, FileSize, nullptr, FILE_BEGIN) && SetEndOfFile(mhFile);
+}
+
+void zSignalLogFile::Unmap()
+{
+	if( mpData )
+		UnmapViewOfFile(mpData);
+	if( mhMapping )
+		CloseHandle(mhMapping);
+	mpData		= nullptr;
+	mhMapping	= nullptr;
+	mSize		= 0;
+}
+
+void zSignalLogFile::Close()
+{
+	Unmap();
+	if( mhFile )
+		CloseHandle(mhFile);
+	mhFile = nullptr;
+}
+
+#else
+
+bool zSignalLogFile::OpenWrite(const char* _zPath)
+{
+	Close();
+	mFile = open(_zPath, O_RDWR | O_CREAT | O_TRUNC, 0644);
+	return mFile >= 0;
+}
+
+bool zSignalLogFile::OpenRead(const char* _zPath)
+{
+	Close();
+	mFile = open(_zPath, O_RDONLY);
+	struct stat FileStat;
+	if( mFile < 0 || fstat(mFile, &FileStat) != 0 || FileStat.st_size == 0 )
+		return Close(), false;
+
+	void* pData = mmap(nullptr, static_cast<size_t>(FileStat.st_size), PROT_READ, MAP_PRIVATE, mFile, 0);
+	if( pData == MAP_FAILED )
+		return Close(), false;
+	mpData	= static_cast<uint8_t*>(pData);
+	mSize	= static_cast<uint64_t>(FileStat.st_size);
+	return true;
+}
+
+bool zSignalLogFile::Grow(uint64_t _Bytes)
+{
+	if( mFile < 0 || _Bytes <= mSize )
+		return mFile >= 0 && _Bytes == mSize;
+	if( ftruncate(mFile, static_cast<off_t>(_Bytes)) != 0 )	// Current mapping stays valid on failure
+		return false;
+
+#if defined(MREMAP_MAYMOVE)
+	void* pData = mpData	? mremap(mpData, static_cast<size_t>(mSize), static_cast<size_t>(_Bytes), MREMAP_MAYMOVE)
+							: mmap(nullptr, static_cast<size_t>(_Bytes), PROT_READ | PROT_WRITE, MAP_SHARED, mFile, 0);
+	if( pData == MAP_FAILED )
+		return false;
+#else
+	void* pData = mmap(nullptr, static_cast<size_t>(_Bytes), PROT_READ | PROT_WRITE, MAP_SHARED, mFile, 0);
+	if( pData == MAP_FAILED )
+		return false;
+	Unmap();
+#endif
+	mpData	= static_cast<uint8_t*>(pData);
+	mSize	= _Bytes;
+	return true;
+}
+
+bool zSignalLogFile::Trim(uint64_t _Bytes)
+{
+	Unmap();
+	return mFile >= 0 && ftruncate(mFile, static_cast<off_t>(_Bytes)) == 0;
+}
+
+void zSignalLogFile::Unmap()
+{
+	if( mpData )
+		munmap(mpData, static_cast<size_t>(mSize));
+	mpData	= nullptr;
+	mSize	= 0;
+}
+
+void zSignalLogFile::Close()
+{
+	Unmap();
+	if( mFile >= 0 )
+		close(mFile);
+	mFile = -1;
+}
+
+#endif
+
+//==================================================================================================
+// zSignalRecorder
+//==================================================================================================
+bool zSignalRecorder::Open(const char* _zPath, uint64_t _GrowBytes)
+{
+	Close();
+	mGrowBytes		= _GrowBytes > sizeof(FileHeader) ? _GrowBytes : kDefaultGrowBytes;
+	mWriteOffset	= sizeof(FileHeader);
+	mRecordCount	= 0;
+	mDroppedCount	= 0;
+	if( !mFile.OpenWrite(_zPath) || !mFile.Grow(mGrowBytes) )
+	{
+		mFile.Close();
+		return false;
+	}
+	mFile.Prefault(0, mGrowBytes);
+	mStartTime		= std::chrono::steady_clock::now();
+	mStartTicks		= ReadTicks();
+	return true;
+}
+
+void zSignalRecorder::Close()
+{
+	if( !IsOpen() )
+		return;
+
+	FileHeader Header;
+	Header.mMagic		= kMagic;
+	Header.mVersion		= kVersion;
+	Header.mRecordCount	= mRecordCount;
+	Header.mDataBytes	= mWriteOffset - sizeof(FileHeader);
+	const uint64_t ElapsedTicks	= ReadTicks() - mStartTicks;
+	const double ElapsedSeconds	= std::chrono::duration<double>(std::chrono::steady_clock::now() - mStartTime).count();
+	Header.mTicksPerSecond		= ElapsedSeconds > 0 && ElapsedTicks > 0 ? static_cast<uint64_t>(ElapsedTicks / ElapsedSeconds) : 1000000000;
+	memcpy(mFile.GetData(), &Header, sizeof(Header));
+	mFile.Trim(mWriteOffset);
+	mFile.Close();
+}
+
+bool zSignalRecorder::Grow(uint64_t _MinBytes)
+{
+	// Doubling keeps the total cost of growing linear, only the first chunk is prefaulted so a
+	// single 'Signal' never waits on more than 'mGrowBytes' of page faults
+	const uint64_t OldSize	= mFile.GetSize();
+	uint64_t NewSize		= OldSize + (OldSize > mGrowBytes ? OldSize : mGrowBytes);
+	if( NewSize < _MinBytes )
+		NewSize = _MinBytes;
+	if( !mFile.GetData() || !mFile.Grow(NewSize) )
+		return false;
+	mFile.Prefault(OldSize, mGrowBytes);
+	return true;
+}
+
+//==================================================================================================
+// zSignalReplayer
+//==================================================================================================
+bool zSignalReplayer::Open(const char* _zPath)
+{
+	Close();
+	if( !mFile.OpenRead(_zPath) )
+		return false;
+
+	const zSignalRecorder::FileHeader* pHeader = reinterpret_cast<const zSignalRecorder::FileHeader*>(mFile.GetData());
+	if( mFile.GetSize() < sizeof(zSignalRecorder::FileHeader) || pHeader->mMagic != zSignalRecorder::kMagic || pHeader->mVersion != zSignalRecorder::kVersion ||
+		pHeader->mDataBytes > mFile.GetSize() - sizeof(zSignalRecorder::FileHeader) )
+	{
+		mFile.Close();
+		return false;
+	}
+	return true;
+}
+
+void zSignalReplayer::Close()
+{
+	mFile.Close();
+	mSkippedCount = 0;
+}
+
+uint64_t zSignalReplayer::Replay(eSpeed _Speed)
+{
+	if( !mFile.GetData() )
+		return 0;
+
+	const zSignalRecorder::FileHeader* pHeader	= reinterpret_cast<const zSignalRecorder::FileHeader*>(mFile.GetData());
+	const uint8_t* pData						= mFile.GetData() + sizeof(zSignalRecorder::FileHeader);
+	const uint8_t* pDataEnd						= pData + pHeader->mDataBytes;
+	const auto StartTime						= std::chrono::steady_clock::now();
+	const double NsPerTick						= 1e9 / static_cast<double>(pHeader->mTicksPerSecond ? pHeader->mTicksPerSecond : 1);
+	uint64_t FirstTicks							= 0;
+	uint64_t FiredCount							= 0;
+	while( pDataEnd - pData >= (ptrdiff_t)sizeof(zSignalRecorder::RecordHeader) )
+	{
+		zSignalRecorder::RecordHeader Record;
+		memcpy(&Record, pData, sizeof(Record));
+		const uint8_t* pArgs = pData + sizeof(Record);
+		if( (uint64_t)(pDataEnd - pArgs) < Record.mArgBytes )
+			break;
+		pData = pArgs + Record.mArgBytes;
+
+		auto itTarget = mhmTargets.find(Record.mEmitterId);
+		if( itTarget == mhmTargets.end() || itTarget->second.mArgBytes != Record.mArgBytes )
+		{
+			++mSkippedCount;
+			continue;
+		}
+
+		if( _Speed == eSpeed::Recorded )
+		{
+			if( FiredCount == 0 )
+				FirstTicks = Record.mTicks;
+			const auto FireTime = StartTime + std::chrono::nanoseconds(static_cast<int64_t>(static_cast<double>(Record.mTicks - FirstTicks) * NsPerTick));
+			for( auto Now = std::chrono::steady_clock::now(); Now < FireTime; Now = std::chrono::steady_clock::now() )
+			{
+				if( FireTime - Now > std::chrono::milliseconds(2) )
+					std::this_thread::sleep_for(FireTime - Now - std::chrono::milliseconds(1));
+				else
+					std::this_thread::yield();
+			}
+		}
+		itTarget->second.mpFire(itTarget->second.mpEmitter, pArgs);
+		++FiredCount;
+	}
+	return FiredCount;
+}
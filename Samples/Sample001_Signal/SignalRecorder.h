@@ -0,0 +1,195 @@
+#pragma once
+
+#include <chrono>
+#include <cstring>
+#include <stdint.h>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <EASTL/hash_map.h>
+#include "SignalEmitter.h"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+	#include <x86intrin.h>
+#endif
+
+//==================================================================================================
+//! @Class		Memory mapped file, used by signal recorder and replayer
+//! @details	Writable files are extended with 'Grow' (remapped in place with 'mremap' when
+//!				available), the current mapping stays valid if it fails. Pages are faulted in
+//!				lazily, or ahead of time with 'Prefault'. 'Trim' unmaps and sets the final size.
+//==================================================================================================
+class zSignalLogFile
+{
+public:
+								zSignalLogFile()=default;
+								~zSignalLogFile()			{ Close(); }
+								zSignalLogFile(const zSignalLogFile&)=delete;
+	zSignalLogFile&				operator=(const zSignalLogFile&)=delete;
+
+	bool						OpenWrite(const char* _zPath);										//!< Create (or truncate) file, empty until 'Grow'
+	bool						OpenRead(const char* _zPath);										//!< Map whole existing file, read only
+	bool						Grow(uint64_t _Bytes);												//!< Extend writable file to _Bytes, and map all of it
+	void						Prefault(uint64_t _Offset, uint64_t _Bytes);						//!< Touch mapped pages of a range, so writing them won't fault
+	bool						Trim(uint64_t _Bytes);												//!< Unmap writable file, and truncate it to _Bytes
+	void						Close();
+	inline uint8_t*				GetData()const				{ return mpData; }
+	inline uint64_t				GetSize()const				{ return mSize; }
+
+protected:
+	void						Unmap();
+#if defined(_WIN32)
+	void*						mhFile		= nullptr;
+	void*						mhMapping	= nullptr;
+#else
+	int							mFile		= -1;
+#endif
+	uint8_t*					mpData		= nullptr;
+	uint64_t					mSize		= 0;
+};
+
+//==================================================================================================
+//! @Class		Appends signals (emitter id, timestamp, arguments) to a binary log
+//! @details	Log is a memory mapped file, so recording a signal is a bound check, a timestamp
+//!				and a few memcpy, without any system call (except when file needs to grow).
+//!				Arguments must be trivially copyable, they are stored packed, in order.
+//!				Emitters are identified by an id chosen by user, that must stay the same
+//!				between recording and replay (see zRecordedEmitter).
+//!				No multi threading support, record from one thread only.
+//!				Log is only complete once the recorder is closed (header written, file trimmed).
+//! @Example	zSignalRecorder Recorder;
+//!				Recorder.Open("Signals.log");
+//!				zRecordedEmitter<int> Emitter(kEmitterDamageId, &Recorder);
+//==================================================================================================
+class zSignalRecorder
+{
+public:
+	static constexpr uint32_t	kMagic				= 0x4C52535A;										//!< 'ZSRL'
+	static constexpr uint32_t	kVersion			= 2;
+	static constexpr uint64_t	kDefaultGrowBytes	= 16*1024*1024;										//!< Minimum bytes added to the file when full (it doubles past that), and prefaulted
+
+	//! Start of the log file
+	struct FileHeader
+	{
+		uint32_t				mMagic;
+		uint32_t				mVersion;
+		uint64_t				mRecordCount;
+		uint64_t				mDataBytes;															//!< Bytes of records following this header
+		uint64_t				mTicksPerSecond;													//!< Rate of records timestamps
+	};
+
+	//! Start of each record, followed by arguments
+	struct RecordHeader
+	{
+		uint64_t				mTicks;																//!< Time since recorder was opened
+		uint32_t				mEmitterId;
+		uint32_t				mArgBytes;
+	};
+
+								zSignalRecorder()=default;
+								~zSignalRecorder()			{ Close(); }
+								zSignalRecorder(const zSignalRecorder&)=delete;
+	zSignalRecorder&			operator=(const zSignalRecorder&)=delete;
+
+	bool						Open(const char* _zPath, uint64_t _GrowBytes=kDefaultGrowBytes);
+	void						Close();															//!< Write header, and trim file to recorded size
+	inline bool					IsOpen()const				{ return mFile.GetData() != nullptr; }
+	template<typename... TValues>
+	inline void					Record(uint32_t _EmitterId, const TValues&... _Values);
+	inline uint64_t				GetRecordCount()const		{ return mRecordCount; }
+	inline uint64_t				GetDroppedCount()const		{ return mDroppedCount; }				//!< Records lost because file couldn't grow
+
+	static inline uint64_t		ReadTicks();														//!< Cycle counter (steady clock nanoseconds when unsupported)
+	template<typename... TValues>
+	static constexpr uint32_t	GetArgBytes()				{ return static_cast<uint32_t>((size_t(0) + ... + sizeof(typename std::decay<TValues>::type))); }
+
+protected:
+	inline uint8_t*				Reserve(uint64_t _Bytes);											//!< Room for a record, nullptr on failure
+	bool						Grow(uint64_t _MinBytes);
+
+	zSignalLogFile				mFile;
+	std::chrono::steady_clock::time_point mStartTime;
+	uint64_t					mStartTicks		= 0;
+	uint64_t					mWriteOffset	= 0;
+	uint64_t					mGrowBytes		= kDefaultGrowBytes;
+	uint64_t					mRecordCount	= 0;
+	uint64_t					mDroppedCount	= 0;
+};
+
+//==================================================================================================
+//! @Class		Re-fires signals of a log written by zSignalRecorder
+//! @details	Emitters are registered with the id they were recorded with. Records of
+//!				unregistered ids, or whose arguments size doesn't match the emitter, are skipped.
+//!				Replay can wait to reproduce recorded timings, or fire everything at once.
+//! @Example	zSignalReplayer Replayer;
+//!				Replayer.Open("Signals.log");
+//!				Replayer.Register(kEmitterDamageId, Emitter);
+//!				Replayer.Replay(zSignalReplayer::eSpeed::Recorded);
+//==================================================================================================
+class zSignalReplayer
+{
+public:
+	enum class eSpeed
+	{
+		Recorded,																					//!< Wait between signals, like when recorded
+		Maximum,																					//!< Fire signals back to back
+	};
+
+	bool						Open(const char* _zPath);											//!< False if file is missing or not a signal log
+	void						Close();
+	template<typename... TParameters>
+	void						Register(uint32_t _EmitterId, zEmitter<TParameters...>& _Emitter);
+	uint64_t					Replay(eSpeed _Speed=eSpeed::Maximum);								//!< Fire every record, returns number of signals emitted
+	inline uint64_t				GetRecordCount()const;
+	inline uint64_t				GetSkippedCount()const		{ return mSkippedCount; }
+
+protected:
+	typedef void (*FireFunc)(void* _pEmitter, const uint8_t* _pArgs);
+
+	//! Registered emitter, with the stub decoding its arguments
+	struct Target
+	{
+		void*					mpEmitter;
+		FireFunc				mpFire;
+		uint32_t				mArgBytes;
+	};
+
+	template<typename... TParameters>
+	static void					FireStub(void* _pEmitter, const uint8_t* _pArgs);
+	template<typename TValue>
+	static inline TValue		ReadValue(const uint8_t* _pData);
+	template<typename... TValues, size_t... TIndices>
+	static inline std::tuple<TValues...> ReadValues(const uint8_t* _pArgs, std::index_sequence<TIndices...>);
+
+	zSignalLogFile				mFile;
+	eastl::hash_map<uint32_t, Target> mhmTargets;
+	uint64_t					mSkippedCount	= 0;
+};
+
+//==================================================================================================
+//! @Class		zEmitter whose signals can be recorded
+//! @details	Recording is opt-in : without a recorder, signaling only costs an extra test.
+//!				Slots connect to it as they would on a zEmitter<TParameters...>.
+//!				Parameters must be trivially copyable values : references and pointers are
+//!				rejected, since replay could only give slots a copy (or a stale address)
+//!				instead of what they received live.
+//==================================================================================================
+template<typename... TParameters>
+class zRecordedEmitter : public zEmitter<TParameters...>
+{
+	static_assert((std::is_trivially_copyable<typename std::decay<TParameters>::type>::value && ...), "Recorded signal parameters must be trivially copyable");
+	static_assert(((!std::is_reference<TParameters>::value && !std::is_pointer<TParameters>::value) && ...), "Recorded signal parameters can't be references or pointers, replay wouldn't match live delivery");
+public:
+	explicit					zRecordedEmitter(uint32_t _Id, zSignalRecorder* _pRecorder=nullptr) : mId(_Id), mpRecorder(_pRecorder) {}
+	inline void					Signal(TParameters... _Values)const;								//!< Record signal (if recording), then signal all slots
+	inline void					SetRecorder(zSignalRecorder* _pRecorder)	{ mpRecorder = _pRecorder; }
+	inline uint32_t				GetId()const								{ return mId; }
+
+protected:
+	uint32_t					mId;																//!< Identifies emitter in recorded logs
+	zSignalRecorder*			mpRecorder;
+};
+
+#include "SignalRecorder.inl"
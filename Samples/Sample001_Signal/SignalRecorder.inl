@@ -0,0 +1,92 @@
+
+uint64_t zSignalRecorder::ReadTicks()
+{
+#if (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))) || defined(__x86_64__) || defined(__i386__)
+	return __rdtsc();
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+	uint64_t Ticks;
+	asm volatile("mrs %0, cntvct_el0" : "=r"(Ticks));
+	return Ticks;
+#else
+	return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+uint8_t* zSignalRecorder::Reserve(uint64_t _Bytes)
+{
+	if( mWriteOffset + _Bytes > mFile.GetSize() && !Grow(mWriteOffset + _Bytes) )
+		return nullptr;
+	uint8_t* pData	= mFile.GetData() + mWriteOffset;
+	mWriteOffset	+= _Bytes;
+	return pData;
+}
+
+template<typename... TValues>
+void zSignalRecorder::Record(uint32_t _EmitterId, const TValues&... _Values)
+{
+	constexpr uint32_t ArgBytes = GetArgBytes<TValues...>();
+	uint8_t* pData = Reserve(sizeof(RecordHeader) + ArgBytes);
+	if( pData == nullptr )
+	{
+		++mDroppedCount;
+		return;
+	}
+
+	RecordHeader Header;
+	Header.mTicks		= ReadTicks() - mStartTicks;
+	Header.mEmitterId	= _EmitterId;
+	Header.mArgBytes	= ArgBytes;
+	memcpy(pData, &Header, sizeof(Header));
+	pData += sizeof(Header);
+	((memcpy(pData, &_Values, sizeof(TValues)), pData += sizeof(TValues)), ...);
+	++mRecordCount;
+}
+
+template<typename... TParameters>
+void zSignalReplayer::Register(uint32_t _EmitterId, zEmitter<TParameters...>& _Emitter)
+{
+	static_assert((std::is_trivially_copyable<typename std::decay<TParameters>::type>::value && ...), "Replayed signal parameters must be trivially copyable");
+	Target& TargetItem	= mhmTargets[_EmitterId];
+	TargetItem.mpEmitter= &_Emitter;
+	TargetItem.mpFire	= &FireStub<TParameters...>;
+	TargetItem.mArgBytes= zSignalRecorder::GetArgBytes<TParameters...>();
+}
+
+uint64_t zSignalReplayer::GetRecordCount()const
+{
+	return mFile.GetData() ? reinterpret_cast<const zSignalRecorder::FileHeader*>(mFile.GetData())->mRecordCount : 0;
+}
+
+template<typename TValue>
+TValue zSignalReplayer::ReadValue(const uint8_t* _pData)
+{
+	TValue Value;
+	memcpy(&Value, _pData, sizeof(TValue));
+	return Value;
+}
+
+template<typename... TValues, size_t... TIndices>
+std::tuple<TValues...> zSignalReplayer::ReadValues(const uint8_t* _pArgs, std::index_sequence<TIndices...>)
+{
+	constexpr size_t aSizes[]						= {sizeof(TValues)..., 0};
+	size_t aOffsets[sizeof...(TValues) + 1]			= {0};
+	for( size_t i(0); i<sizeof...(TValues); ++i )
+		aOffsets[i + 1] = aOffsets[i] + aSizes[i];
+	(void)_pArgs;
+	return std::tuple<TValues...>(ReadValue<TValues>(_pArgs + aOffsets[TIndices])...);
+}
+
+template<typename... TParameters>
+void zSignalReplayer::FireStub(void* _pEmitter, const uint8_t* _pArgs)
+{
+	auto Values = ReadValues<typename std::decay<TParameters>::type...>(_pArgs, std::index_sequence_for<TParameters...>());
+	std::apply([_pEmitter](auto&... _Values){ static_cast<zEmitter<TParameters...>*>(_pEmitter)->Signal(_Values...); }, Values);
+}
+
+template<typename... TParameters>
+void zRecordedEmitter<TParameters...>::Signal(TParameters... _Values)const
+{
+	if( mpRecorder )
+		mpRecorder->Record(mId, _Values...);
+	zEmitter<TParameters...>::Signal(_Values...);
+}
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <EASTL/intrusive_list.h>
+#include <EASTL/fixed_vector.h>
+#include "SignalCallback.h"
+
+//==================================================================================================
+// Combiners, merging the values returned by slots of a zResultEmitter
+// 'Add' receives each slot result in invocation order, and returns false to skip remaining slots.
+// 'GetResult' returns the merged value once dispatch is done.
+//==================================================================================================
+
+//! Keep value returned by last slot invoked
+template<typename TValue>
+struct zCombinerLast
+{
+	typedef TValue				Result;
+	inline bool					Add(TValue&& _Value)		{ mResult = std::move(_Value); return true; }
+	inline const Result&		GetResult()const			{ return mResult; }
+	Result						mResult = Result();
+};
+
+//! Keep first value that is not null (pointer-like), and stop there
+template<typename TValue>
+struct zCombinerFirstNonNull
+{
+	typedef TValue				Result;
+	inline bool					Add(TValue&& _Value)		{ if( !_Value ) return true; mResult = std::move(_Value); return false; }
+	inline const Result&		GetResult()const			{ return mResult; }
+	Result						mResult = Result();
+};
+
+//! Stop on first slot returning true ("can anyone handle this ?")
+struct zCombinerStopOnTrue
+{
+	typedef bool				Result;
+	inline bool					Add(bool _bValue)			{ mResult = _bValue; return !_bValue; }
+	inline const Result&		GetResult()const			{ return mResult; }
+	Result						mResult = false;
+};
+
+//! Sum of all returned values
+template<typename TValue>
+struct zCombinerSum
+{
+	typedef TValue				Result;
+	inline bool					Add(TValue&& _Value)		{ mResult += _Value; return true; }
+	inline const Result&		GetResult()const			{ return mResult; }
+	Result						mResult = Result();
+};
+
+//! Highest returned value (lowest possible value when no slot)
+template<typename TValue>
+struct zCombinerMax
+{
+	typedef TValue				Result;
+	inline bool					Add(TValue&& _Value)		{ if( mResult < _Value ) mResult = std::move(_Value); return true; }
+	inline const Result&		GetResult()const			{ return mResult; }
+	Result						mResult = std::numeric_limits<TValue>::lowest();
+};
+
+//! Every returned value, in a fixed_vector (only allocates past TCount values)
+template<typename TValue, size_t TCount=8>
+struct zCombinerCollect
+{
+	typedef eastl::fixed_vector<TValue, TCount, true> Result;
+	inline bool					Add(TValue&& _Value)		{ mResult.push_back(std::move(_Value)); return true; }
+	inline const Result&		GetResult()const			{ return mResult; }
+	Result						mResult;
+};
+
+template<typename TSignature, typename TCombiner=void>
+class zResultEmitter;
+
+//==================================================================================================
+//! @Class		Emitter whose slots return a value, merged by a combiner
+//! @details	Replaces the out-parameter pattern for query-style events ("can anyone handle
+//!				this ?", "sum weights of all listeners"). 'Signal' uses the emitter default
+//!				combiner type (zCombinerLast when void) and returns its result, 'Combine'
+//!				dispatches into any combiner instance.
+//!				Dispatch stops as soon as the combiner 'Add' returns false.
+//!				Slots are invoked in connection order, like zEmitter.
+//! @Example	zResultEmitter<bool(const Event&), zCombinerStopOnTrue> Emitter;
+//!				bool bHandled = Emitter.Signal(Event);
+//!				zCombinerCollect<float> Weights; WeightEmitter.Combine(Weights, Item);
+//==================================================================================================
+template<typename TResult, typename... TParameters, typename TCombiner>
+class zResultEmitter<TResult(TParameters...), TCombiner>
+{
+	static_assert(!std::is_void<TResult>::value, "Use zEmitter for slots without return value");
+public:
+	typedef typename std::conditional<std::is_void<TCombiner>::value, zCombinerLast<TResult>, TCombiner>::type DefaultCombiner;
+	typedef typename std::decay<decltype(std::declval<const DefaultCombiner&>().GetResult())>::type Result;
+
+	//----------------------------------------------------------------------------------------------
+	//! @Class	Callback returning a value, auto removed from emitter when destroyed
+	//----------------------------------------------------------------------------------------------
+	class Slot : public eastl::intrusive_list_node
+	{
+	public:
+		typedef zCallback<TResult(TParameters...)> Callback;
+
+								Slot()						{ mpNext = mpPrev = nullptr; }
+								~Slot()						{ Disconnect(); }
+		inline void				Connect(zResultEmitter& _Emitter, const Callback& _Callback);
+		template<auto TFunction>
+		inline void				Connect(zResultEmitter& _Emitter)						{ Connect(_Emitter, Callback::template Bind<TFunction>()); }
+		template<auto TMethod, typename TObject>
+		inline void				Connect(zResultEmitter& _Emitter, TObject* _pObject)	{ Connect(_Emitter, Callback::template Bind<TMethod>(_pObject)); }
+		inline void				Disconnect();
+		inline bool				IsConnected()const			{ return mpNext != nullptr; }
+		inline const Callback&	GetCallback()const			{ return mCallback; }
+	protected:
+		Callback				mCallback;
+	};
+
+	inline Result				Signal(TParameters... _Values)const;								//!< Dispatch with a default constructed combiner, and return its result
+	template<typename TOtherCombiner>
+	inline void					Combine(TOtherCombiner& _Combiner, TParameters... _Values)const;	//!< Dispatch into a provided combiner
+	inline void					DisconnectAll();
+
+protected:
+	typedef eastl::intrusive_list<Slot> SlotList;
+	friend class Slot;
+	SlotList					mlstSlots;
+};
+
+#include "SignalResultEmitter.inl"
@@ -0,0 +1,47 @@
+
+template<typename TResult, typename... TParameters, typename TCombiner>
+void zResultEmitter<TResult(TParameters...), TCombiner>::Slot::Connect(zResultEmitter& _Emitter, const Callback& _Callback)
+{
+	Disconnect();
+	mCallback = _Callback;
+	_Emitter.mlstSlots.push_back(*this);
+}
+
+template<typename TResult, typename... TParameters, typename TCombiner>
+void zResultEmitter<TResult(TParameters...), TCombiner>::Slot::Disconnect()
+{
+	if( mpNext != nullptr )
+	{
+		SlotList::remove(*this);
+		mpNext = nullptr;
+		mpPrev = nullptr;
+	}
+}
+
+template<typename TResult, typename... TParameters, typename TCombiner>
+typename zResultEmitter<TResult(TParameters...), TCombiner>::Result zResultEmitter<TResult(TParameters...), TCombiner>::Signal(TParameters... _Values)const
+{
+	DefaultCombiner Combiner;
+	Combine(Combiner, _Values...);
+	return Combiner.GetResult();
+}
+
+template<typename TResult, typename... TParameters, typename TCombiner>
+template<typename TOtherCombiner>
+void zResultEmitter<TResult(TParameters...), TCombiner>::Combine(TOtherCombiner& _Combiner, TParameters... _Values)const
+{
+	auto it = mlstSlots.begin();
+	while( it != mlstSlots.end() )
+	{
+		const Slot& slot = *it++; //Increment before invoking callback, so if callback removes slot, won't affect iteration
+		if( !_Combiner.Add(slot.GetCallback()(_Values...)) )
+			return;
+	}
+}
+
+template<typename TResult, typename... TParameters, typename TCombiner>
+void zResultEmitter<TResult(TParameters...), TCombiner>::DisconnectAll()
+{
+	while( !mlstSlots.empty() )
+		mlstSlots.front().Disconnect();
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <stdint.h>
+#include <EASTL/intrusive_list.h>
+#include "SignalCallback.h"
+
+//==================================================================================================
+//! @Class		Emitter with reentrancy safe delivery
+//! @details	zEmitter 'Signal' only supports a callback disconnecting its own slot. This one
+//!				also supports callbacks that :
+//!				- Disconnect or destroy any slot (including the next one to be invoked)
+//!				- Connect new slots : they are not invoked by the signals already in progress
+//!				- Signal the same emitter again : nested signal is fully delivered to current
+//!				  slots, then outer signal resumes where it was
+//!				- Destroy the emitter : remaining slots are skipped
+//!				Each 'Signal' keeps a delivery record on the stack, chained in the emitter.
+//!				Disconnecting a slot moves the cursor of deliveries about to invoke it,
+//!				and slots are stamped with a connection generation, skipped by deliveries
+//!				that started before they connected. No allocation involved.
+//! @Example	Same usage as zEmitter
+//==================================================================================================
+template<typename... TParameters>
+class zSafeEmitter
+{
+public:
+	//----------------------------------------------------------------------------------------------
+	//! @Class	Slot aware of its emitter, to update deliveries in progress when removed
+	//----------------------------------------------------------------------------------------------
+	class Slot : public eastl::intrusive_list_node
+	{
+	public:
+		typedef zCallback<void(TParameters...)>		Callback;
+		typedef zSafeEmitter<TParameters...>		Emitter;
+
+								Slot()						{ mpNext = mpPrev = nullptr; }
+								~Slot()						{ Disconnect(); }
+								Slot(const Slot&)=delete;
+		Slot&					operator=(const Slot&)=delete;
+		inline void				Connect(zSafeEmitter& _Emitter, const Callback& _Callback);
+		template<auto TFunction>
+		inline void				Connect(zSafeEmitter& _Emitter)						{ Connect(_Emitter, Callback::template Bind<TFunction>()); }
+		template<auto TMethod, typename TObject>
+		inline void				Connect(zSafeEmitter& _Emitter, TObject* _pObject)	{ Connect(_Emitter, Callback::template Bind<TMethod>(_pObject)); }
+		inline void				Disconnect();
+		inline bool				IsConnected()const			{ return mpEmitter != nullptr; }
+		inline const Callback&	GetCallback()const			{ return mCallback; }
+
+	protected:
+		Callback				mCallback;
+		zSafeEmitter*			mpEmitter	= nullptr;
+		uint64_t				mGeneration	= 0;													//!< Emitter generation when connected
+		friend class zSafeEmitter;
+	};
+
+								zSafeEmitter()=default;
+								~zSafeEmitter();
+								zSafeEmitter(const zSafeEmitter&)=delete;
+	zSafeEmitter&				operator=(const zSafeEmitter&)=delete;
+
+	inline void					Signal(TParameters... _Values)const;
+	inline void					DisconnectAll();
+
+protected:
+	//! State of a 'Signal' in progress, lives on its stack
+	struct Delivery
+	{
+		eastl::intrusive_list_node* mpNextNode;														//!< Next slot to invoke (list anchor when done)
+		uint64_t				mGeneration;														//!< Only slots connected at or before this generation are invoked
+		Delivery*				mpOuter;															//!< Delivery in progress when this one started (nested signal)
+		bool					mbEmitterDestroyed;
+	};
+
+	inline void					Remove(Slot& _Slot);
+
+	typedef eastl::intrusive_list<Slot> SlotList;
+	mutable SlotList			mlstSlots;
+	mutable Delivery*			mpDelivery	= nullptr;												//!< Inner most delivery in progress
+	uint64_t					mGeneration	= 0;													//!< Incremented on each connection
+	friend class Slot;
+};
+
+#include "SignalSafeEmitter.inl"
@@ -0,0 +1,67 @@
+
+template<typename... TParameters>
+void zSafeEmitter<TParameters...>::Slot::Connect(zSafeEmitter& _Emitter, const Callback& _Callback)
+{
+	Disconnect();
+	mCallback	= _Callback;
+	mpEmitter	= &_Emitter;
+	mGeneration	= ++_Emitter.mGeneration;
+	_Emitter.mlstSlots.push_back(*this);
+}
+
+template<typename... TParameters>
+void zSafeEmitter<TParameters...>::Slot::Disconnect()
+{
+	if( mpEmitter )
+		mpEmitter->Remove(*this);
+}
+
+template<typename... TParameters>
+void zSafeEmitter<TParameters...>::Remove(Slot& _Slot)
+{
+	for( Delivery* pDelivery = mpDelivery; pDelivery; pDelivery = pDelivery->mpOuter )
+	{
+		if( pDelivery->mpNextNode == &_Slot )
+			pDelivery->mpNextNode = _Slot.mpNext;
+	}
+	SlotList::remove(_Slot);
+	_Slot.mpNext	= nullptr;
+	_Slot.mpPrev	= nullptr;
+	_Slot.mpEmitter	= nullptr;
+}
+
+template<typename... TParameters>
+zSafeEmitter<TParameters...>::~zSafeEmitter()
+{
+	for( Delivery* pDelivery = mpDelivery; pDelivery; pDelivery = pDelivery->mpOuter )
+	{
+		pDelivery->mpNextNode			= mlstSlots.end().mpNode;	// Ends delivery loop
+		pDelivery->mbEmitterDestroyed	= true;
+	}
+	mpDelivery = nullptr;
+	DisconnectAll();
+}
+
+template<typename... TParameters>
+void zSafeEmitter<TParameters...>::Signal(TParameters... _Values)const
+{
+	const eastl::intrusive_list_node* pEnd = mlstSlots.end().mpNode;
+	Delivery Current{mlstSlots.begin().mpNode, mGeneration, mpDelivery, false};
+	mpDelivery = &Current;
+	while( Current.mpNextNode != pEnd )
+	{
+		const Slot& slot	= *static_cast<const Slot*>(Current.mpNextNode);
+		Current.mpNextNode	= Current.mpNextNode->mpNext;	// Advance before invoking callback, 'Remove' moves it if callback removes the next slot
+		if( slot.mGeneration <= Current.mGeneration )
+			slot.mCallback(_Values...);
+	}
+	if( !Current.mbEmitterDestroyed )	// Emitter memory is gone otherwise, don't touch it
+		mpDelivery = Current.mpOuter;
+}
+
+template<typename... TParameters>
+void zSafeEmitter<TParameters...>::DisconnectAll()
+{
+	while( !mlstSlots.empty() )
+		Remove(mlstSlots.front());
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <utility>
+#include "SignalEmitter.h"
+
+//==================================================================================================
+//! @Class		Emitter to handlers wiring known at compile time
+//! @details	Handlers are listed as template parameters : free functions, or methods of an
+//!				object with static storage (see 'zStaticMethod'). 'Signal' expands to a sequence
+//!				of direct calls, without list walk or indirect call, letting the compiler inline
+//!				the handlers. There is no slot and nothing to connect/disconnect.
+//!				Use 'zStaticEmitter' to also accept dynamic slots, like a zEmitter.
+//! @Example	typedef zStaticSignal<void(int), &OnDamage, zStaticMethod<&HudSystem::OnDamage, &gHud>> DamageSignal;
+//!				DamageSignal::Signal(10);
+//==================================================================================================
+template<typename TSignature, auto... THandlers>
+class zStaticSignal;
+
+template<typename... TParameters, auto... THandlers>
+class zStaticSignal<void(TParameters...), THandlers...>
+{
+public:
+	static constexpr size_t		kHandlerCount = sizeof...(THandlers);
+	static inline void			Signal(TParameters... _Values);										//!< Invoke every handler, in declaration order
+};
+
+//==================================================================================================
+//! @Class		Emitter with handlers wired at compile time, and regular dynamic slots
+//! @details	Static handlers are invoked first (direct calls), followed by zEmitter slots.
+//!				zEmitter is a protected base : it can't be passed where a zEmitter is expected,
+//!				since signaling it from there would skip the static handlers. Slots connect
+//!				with zStaticEmitter::Slot, the same way they would on a zEmitter<TParameters...>.
+//! @Example	zStaticEmitter<void(int), &OnDamage> Emitter;
+//!				decltype(Emitter)::Slot SlotItem;
+//!				SlotItem.Connect(Emitter, [](int inDamage){ ... });
+//!				Emitter.Signal(10);
+//==================================================================================================
+template<typename TSignature, auto... THandlers>
+class zStaticEmitter;
+
+template<typename... TParameters, auto... THandlers>
+class zStaticEmitter<void(TParameters...), THandlers...> : protected zEmitter<TParameters...>
+{
+protected:
+	typedef zEmitter<TParameters...> Base;
+public:
+	typedef zStaticSignal<void(TParameters...), THandlers...> StaticSignal;
+
+	//----------------------------------------------------------------------------------------------
+	//! @Class	zEmitter slot, connecting to a zStaticEmitter
+	//----------------------------------------------------------------------------------------------
+	class Slot : public Base::Slot
+	{
+	public:
+		typedef typename Base::Slot::Callback		Callback;
+		typedef zStaticEmitter						Emitter;
+
+		inline void				Connect(zStaticEmitter& _Emitter, const Callback& _Callback)	{ Base::Slot::Connect(_Emitter, _Callback); }
+		template<auto TFunction>
+		inline void				Connect(zStaticEmitter& _Emitter)								{ Base::Slot::template Connect<TFunction>(_Emitter); }
+		template<auto TMethod, typename TObject>
+		inline void				Connect(zStaticEmitter& _Emitter, TObject* _pObject)			{ Base::Slot::template Connect<TMethod>(_Emitter, _pObject); }
+	};
+
+	inline void					Signal(TParameters... _Values)const;								//!< Invoke static handlers, then connected slots
+	using						Base::DisconnectAll;
+#if ZEN_SIGNAL_COROUTINE
+	using						Base::Next;
+#endif
+};
+
+//==================================================================================================
+//! @brief		Static handler calling a method of an object with static storage
+//! @details	Gives a function pointer usable in zStaticSignal/zStaticEmitter handler list.
+//! @Example	zStaticMethod<&HudSystem::OnDamage, &gHud>
+//==================================================================================================
+template<auto TMethod, auto TObject, typename TMethodType=decltype(TMethod)>
+struct zStaticMethodStub;
+
+template<auto TMethod, auto TObject>
+constexpr auto zStaticMethod = &zStaticMethodStub<TMethod, TObject>::Invoke;
+
+#include "SignalStaticEmitter.inl"
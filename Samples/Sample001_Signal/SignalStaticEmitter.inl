@@ -0,0 +1,25 @@
+
+template<typename... TParameters, auto... THandlers>
+void zStaticSignal<void(TParameters...), THandlers...>::Signal(TParameters... _Values)
+{
+	(THandlers(_Values...), ...);
+}
+
+template<typename... TParameters, auto... THandlers>
+void zStaticEmitter<void(TParameters...), THandlers...>::Signal(TParameters... _Values)const
+{
+	StaticSignal::Signal(_Values...);
+	zEmitter<TParameters...>::Signal(_Values...);
+}
+
+template<auto TMethod, auto TObject, typename TClass, typename TReturn, typename... TParameters>
+struct zStaticMethodStub<TMethod, TObject, TReturn (TClass::*)(TParameters...)>
+{
+	static inline TReturn		Invoke(TParameters... _Values)		{ return (TObject->*TMethod)(std::forward<TParameters>(_Values)...); }
+};
+
+template<auto TMethod, auto TObject, typename TClass, typename TReturn, typename... TParameters>
+struct zStaticMethodStub<TMethod, TObject, TReturn (TClass::*)(TParameters...)const>
+{
+	static inline TReturn		Invoke(TParameters... _Values)		{ return (TObject->*TMethod)(std::forward<TParameters>(_Values)...); }
+};
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <stdint.h>
+#include <EASTL/intrusive_list.h>
+#include <EASTL/shared_ptr.h>
+#include "SignalCallback.h"
+
+//==================================================================================================
+//! @Class		Emitter whose slots are tied to the lifetime of a shared owner object
+//! @details	For listeners owned by an eastl::shared_ptr, that can't embed a Slot member whose
+//!				destructor disconnects them. The emitter creates and owns the slots, each keeping a
+//!				weak_ptr to its owner : slots of an expired owner are skipped, and unlinked/freed
+//!				when the next signal reaches them (or on 'DisconnectExpired').
+//!				By default, expiry is tested with 'weak_ptr::expired' (a plain read of the use
+//!				count, no atomic increment), which assumes owners are only released by the
+//!				thread signaling. Emitters created with 'bLockOwners' lock each owner for the
+//!				duration of its callback instead (owners released by other threads).
+//!				Callbacks can disconnect any owner (or all of them) and signal again while
+//!				signaled : slots removed during a signal are only marked dead (skipped), and
+//!				freed once the outermost signal returns, so iteration never reaches freed slots.
+//! @Example	eastl::shared_ptr<Listener> pListener = eastl::make_shared<Listener>();
+//!				Emitter.Connect<&Listener::OnSignal>(pListener);
+//!				pListener.reset();			// Not invoked anymore, slot freed on next signal
+//==================================================================================================
+template<typename... TParameters>
+class zWeakEmitter
+{
+public:
+	typedef zCallback<void(TParameters...)> Callback;
+
+	explicit					zWeakEmitter(bool _bLockOwners=false) : mbLockOwners(_bLockOwners) {}
+								~zWeakEmitter()				{ DisconnectAll(); }
+								zWeakEmitter(const zWeakEmitter&)=delete;
+	zWeakEmitter&				operator=(const zWeakEmitter&)=delete;
+
+	template<typename TOwner>
+	void						Connect(const eastl::shared_ptr<TOwner>& _pOwner, const Callback& _Callback);	//!< Callback invoked while owner is alive
+	template<auto TMethod, typename TOwner>
+	inline void					Connect(const eastl::shared_ptr<TOwner>& _pOwner)				{ Connect(_pOwner, Callback::template Bind<TMethod>(_pOwner.get())); }
+	void						Disconnect(const void* _pOwner);									//!< Remove every slot of an owner
+	void						DisconnectExpired();												//!< Free slots of expired owners, without signaling
+	void						DisconnectAll();
+	void						Signal(TParameters... _Values)const;
+	inline size_t				GetSlotCount()const			{ return mlstSlots.size(); }			//!< Including expired slots not freed yet
+
+protected:
+	struct Slot : public eastl::intrusive_list_node
+	{
+		Callback				mCallback;
+		eastl::weak_ptr<void>	mpOwner;
+		const void*				mpOwnerAddress;														//!< To find slots of an owner, without locking it
+	};
+	typedef eastl::intrusive_list<Slot> SlotList;
+
+	static inline void			Release(Slot& _Slot);
+	inline void					Remove(Slot& _Slot)const;											//!< Release slot, or only mark it dead while signaling
+	inline void					ReleaseSkipped(Slot& _Slot)const;									//!< Expired slot reached by 'Signal'
+	void						ReleaseExpired()const;
+
+	mutable SlotList			mlstSlots;															//!< Expired slots are freed by signals
+	mutable uint32_t			mSignalDepth	= 0;												//!< Signals in progress (nested when callbacks signal again)
+	mutable bool				mbHasDeadSlots	= false;											//!< Slots removed while signaling, to free once done
+	bool						mbLockOwners;
+};
+
+#include "SignalWeakEmitter.inl"
@@ -0,0 +1,121 @@
+
+template<typename... TParameters>
+template<typename TOwner>
+void zWeakEmitter<TParameters...>::Connect(const eastl::shared_ptr<TOwner>& _pOwner, const Callback& _Callback)
+{
+	if( !_pOwner )
+		return;
+
+	Slot* pSlot				= new Slot;
+	pSlot->mCallback		= _Callback;
+	pSlot->mpOwner			= eastl::weak_ptr<void>(_pOwner);
+	pSlot->mpOwnerAddress	= _pOwner.get();
+	mlstSlots.push_back(*pSlot);
+}
+
+template<typename... TParameters>
+void zWeakEmitter<TParameters...>::Release(Slot& _Slot)
+{
+	SlotList::remove(_Slot);
+	delete &_Slot;
+}
+
+template<typename... TParameters>
+void zWeakEmitter<TParameters...>::Remove(Slot& _Slot)const
+{
+	if( mSignalDepth )
+	{
+		_Slot.mpOwner.reset();			// Looks expired from now on, so it's skipped
+		_Slot.mpOwnerAddress	= nullptr;
+		mbHasDeadSlots			= true;
+	}
+	else
+		Release(_Slot);
+}
+
+template<typename... TParameters>
+void zWeakEmitter<TParameters...>::ReleaseSkipped(Slot& _Slot)const
+{
+	// Outermost signal already moved past this slot, and no other iteration is in progress
+	if( mSignalDepth == 1 )
+		Release(_Slot);
+	else
+		Remove(_Slot);
+}
+
+template<typename... TParameters>
+void zWeakEmitter<TParameters...>::ReleaseExpired()const
+{
+	auto it = mlstSlots.begin();
+	while( it != mlstSlots.end() )
+	{
+		Slot& SlotItem = *it++;
+		if( SlotItem.mpOwner.expired() )
+			Release(SlotItem);
+	}
+}
+
+template<typename... TParameters>
+void zWeakEmitter<TParameters...>::Disconnect(const void* _pOwner)
+{
+	auto it = mlstSlots.begin();
+	while( it != mlstSlots.end() )
+	{
+		Slot& SlotItem = *it++;
+		if( SlotItem.mpOwnerAddress == _pOwner )
+			Remove(SlotItem);
+	}
+}
+
+template<typename... TParameters>
+void zWeakEmitter<TParameters...>::DisconnectExpired()
+{
+	if( mSignalDepth )
+		mbHasDeadSlots = true;			// Expired slots are already skipped, freed once signaling is done
+	else
+		ReleaseExpired();
+}
+
+template<typename... TParameters>
+void zWeakEmitter<TParameters...>::DisconnectAll()
+{
+	if( mSignalDepth )
+	{
+		for( Slot& SlotItem : mlstSlots )
+			Remove(SlotItem);
+	}
+	else
+	{
+		while( !mlstSlots.empty() )
+			Release(mlstSlots.front());
+	}
+}
+
+template<typename... TParameters>
+void zWeakEmitter<TParameters...>::Signal(TParameters... _Values)const
+{
+	++mSignalDepth;
+	auto it = mlstSlots.begin();
+	while( it != mlstSlots.end() )
+	{
+		Slot& SlotItem = *it++; //Increment before invoking callback, slots removed by callbacks are only marked dead until we're done
+		if( mbLockOwners )
+		{
+			eastl::shared_ptr<void> pOwner = SlotItem.mpOwner.lock();	// Keeps owner alive during callback
+			if( pOwner )
+				SlotItem.mCallback(_Values...);
+			else
+				ReleaseSkipped(SlotItem);
+		}
+		else if( !SlotItem.mpOwner.expired() )
+			SlotItem.mCallback(_Values...);
+		else
+			ReleaseSkipped(SlotItem);
+	}
+
+	if( --mSignalDepth == 0 && mbHasDeadSlots )
+	{
+		mbHasDeadSlots = false;
+		ReleaseExpired();
+	}
+}
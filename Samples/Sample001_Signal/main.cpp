@@ -1,18 +1,59 @@
 #include <iostream>
+#include <assert.h>
+#include <cstddef>
+#include <new>
+#include "SignalProfiler.h"
+#include "SampleBenchmark.h"
+
+//==================================================================================================
+// Memory allocation operators required by EASTL containers (eastl::allocator)
+// Memory is released with 'delete[]' by EASTL, so we rely on the regular 'new[]' here
+//==================================================================================================
+void* operator new[](size_t _Size, const char* /*_zName*/, int /*_Flags*/, unsigned /*_DebugFlags*/, const char* /*_zFile*/, int /*_Line*/)
+{
+	return ::operator new[](_Size);
+}
+
+void* operator new[](size_t _Size, size_t _Alignment, size_t /*_AlignmentOffset*/, const char* /*_zName*/, int /*_Flags*/, unsigned /*_DebugFlags*/, const char* /*_zFile*/, int /*_Line*/)
+{
+	assert(_Alignment <= alignof(std::max_align_t));	// Samples do not use over-aligned types in EASTL containers
+	(void)_Alignment;
+	return ::operator new[](_Size);
+}
 
 void SampleUseage();
-void SamplePerformances();
+void SampleMemoryReport();
+bool SampleRegressions();
+bool SamplePerformances(const zBenchmarkConfig& InConfig);
+bool SamplePerformancesConcurrent();
 
-int main(int, char**)
+int main(int InArgCount, char** InArgs)
 {
+	zBenchmarkConfig Config;
+	if( !Config.Parse(InArgCount, InArgs) )
+		return 2;
+
 	printf("\n================================================================================");
 	printf("\n Sample 01 : Signal and Emitters");
 	printf("\n================================================================================");
 
 	SampleUseage();
-	SamplePerformances();
+	SampleMemoryReport();
+	bool bSuccess = SampleRegressions();
+	bSuccess &= SamplePerformances(Config);
+	if( Config.mbConcurrent )
+		bSuccess &= SamplePerformancesConcurrent();
+
+#if ZEN_SIGNAL_PROFILE
+	zSignalProfiler::DumpTopSlots(10);
+#endif
 
 	printf("\n\n================================================================================");
-	printf("\nPress 'Enter' to end");
-	getchar();
+	if( Config.mbPause )
+	{
+		printf("\nPress 'Enter' to end");
+		getchar();
+	}
+	printf("\n");
+	return bSuccess ? 0 : 1;
 }
\ No newline at end of file
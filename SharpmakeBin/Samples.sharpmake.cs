@@ -12,7 +12,7 @@ namespace Samples
 		{
 			Name = InProjectName;
 			WithEASTL = InWithEASTL;
-			AddTargets(new Target(Platform.win64, DevEnv.vs2015 | DevEnv.vs2017 | DevEnv.make, Optimization.Debug | Optimization.Release));
+			AddTargets(new Target(Platform.win64, DevEnv.vs2017 | DevEnv.make, Optimization.Debug | Optimization.Release));
 			SourceRootPath = RootDir + @"Samples\" + InProjectName;
 			IsFileNameToLower = false;
 			IsTargetFileNameToLower = false;
@@ -30,6 +30,7 @@ namespace Samples
 			conf.ProjectFileName = "[project.Name]_[target.DevEnv]";
 			conf.ProjectPath = RootDir + @"\_Projects\[project.Name]";
 			conf.IncludePaths.Add(RootDir + @"\_Projects\[project.Name]");
+			conf.Options.Add(Options.Vc.Compiler.CppLanguageStandard.CPP17);	// Samples rely on C++17 (template<auto>, if constexpr, ...)
 			
 			if( WithEASTL )
 			{
@@ -65,7 +66,7 @@ namespace Samples
 		public SolutionAllSamples()
 		{
 			Name = "AllSamples";
-			AddTargets(new Target(Platform.win64, DevEnv.vs2015 | DevEnv.vs2017, Optimization.Debug | Optimization.Release));
+			AddTargets(new Target(Platform.win64, DevEnv.vs2017, Optimization.Debug | Optimization.Release));
 			IsFileNameToLower = false;
 		}
 